@@ -51,6 +51,7 @@
 #include <bsp/start.h>
 
 #include <rtems.h>
+#include <rtems/clockdrv.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -63,6 +64,10 @@ extern "C" {
 #define BSP_A53_QEMU_VPL011_BASE 0x9000000
 #define BSP_A53_QEMU_VPL011_LENGTH 0x1000
 
+#if CLOCK_DRIVER_USE_TICKLESS_IDLE
+#define BSP_IDLE_TASK_BODY _Clock_Tickless_idle_body
+#endif
+
 /**
  * @brief Sets up the MMU translation table and enables the MMU and the caches.
  */
@@ -56,6 +56,7 @@
 #include <rtems.h>
 
 #include <bsp/default-initial-extension.h>
+#include <rtems/clockdrv.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -71,6 +72,10 @@ extern "C" {
 
 #define BSP_ARM_GIC_DIST_BASE 0x1f001000
 
+#if CLOCK_DRIVER_USE_TICKLESS_IDLE
+#define BSP_IDLE_TASK_BODY _Clock_Tickless_idle_body
+#endif
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
@@ -58,6 +58,71 @@ static void a9mpcore_clock_at_tick(volatile a9mpcore_gt *gt)
   gt->irqst = A9MPCORE_GT_IRQST_EFLG;
 }
 
+#if CLOCK_DRIVER_USE_TICKLESS_IDLE
+static uint64_t a9mpcore_clock_get_comparator(volatile a9mpcore_gt *gt)
+{
+  return ((uint64_t) gt->cmpvalupper << 32) | gt->cmpvallower;
+}
+
+static void a9mpcore_clock_set_comparator(
+  volatile a9mpcore_gt *gt,
+  uint64_t cmpval
+)
+{
+  gt->cmpvallower = (uint32_t) cmpval;
+  gt->cmpvalupper = (uint32_t) (cmpval >> 32);
+}
+
+static void a9mpcore_clock_tickless_enter(
+  volatile a9mpcore_gt *gt,
+  uint32_t ticks
+)
+{
+  uint64_t cmpval;
+
+  gt->ctrl &= ~A9MPCORE_GT_CTRL_COMP_EN;
+  cmpval = a9mpcore_clock_get_comparator(gt);
+  cmpval += (uint64_t) (ticks - 1) * gt->autoinc;
+  a9mpcore_clock_set_comparator(gt, cmpval);
+  gt->ctrl |= A9MPCORE_GT_CTRL_COMP_EN;
+}
+
+static uint32_t a9mpcore_clock_tickless_exit(
+  volatile a9mpcore_gt *gt,
+  uint32_t ticks
+)
+{
+  uint32_t interval;
+  uint64_t cmpval;
+  uint64_t last;
+  uint64_t elapsed;
+  uint64_t pending;
+
+  /* Stop the comparator, so that it is not incremented while we use it */
+  gt->ctrl &= ~A9MPCORE_GT_CTRL_COMP_EN;
+  interval = gt->autoinc;
+  cmpval = a9mpcore_clock_get_comparator(gt);
+
+  if ((gt->irqst & A9MPCORE_GT_IRQST_EFLG) != 0) {
+    /*
+     * The event of the programmed clock tick occurred and incremented the
+     * comparator.  The pending clock interrupt performs this clock tick.
+     */
+    cmpval -= interval;
+    pending = 1;
+  } else {
+    pending = 0;
+  }
+
+  last = cmpval - (uint64_t) ticks * interval;
+  elapsed = (a9mpcore_clock_get_counter(gt) - last) / interval;
+  a9mpcore_clock_set_comparator(gt, last + (elapsed + 1) * interval);
+  gt->ctrl |= A9MPCORE_GT_CTRL_COMP_EN;
+
+  return (uint32_t) (elapsed - pending);
+}
+#endif
+
 static rtems_interrupt_entry a9mpcore_clock_interrupt_entry;
 
 static void a9mpcore_clock_handler_install(rtems_interrupt_handler handler)
@@ -204,5 +269,16 @@ CPU_Counter_ticks _CPU_Counter_read(void)
 #define Clock_driver_support_install_isr(isr) \
   a9mpcore_clock_handler_install(isr)
 
+#if CLOCK_DRIVER_USE_TICKLESS_IDLE
+#define Clock_driver_support_tickless_enter(ticks) \
+  a9mpcore_clock_tickless_enter(A9MPCORE_GT, ticks)
+
+#define Clock_driver_support_tickless_exit(ticks) \
+  a9mpcore_clock_tickless_exit(A9MPCORE_GT, ticks)
+
+#define Clock_driver_support_wait_for_interrupt() \
+  __asm__ volatile ("wfi")
+#endif
+
 /* Include shared source clock driver code */
 #include "../../shared/dev/clock/clockimpl.h"
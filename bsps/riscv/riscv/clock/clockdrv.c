@@ -191,6 +191,41 @@ static void riscv_clock_at_tick(riscv_timecounter *tc)
   riscv_clock_local_set_timer(value);
 }
 
+#if CLOCK_DRIVER_USE_TICKLESS_IDLE
+static uint64_t riscv_clock_read_cmpval(void)
+{
+#ifdef RISCV_USE_S_MODE
+  return _Per_CPU_Get()->cpu_per_cpu.cmpval;
+#else
+  return riscv_clock_read_mtimecmp();
+#endif
+}
+
+static void riscv_clock_tickless_enter(riscv_timecounter *tc, uint32_t ticks)
+{
+  uint64_t value;
+
+  value = riscv_clock_read_cmpval();
+  value += (uint64_t) (ticks - 1) * tc->interval;
+  riscv_clock_local_set_timer(value);
+}
+
+static uint32_t riscv_clock_tickless_exit(
+  riscv_timecounter *tc,
+  uint32_t ticks
+)
+{
+  uint64_t last;
+  uint64_t elapsed;
+
+  last = riscv_clock_read_cmpval() - (uint64_t) ticks * tc->interval;
+  elapsed = (riscv_clock_read_timer(tc) - last) / tc->interval;
+  riscv_clock_local_set_timer(last + (elapsed + 1) * tc->interval);
+
+  return (uint32_t) elapsed;
+}
+#endif
+
 static void riscv_clock_local_enable_isr()
 {
 #ifdef RISCV_USE_S_MODE
@@ -294,6 +329,17 @@ RTEMS_SYSINIT_ITEM(
 
 #define Clock_driver_support_at_tick(arg) riscv_clock_at_tick(arg)
 
+#if CLOCK_DRIVER_USE_TICKLESS_IDLE
+#define Clock_driver_support_tickless_enter(ticks) \
+  riscv_clock_tickless_enter(&riscv_clock_tc, ticks)
+
+#define Clock_driver_support_tickless_exit(ticks) \
+  riscv_clock_tickless_exit(&riscv_clock_tc, ticks)
+
+#define Clock_driver_support_wait_for_interrupt() \
+  __asm__ volatile ("wfi")
+#endif
+
 #define Clock_driver_support_initialize_hardware() riscv_clock_initialize()
 
 #define Clock_driver_support_install_isr(isr) \
@@ -72,6 +72,10 @@ extern "C" {
 
 #define BSP_FDT_IS_SUPPORTED
 
+#if CLOCK_DRIVER_USE_TICKLESS_IDLE
+#define BSP_IDLE_TASK_BODY _Clock_Tickless_idle_body
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -86,6 +86,35 @@ static void arm_gt_clock_at_tick(arm_gt_clock_context *ctx)
 #endif /* ARM_GENERIC_TIMER_UNMASK_AT_TICK */
 }
 
+#if CLOCK_DRIVER_USE_TICKLESS_IDLE
+static void arm_gt_clock_tickless_enter(
+  arm_gt_clock_context *ctx,
+  uint32_t ticks
+)
+{
+  uint64_t cval;
+
+  cval = arm_gt_clock_get_compare_value();
+  cval += (uint64_t) (ticks - 1) * ctx->interval;
+  arm_gt_clock_set_compare_value(cval);
+}
+
+static uint32_t arm_gt_clock_tickless_exit(
+  arm_gt_clock_context *ctx,
+  uint32_t ticks
+)
+{
+  uint64_t last;
+  uint64_t elapsed;
+
+  last = arm_gt_clock_get_compare_value() - (uint64_t) ticks * ctx->interval;
+  elapsed = (arm_gt_clock_get_count() - last) / ctx->interval;
+  arm_gt_clock_set_compare_value(last + (elapsed + 1) * ctx->interval);
+
+  return (uint32_t) elapsed;
+}
+#endif
+
 static rtems_interrupt_entry arm_gt_interrupt_entry;
 
 static void arm_gt_clock_handler_install(rtems_interrupt_handler handler)
@@ -219,6 +248,17 @@ RTEMS_SYSINIT_ITEM(
 #define Clock_driver_support_install_isr(isr) \
   arm_gt_clock_handler_install(isr)
 
+#if CLOCK_DRIVER_USE_TICKLESS_IDLE
+#define Clock_driver_support_tickless_enter(ticks) \
+  arm_gt_clock_tickless_enter(&arm_gt_clock_instance, ticks)
+
+#define Clock_driver_support_tickless_exit(ticks) \
+  arm_gt_clock_tickless_exit(&arm_gt_clock_instance, ticks)
+
+#define Clock_driver_support_wait_for_interrupt() \
+  __asm__ volatile ("wfi")
+#endif
+
 /** @} */
 
 /* Include shared source clock driver code */
@@ -46,6 +46,7 @@
 #include <rtems/score/smpimpl.h>
 #include <rtems/score/timecounter.h>
 #include <rtems/score/thread.h>
+#include <rtems/score/threaddispatch.h>
 #include <rtems/score/watchdogimpl.h>
 
 /**
@@ -64,6 +65,26 @@
 #error "Fast Idle PLUS n ISRs per tick is not supported"
 #endif
 
+#if CLOCK_DRIVER_USE_TICKLESS_IDLE && CLOCK_DRIVER_USE_FAST_IDLE
+#error "Tickless Idle PLUS Fast Idle is not supported"
+#endif
+
+#if CLOCK_DRIVER_USE_TICKLESS_IDLE && CLOCK_DRIVER_ISRS_PER_TICK
+#error "Tickless Idle PLUS n ISRs per tick is not supported"
+#endif
+
+#if CLOCK_DRIVER_USE_TICKLESS_IDLE && \
+  defined(CLOCK_DRIVER_USE_ONLY_BOOT_PROCESSOR)
+#error "Tickless Idle PLUS only boot processor clock ticks is not supported"
+#endif
+
+#if CLOCK_DRIVER_USE_TICKLESS_IDLE && \
+  (!defined(Clock_driver_support_tickless_enter) || \
+    !defined(Clock_driver_support_tickless_exit) || \
+    !defined(Clock_driver_support_wait_for_interrupt))
+#error "The clock driver does not support the Tickless Idle mode"
+#endif
+
 #if defined(BSP_FEATURE_IRQ_EXTENSION) || \
     (CPU_SIMPLE_VECTORED_INTERRUPTS != TRUE)
 typedef void * Clock_isr_argument;
@@ -148,13 +169,110 @@ volatile uint32_t    Clock_driver_ticks;
 #error "Clock_driver_support_shutdown_hardware() is no longer supported"
 #endif
 
+#if CLOCK_DRIVER_USE_TICKLESS_IDLE
+/**
+ * @brief Maximum count of clock ticks the clock interrupt may be suppressed
+ *   while the processor is idle.
+ *
+ * The timecounter must be updated before its hardware counter overflows.
+ */
+static uint32_t _Clock_Tickless_maximum_ticks;
+
+static void _Clock_Tickless_initialize(void)
+{
+  struct timecounter *tc;
+  uint64_t            us_per_tick;
+  uint64_t            interval;
+  uint64_t            maximum;
+
+  tc = _Timecounter;
+  us_per_tick = rtems_configuration_get_microseconds_per_tick();
+  interval = (tc->tc_frequency * us_per_tick) / 1000000;
+  maximum = 0;
+
+  if (interval > 0) {
+    maximum = ((uint64_t) tc->tc_counter_mask / 2) / interval;
+  }
+
+  if (maximum > UINT32_MAX) {
+    maximum = UINT32_MAX;
+  }
+
+  _Clock_Tickless_maximum_ticks = (uint32_t) maximum;
+}
+
+/*
+ * The clock driver hooks are called with interrupts disabled.  The
+ * Clock_driver_support_tickless_enter() hook programs the clock interrupt to
+ * occur the specified count of clock ticks after the last clock tick.  The
+ * Clock_driver_support_wait_for_interrupt() hook waits until an interrupt is
+ * pending.  The Clock_driver_support_tickless_exit() hook returns the count of
+ * clock ticks elapsed since the last clock tick and programs the clock
+ * interrupt for the clock tick following the elapsed clock ticks.
+ */
+void *_Clock_Tickless_idle_body(uintptr_t ignored)
+{
+  (void) ignored;
+
+  while (true) {
+    ISR_Level        level;
+    Per_CPU_Control *cpu_self;
+    uint32_t         ticks;
+    uint32_t         elapsed;
+
+    _ISR_Local_disable(level);
+    cpu_self = _Per_CPU_Get();
+    ticks = 1;
+    elapsed = 0;
+
+    if (
+      _SMP_Get_processor_maximum() == 1
+        && _Clock_Tickless_maximum_ticks > 1
+        && cpu_self->heir == cpu_self->executing
+    ) {
+      ticks = _Watchdog_Ticks_to_next_expiration(
+        cpu_self,
+        _Clock_Tickless_maximum_ticks
+      );
+    }
+
+    if (ticks > 1) {
+      Clock_driver_support_tickless_enter(ticks);
+      Clock_driver_support_wait_for_interrupt();
+      elapsed = Clock_driver_support_tickless_exit(ticks);
+    } else {
+      Clock_driver_support_wait_for_interrupt();
+    }
+
+    /*
+     * Perform the elapsed clock ticks before the pending interrupt is
+     * serviced.  The thread dispatch is carried out afterwards.
+     */
+    if (elapsed > 0) {
+      cpu_self = _Thread_Dispatch_disable();
+      Clock_driver_ticks += elapsed;
+
+      if (elapsed > 1) {
+        _Watchdog_Tick_multiple(cpu_self, elapsed - 1);
+      }
+
+      Clock_driver_timecounter_tick((Clock_isr_argument) 0);
+      _ISR_Local_enable(level);
+      _Thread_Dispatch_enable(cpu_self);
+    } else {
+      _ISR_Local_enable(level);
+    }
+  }
+}
+#endif
+
 #if CLOCK_DRIVER_USE_FAST_IDLE
 static bool _Clock_Has_watchdogs(const Per_CPU_Control *cpu)
 {
   size_t i;
 
   for (i = 0; i < RTEMS_ARRAY_SIZE(cpu->Watchdog.Header); ++i) {
-    if (_Watchdog_Header_first(&cpu->Watchdog.Header[i]) != NULL) {
+    if (!_Watchdog_Header_is_empty(&cpu->Watchdog.Header[i])) {
       return true;
     }
   }
@@ -264,6 +382,10 @@ void _Clock_Initialize( void )
    */
   Clock_driver_support_initialize_hardware();
 
+  #if CLOCK_DRIVER_USE_TICKLESS_IDLE
+    _Clock_Tickless_initialize();
+  #endif
+
   /*
    *  If we are counting ISRs per tick, then initialize the counter.
    */
@@ -2471,6 +2471,12 @@
  *
  * - when the block size is 512 bytes, the maximum file size is 1,082,195,968
  *   bytes.
+ *
+ * Third, the blocks of a file are not contiguous.  A shared memory mapping of
+ * a file (mmap() with MAP_SHARED) can only cover a range within one block.
+ * Other ranges fail with ENOTSUP.  The extent based in-memory files enabled by
+ * ``CONFIGURE_IMFS_ENABLE_EXTENT_FILES`` support shared memory mappings of
+ * arbitrary ranges.
  * @endparblock
  */
 #define CONFIGURE_IMFS_MEMFILE_BYTES_PER_BLOCK
@@ -4860,6 +4866,14 @@
  *
  * The memory allocated for this scheduler depends on the @ref
  * CONFIGURE_MAXIMUM_PRIORITY configuration option.
+ *
+ * All operations of a scheduler instance are carried out under one instance
+ * lock.  On systems with many processors, the contention on this lock may
+ * limit the scalability.  In this case, use a <a
+ * href="https://docs.rtems.org/branches/master/c-user/config/scheduler-clustered.html">Clustered
+ * Scheduler Configuration</a> with one scheduler instance per processor or per
+ * small group of processors.  Threads can be moved between the instances with
+ * rtems_task_set_scheduler().
  * @endparblock
  */
 #define CONFIGURE_SCHEDULER_PRIORITY_SMP
@@ -322,6 +322,8 @@ typedef struct rtems_bdbuf_buffer {
 
   rtems_bdbuf_buf_state state; /**< State of the buffer. */
 
+  unsigned char queue; /**< Replacement policy queue of the buffer. */
+
   uint32_t           waiters;    /**< The number of threads waiting on this
                                   * buffer. */
   rtems_bdbuf_group *group;      /**< Pointer to the group of BDs this BD is
@@ -350,6 +352,41 @@ struct rtems_bdbuf_group {
   rtems_bdbuf_buffer *bdbuf;         /**< First BD this block covers. */
 };
 
+/**
+ * The lookup engine used to find the buffer of a block.
+ */
+typedef enum {
+  /**
+   * The buffers are looked up in an AVL tree.
+   */
+  RTEMS_BDBUF_LOOKUP_AVL_TREE,
+
+  /**
+   * The buffers are looked up in an open addressing hash index with linear
+   * probing.  The keys are stored in the index, so that a lookup does not
+   * dereference the buffer descriptors of colliding blocks.
+   */
+  RTEMS_BDBUF_LOOKUP_HASH_INDEX
+} rtems_bdbuf_lookup_engine;
+
+/**
+ * The replacement policy used to select the buffer to recycle.
+ */
+typedef enum {
+  /**
+   * The least recently used buffer is recycled.
+   */
+  RTEMS_BDBUF_REPLACEMENT_LRU,
+
+  /**
+   * The buffers are managed by a 2Q policy.  Blocks accessed once enter a
+   * recent queue of bounded size.  Blocks accessed again while cached are
+   * promoted to a frequent queue.  A sequential scan only cycles through the
+   * recent queue and does not evict the frequently used blocks.
+   */
+  RTEMS_BDBUF_REPLACEMENT_2Q
+} rtems_bdbuf_replacement_policy;
+
 /**
  * Buffering configuration definition. See confdefs.h for support on using this
  * structure.
@@ -379,6 +416,20 @@ typedef struct rtems_bdbuf_config {
                                                 * allocation size. */
   rtems_task_priority read_ahead_priority; /**< Priority of the read-ahead
                                                 * task. */
+  uint32_t            shard_count;         /**< Number of cache shards. Each
+                                                * shard has its own lock,
+                                                * lookup tree and lists. A
+                                                * value of zero or one
+                                                * selects a single shard. */
+  rtems_bdbuf_lookup_engine lookup_engine; /**< Lookup engine for the
+                                                * buffers of blocks. */
+  rtems_bdbuf_replacement_policy replacement_policy; /**< Replacement
+                                                * policy of the buffers. */
+  uint32_t            read_ahead_streams;  /**< Number of sequential read
+                                                * streams tracked per disk by
+                                                * the adaptive read-ahead. A
+                                                * value of zero selects the
+                                                * single trigger read-ahead. */
 } rtems_bdbuf_config;
 
 /**
@@ -451,6 +502,27 @@ extern const rtems_bdbuf_config rtems_bdbuf_configuration;
  */
 #define RTEMS_BDBUF_BUFFER_MAX_SIZE_DEFAULT ( 4096 )
 
+/**
+ * Default number of cache shards. The cache is protected by a single lock.
+ */
+#define RTEMS_BDBUF_SHARDS_DEFAULT 1
+
+/**
+ * Default lookup engine.
+ */
+#define RTEMS_BDBUF_LOOKUP_ENGINE_DEFAULT RTEMS_BDBUF_LOOKUP_AVL_TREE
+
+/**
+ * Default replacement policy.
+ */
+#define RTEMS_BDBUF_REPLACEMENT_POLICY_DEFAULT RTEMS_BDBUF_REPLACEMENT_LRU
+
+/**
+ * The default value for the read-ahead streams selects the single trigger
+ * read-ahead.
+ */
+#define RTEMS_BDBUF_READ_AHEAD_STREAMS_DEFAULT 0
+
 /**
  * Prepare buffering layer to work - initialize buffer descritors and (if it is
  * neccessary) buffers. After initialization all blocks is placed into the
@@ -554,6 +626,76 @@ void rtems_bdbuf_peek(
   uint32_t           nr_blocks
 );
 
+/**
+ * @brief Reads blocks directly from the disk device into a user buffer.
+ *
+ * The blocks are read with scatter/gather requests straight into the buffer
+ * and bypass the cache.  Modified buffers of the blocks are written to the
+ * device before the read.  The data of blocks with a valid buffer in the
+ * cache is taken from the cache, so that the result is coherent with buffers
+ * modified during the read.  The call waits until buffers of the blocks in
+ * use by other tasks are released, so the calling task shall not hold a
+ * buffer of the blocks.  Use this function for large transfers which would
+ * otherwise evict useful blocks from the cache.  The buffer is used for the
+ * device transfer, so it should be aligned to the cache line size
+ * (CPU_CACHE_LINE_BYTES) for devices which use DMA.
+ *
+ * Before you can use this function, the rtems_bdbuf_init() routine must be
+ * called at least once to initialize the cache, otherwise a fatal error will
+ * occur.
+ *
+ * @param dd [in] The disk device.
+ * @param block [in] Linear media block number of the first block.
+ * @param block_count [in] Number of consecutive blocks to read.
+ * @param buffer [out] The buffer for the data.  Its size must be at least the
+ * block count times the block size of the disk device.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INVALID_ID Invalid block number or count.
+ * @retval RTEMS_IO_ERROR IO error.
+ */
+rtems_status_code rtems_bdbuf_read_direct(
+  rtems_disk_device *dd,
+  rtems_blkdev_bnum  block,
+  uint32_t           block_count,
+  void              *buffer
+);
+
+/**
+ * @brief Writes blocks directly from a user buffer to the disk device.
+ *
+ * The blocks are written with scatter/gather requests straight from the
+ * buffer and bypass the cache.  The call blocks until the transfers have
+ * completed.  The buffers of the blocks are discarded before the transfer.
+ * Buffers of the blocks read into the cache during the transfer are updated
+ * with the new data after a successful transfer and are discarded after a
+ * failed transfer.  The call waits until buffers of the blocks in use by
+ * other tasks are released, so the calling task shall not hold a buffer of
+ * the blocks.  The buffer is used for the device transfer, so it should be
+ * aligned to the cache line size (CPU_CACHE_LINE_BYTES) for devices which use
+ * DMA.
+ *
+ * Before you can use this function, the rtems_bdbuf_init() routine must be
+ * called at least once to initialize the cache, otherwise a fatal error will
+ * occur.
+ *
+ * @param dd [in] The disk device.
+ * @param block [in] Linear media block number of the first block.
+ * @param block_count [in] Number of consecutive blocks to write.
+ * @param buffer [in] The data to write.  Its size must be at least the block
+ * count times the block size of the disk device.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INVALID_ID Invalid block number or count.
+ * @retval RTEMS_IO_ERROR IO error.
+ */
+rtems_status_code rtems_bdbuf_write_direct(
+  rtems_disk_device *dd,
+  rtems_blkdev_bnum  block,
+  uint32_t           block_count,
+  const void        *buffer
+);
+
 /**
  * Release the buffer obtained by a read call back to the cache. If the buffer
  * was obtained by a get call and was not already in the cache the release
@@ -652,6 +794,17 @@ rtems_status_code rtems_bdbuf_syncdev( rtems_disk_device *dd );
  */
 void rtems_bdbuf_purge_dev( rtems_disk_device *dd );
 
+/**
+ * @brief Releases the read-ahead state of the disk device @a dd.
+ *
+ * Pending read-ahead requests of the device are cancelled and the sequential
+ * read streams of the adaptive read-ahead are freed.  This function shall be
+ * called before the memory of the disk device is freed.
+ *
+ * @param dd [in] The disk device.
+ */
+void rtems_bdbuf_release_read_ahead( rtems_disk_device *dd );
+
 /**
  * @brief Sets the block size of a disk device.
  *
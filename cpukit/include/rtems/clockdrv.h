@@ -65,6 +65,22 @@ extern volatile uint32_t Clock_driver_ticks;
  */
 void _Clock_Initialize( void );
 
+/**
+ * @brief Idle thread body of clock drivers which support the tickless idle
+ *   mode.
+ *
+ * While the processor is idle, the clock interrupt is suppressed until the
+ * next watchdog of the processor may expire.  The clock ticks which elapsed in
+ * the meantime are performed at once when the processor wakes up.  BSPs which
+ * enable the CLOCK_DRIVER_USE_TICKLESS_IDLE option use this function as the
+ * BSP_IDLE_TASK_BODY.
+ *
+ * @param ignored is not used.
+ *
+ * @return This function does not return.
+ */
+void *_Clock_Tickless_idle_body( uintptr_t ignored );
+
 /** @} */
 
 #ifdef __cplusplus
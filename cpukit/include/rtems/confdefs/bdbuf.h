@@ -112,6 +112,28 @@
   RTEMS_BDBUF_READ_AHEAD_TASK_PRIORITY_DEFAULT
 #endif
 
+#ifndef CONFIGURE_BDBUF_SHARDS
+  #define CONFIGURE_BDBUF_SHARDS RTEMS_BDBUF_SHARDS_DEFAULT
+#endif
+
+#ifdef CONFIGURE_BDBUF_LOOKUP_HASH_INDEX
+  #define _CONFIGURE_BDBUF_LOOKUP_ENGINE RTEMS_BDBUF_LOOKUP_HASH_INDEX
+#else
+  #define _CONFIGURE_BDBUF_LOOKUP_ENGINE RTEMS_BDBUF_LOOKUP_ENGINE_DEFAULT
+#endif
+
+#ifndef CONFIGURE_BDBUF_READ_AHEAD_STREAMS
+  #define CONFIGURE_BDBUF_READ_AHEAD_STREAMS \
+    RTEMS_BDBUF_READ_AHEAD_STREAMS_DEFAULT
+#endif
+
+#ifdef CONFIGURE_BDBUF_REPLACEMENT_2Q
+  #define _CONFIGURE_BDBUF_REPLACEMENT_POLICY RTEMS_BDBUF_REPLACEMENT_2Q
+#else
+  #define _CONFIGURE_BDBUF_REPLACEMENT_POLICY \
+    RTEMS_BDBUF_REPLACEMENT_POLICY_DEFAULT
+#endif
+
 #define _CONFIGURE_LIBBLOCK_TASKS        \
   ( 1 + CONFIGURE_SWAPOUT_WORKER_TASKS + \
     ( CONFIGURE_BDBUF_MAX_READ_AHEAD_BLOCKS != 0 ) )
@@ -139,7 +161,11 @@ const rtems_bdbuf_config rtems_bdbuf_configuration = {
   CONFIGURE_BDBUF_CACHE_MEMORY_SIZE,
   CONFIGURE_BDBUF_BUFFER_MIN_SIZE,
   CONFIGURE_BDBUF_BUFFER_MAX_SIZE,
-  CONFIGURE_BDBUF_READ_AHEAD_TASK_PRIORITY
+  CONFIGURE_BDBUF_READ_AHEAD_TASK_PRIORITY,
+  CONFIGURE_BDBUF_SHARDS,
+  _CONFIGURE_BDBUF_LOOKUP_ENGINE,
+  _CONFIGURE_BDBUF_REPLACEMENT_POLICY,
+  CONFIGURE_BDBUF_READ_AHEAD_STREAMS
 };
 
 #ifdef __cplusplus
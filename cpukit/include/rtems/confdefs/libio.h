@@ -214,6 +214,14 @@ extern "C" {
 const size_t
   imfs_memfile_bytes_per_block = CONFIGURE_IMFS_MEMFILE_BYTES_PER_BLOCK;
 
+#ifndef CONFIGURE_IMFS_DIRECTORY_INDEX_THRESHOLD
+  #define CONFIGURE_IMFS_DIRECTORY_INDEX_THRESHOLD \
+  IMFS_DIRECTORY_INDEX_DEFAULT_THRESHOLD
+#endif
+
+const size_t
+  imfs_directory_index_threshold = CONFIGURE_IMFS_DIRECTORY_INDEX_THRESHOLD;
+
 /*
  * Using the default ops if user doesn't configure ops
  */
@@ -306,8 +314,10 @@ static const IMFS_mknod_controls IMFS_root_mknod_controls = {
   #else
   &IMFS_mknod_control_device,
   #endif
-  #ifdef CONFIGURE_IMFS_DISABLE_MKNOD_FILE
+  #if defined(CONFIGURE_IMFS_DISABLE_MKNOD_FILE)
   &IMFS_mknod_control_enosys,
+  #elif defined(CONFIGURE_IMFS_ENABLE_EXTENT_FILES)
+  &IMFS_mknod_control_extfile,
   #else
   &IMFS_mknod_control_memfile,
   #endif
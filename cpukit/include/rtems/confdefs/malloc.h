@@ -51,10 +51,17 @@
 #endif
 
 #if defined( _CONFIGURE_HEAP_EXTEND_VIA_SBRK ) || \
-  defined( CONFIGURE_MALLOC_DIRTY )
+  defined( CONFIGURE_MALLOC_DIRTY ) || \
+  defined( CONFIGURE_MALLOC_SEGREGATED_FIT ) || \
+  defined( CONFIGURE_MALLOC_PER_CPU_CACHE_OBJECTS )
 #include <rtems/malloc.h>
 #endif
 
+#ifdef CONFIGURE_MALLOC_PER_CPU_CACHE_OBJECTS
+#include <rtems/confdefs/percpu.h>
+#include <rtems/sysinit.h>
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -68,6 +75,40 @@ const rtems_heap_extend_handler
 rtems_malloc_dirtier_t rtems_malloc_dirty_helper = rtems_malloc_dirty_memory;
 #endif
 
+#ifdef CONFIGURE_MALLOC_SEGREGATED_FIT
+static Heap_Segregated_fit _Malloc_Segregated_fit;
+
+Heap_Segregated_fit *const rtems_malloc_segregated_fit =
+  &_Malloc_Segregated_fit;
+#endif
+
+#ifdef CONFIGURE_MALLOC_PER_CPU_CACHE_OBJECTS
+  #if CONFIGURE_MALLOC_PER_CPU_CACHE_OBJECTS <= 0
+    #error "CONFIGURE_MALLOC_PER_CPU_CACHE_OBJECTS shall be greater than zero"
+  #endif
+
+typedef struct {
+  Malloc_Cache_control Control;
+  void *Objects[ MALLOC_CACHE_CLASS_COUNT ]
+    [ CONFIGURE_MALLOC_PER_CPU_CACHE_OBJECTS ];
+} Malloc_Cache_configured_control;
+
+static Malloc_Cache_configured_control
+  _Malloc_Cache_controls[ _CONFIGURE_MAXIMUM_PROCESSORS ];
+
+const Malloc_Cache_configuration _Malloc_Cache_configuration = {
+  CONFIGURE_MALLOC_PER_CPU_CACHE_OBJECTS,
+  sizeof( Malloc_Cache_configured_control ),
+  &_Malloc_Cache_controls[ 0 ].Control
+};
+
+RTEMS_SYSINIT_ITEM(
+  _Malloc_Cache_initialize,
+  RTEMS_SYSINIT_MALLOC,
+  RTEMS_SYSINIT_ORDER_LAST
+);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -106,6 +106,21 @@ RTEMS_DEFINE_GLOBAL_SYMBOL(
     _CONFIGURE_INTERRUPT_STACK_AREA_SIZE
 );
 
+/* Watchdog timer wheel configuration */
+
+#ifdef CONFIGURE_WATCHDOG_TIMER_WHEEL
+  #include <rtems/sysinit.h>
+  #include <rtems/score/watchdogimpl.h>
+
+  Watchdog_Wheel _Watchdog_Wheels[ _CONFIGURE_MAXIMUM_PROCESSORS ];
+
+  RTEMS_SYSINIT_ITEM(
+    _Watchdog_Wheel_initialize,
+    RTEMS_SYSINIT_PER_CPU_DATA,
+    RTEMS_SYSINIT_ORDER_LAST
+  );
+#endif
+
 /* Thread stack size configuration */
 
 #ifndef CONFIGURE_MINIMUM_TASK_STACK_SIZE
@@ -159,6 +159,13 @@ struct Heap_Control *( *const _Workspace_Malloc_initializer )( void ) =
   _Workspace_Malloc_initialize_unified;
 #endif
 
+#ifdef CONFIGURE_WORKSPACE_SEGREGATED_FIT
+static Heap_Segregated_fit _Workspace_Segregated_fit_index;
+
+Heap_Segregated_fit *const _Workspace_Segregated_fit =
+  &_Workspace_Segregated_fit_index;
+#endif
+
 uint32_t rtems_minimum_stack_size = CONFIGURE_MINIMUM_TASK_STACK_SIZE;
 
 const uintptr_t _Stack_Space_size = _CONFIGURE_STACK_SPACE_SIZE;
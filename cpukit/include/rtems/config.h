@@ -140,6 +140,14 @@ extern "C" {
  */
 #define RTEMS_UNLIMITED_OBJECTS OBJECTS_UNLIMITED_OBJECTS
 
+/**
+ * @ingroup RTEMSAPIConfig
+ *
+ * @brief This flag is used in augment a resource number so that it indicates
+ *   that the objects of the resource are indexed by name.
+ */
+#define RTEMS_NAME_INDEX_OBJECTS OBJECTS_NAME_INDEX
+
 /* Generated from spec:/rtems/config/if/get-stack-allocator-avoids-work-space */
 
 /**
@@ -921,6 +929,35 @@ uint32_t rtems_configuration_get_maximum_extensions( void );
 #define rtems_resource_unlimited( _resource ) \
   ( ( _resource ) | RTEMS_UNLIMITED_OBJECTS )
 
+/**
+ * @ingroup RTEMSAPIConfig
+ *
+ * @brief Augments the resource number so that the objects of the resource are
+ *   indexed by name.
+ *
+ * @param _resource is the resource number to augment.
+ *
+ * @return Returns the resource number augmented to indicate a name index.
+ *
+ * @par Notes
+ * The name index replaces the linear search of the ident directives, for
+ * example rtems_semaphore_ident(), and of the POSIX open functions, for
+ * example sem_open(), by a hash table lookup.  It uses two pointers of memory
+ * per object.  This directive may be combined with rtems_resource_unlimited().
+ *
+ * @par Constraints
+ * @parblock
+ * The following constraints apply to this directive:
+ *
+ * - The directive is implemented by a macro and may be called from within
+ *   C/C++ constant expressions.
+ *
+ * - The directive will not cause the calling task to be preempted.
+ * @endparblock
+ */
+#define rtems_resource_name_index( _resource ) \
+  ( ( _resource ) | RTEMS_NAME_INDEX_OBJECTS )
+
 #ifdef __cplusplus
 }
 #endif
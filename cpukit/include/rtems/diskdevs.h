@@ -63,6 +63,13 @@ typedef int ( *rtems_block_device_ioctl )(
  */
 #define RTEMS_DISK_READ_AHEAD_SIZE_AUTO ( 0 )
 
+/**
+ * @brief Sequential read stream of the adaptive read-ahead.
+ *
+ * The stream state is private to the block device buffer cache.
+ */
+typedef struct rtems_blkdev_read_ahead_stream rtems_blkdev_read_ahead_stream;
+
 /**
  * @brief Block device read-ahead control.
  */
@@ -96,6 +103,20 @@ typedef struct {
    * of the disk but at most the configured max_read_ahead_blocks.
    */
   uint32_t nr_blocks;
+
+  /**
+   * @brief Time stamp source for the ages of the streams.
+   */
+  uint32_t stamp;
+
+  /**
+   * @brief Sequential read streams of the adaptive read-ahead.
+   *
+   * The buffer cache allocates the configured count of streams on the first
+   * read of the device, if the bdbuf configuration enables the adaptive
+   * read-ahead.  They are freed by rtems_bdbuf_release_read_ahead().
+   */
+  rtems_blkdev_read_ahead_stream *streams;
 } rtems_blkdev_read_ahead;
 
 /**
@@ -164,6 +185,67 @@ typedef struct {
    * Error count of transfers issued by write requests.
    */
   uint32_t write_errors;
+
+  /**
+   * @brief Lookup count.
+   *
+   * A lookup occurs in the rtems_bdbuf_get() and rtems_bdbuf_read() functions
+   * each time the buffer of the block is searched in the lookup engine of the
+   * cache.
+   */
+  uint32_t lookups;
+
+  /**
+   * @brief Lookup probe count.
+   *
+   * This is the count of AVL tree nodes or hash index slots visited by the
+   * lookups.  The ratio of probes to lookups is the average lookup cost of the
+   * configured lookup engine.
+   */
+  uint32_t lookup_probes;
+
+  /**
+   * @brief Recent queue hit count.
+   *
+   * This is the count of accesses by rtems_bdbuf_get() and rtems_bdbuf_read()
+   * which found the block cached in the recent queue of the replacement
+   * policy.  The least recently used policy has only this queue.
+   */
+  uint32_t recent_hits;
+
+  /**
+   * @brief Frequent queue hit count.
+   *
+   * This is the count of accesses by rtems_bdbuf_get() and rtems_bdbuf_read()
+   * which found the block cached in the frequent queue of the 2Q replacement
+   * policy.
+   */
+  uint32_t frequent_hits;
+
+  /**
+   * @brief Recent queue eviction count.
+   *
+   * This is the count of cached blocks recycled from the recent queue to
+   * satisfy an access to this device.
+   */
+  uint32_t recent_evictions;
+
+  /**
+   * @brief Frequent queue eviction count.
+   *
+   * This is the count of cached blocks recycled from the frequent queue to
+   * satisfy an access to this device.
+   */
+  uint32_t frequent_evictions;
+
+  /**
+   * @brief Direct transfer count.
+   *
+   * This is the count of transfer requests issued by rtems_bdbuf_read_direct()
+   * and rtems_bdbuf_write_direct().  The blocks of these transfers are also
+   * counted by the read and write block counts.
+   */
+  uint32_t direct_transfers;
 } rtems_blkdev_stats;
 
 /**
@@ -42,6 +42,7 @@
 
 #include <rtems.h>
 #include <rtems/libio.h>
+#include <sys/ioccom.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -313,8 +314,143 @@ typedef struct {
    * rtems_dosfs_create_utf8_converter().
    */
   rtems_dosfs_convert_control *converter;
+
+  /**
+   * @brief If true, then an in-memory bitmap of the free clusters is built
+   * during mount.
+   *
+   * The bitmap needs one bit per data cluster.  The file allocation table is
+   * scanned once during mount to build it.  Afterwards, cluster allocations do
+   * not read the file allocation table to find free clusters and the free
+   * cluster count reported by statvfs() is available without a scan.
+   *
+   * The free cluster count in the FSInfo sector of a FAT32 file system is
+   * updated with the exact count determined by the scan during the next
+   * synchronization.
+   */
+  bool free_cluster_bitmap;
+
+  /**
+   * @brief Count of File Allocation Table sectors cached by the file system
+   * instance.
+   *
+   * If this value is zero, then the File Allocation Table is accessed through
+   * the single sector buffer of the file system instance which is shared with
+   * directory and file data.  Otherwise, the specified count of sectors of the
+   * active File Allocation Table is cached using a least recently used
+   * replacement.  Modified sectors are written back to all copies of the File
+   * Allocation Table when they are replaced and when the file system is
+   * synchronized, for example through fsync() or unmount().
+   *
+   * @see RTEMS_DOSFS_GET_FAT_CACHE_STATS.
+   */
+  uint32_t fat_cache_sectors;
+
+  /**
+   * @brief Count of entries of the directory lookup cache of the file system
+   * instance.
+   *
+   * If this value is zero, then each name lookup scans the directory from its
+   * start.  Otherwise, the value is rounded down to a power of two and a
+   * cache with this count of entries maps the names of directory entries to
+   * the directory cluster which contains them.  The first lookup which misses
+   * the cache in a directory scans the whole directory to fill the cache.
+   * Each cache entry needs twelve bytes.
+   *
+   * @see RTEMS_DOSFS_GET_NAME_CACHE_STATS.
+   */
+  uint32_t name_cache_entries;
 } rtems_dosfs_mount_options;
 
+/**
+ * @brief FAT file system File Allocation Table cache statistics.
+ *
+ * @see RTEMS_DOSFS_GET_FAT_CACHE_STATS.
+ */
+typedef struct {
+  /**
+   * @brief Count of File Allocation Table sectors cached.
+   */
+  uint32_t sectors;
+
+  /**
+   * @brief Count of File Allocation Table sector accesses satisfied by the
+   * cache.
+   */
+  uint32_t hits;
+
+  /**
+   * @brief Count of File Allocation Table sector accesses which needed a read
+   * of the sector.
+   */
+  uint32_t misses;
+
+  /**
+   * @brief Count of modified File Allocation Table sectors written back.
+   */
+  uint32_t write_backs;
+} rtems_dosfs_fat_cache_stats;
+
+/**
+ * @brief IO control to get the File Allocation Table cache statistics of a
+ * mounted FAT file system.
+ *
+ * The IO control may be issued on any file or directory of the file system.
+ * The statistics are zero if the cache is disabled, see
+ * rtems_dosfs_mount_options::fat_cache_sectors.
+ *
+ * @code
+ * #include <sys/ioctl.h>
+ * #include <rtems/dosfs.h>
+ *
+ * int get_stats( int fd, rtems_dosfs_fat_cache_stats *stats )
+ * {
+ *   return ioctl( fd, RTEMS_DOSFS_GET_FAT_CACHE_STATS, stats );
+ * }
+ * @endcode
+ */
+#define RTEMS_DOSFS_GET_FAT_CACHE_STATS \
+  _IOR('D', 1, rtems_dosfs_fat_cache_stats)
+
+/**
+ * @brief FAT file system directory lookup cache statistics.
+ *
+ * @see RTEMS_DOSFS_GET_NAME_CACHE_STATS.
+ */
+typedef struct {
+  /**
+   * @brief Count of entries of the directory lookup cache.
+   */
+  uint32_t entries;
+
+  /**
+   * @brief Count of name lookups which found the name at the cluster
+   * provided by the cache.
+   */
+  uint32_t hits;
+
+  /**
+   * @brief Count of name lookups which scanned the directory from its start.
+   */
+  uint32_t misses;
+
+  /**
+   * @brief Count of scans of a whole directory to fill the cache.
+   */
+  uint32_t fills;
+} rtems_dosfs_name_cache_stats;
+
+/**
+ * @brief IO control to get the directory lookup cache statistics of a
+ * mounted FAT file system.
+ *
+ * The IO control may be issued on any file or directory of the file system.
+ * The statistics are zero if the cache is disabled, see
+ * rtems_dosfs_mount_options::name_cache_entries.
+ */
+#define RTEMS_DOSFS_GET_NAME_CACHE_STATS \
+  _IOR('D', 2, rtems_dosfs_name_cache_stats)
+
 /**
  * @brief Allocates and initializes a default converter.
  *
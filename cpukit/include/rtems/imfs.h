@@ -85,6 +85,11 @@ extern IMFS_memfile_ops_t imfs_memfile_ops;
  *    max_filesize with blocks of  256 is    68,173,824
  *    max_filesize with blocks of  512 is 1,082,195,968
  *  @endcode
+ *
+ *  The blocks are not contiguous, so a shared memory mapping (mmap() with
+ *  MAP_SHARED) of a "memfile" can only cover a range within one block.
+ *  Extent files (CONFIGURE_IMFS_ENABLE_EXTENT_FILES) support shared
+ *  mappings of arbitrary ranges.
  */
 #define IMFS_MEMFILE_DEFAULT_BYTES_PER_BLOCK     128
   extern const size_t imfs_memfile_bytes_per_block;
@@ -345,10 +350,42 @@ size_t IMFS_default_free_space(void);
   .get_free_space = IMFS_default_free_space \
 }
 
+/**
+ * @brief The default directory entry count at which a directory gets a name
+ * hash index.
+ */
+#define IMFS_DIRECTORY_INDEX_DEFAULT_THRESHOLD 32
+
+/**
+ * @brief The directory entry count at which a directory gets a name hash
+ * index.
+ *
+ * A value of zero disables the directory index.
+ */
+extern const size_t imfs_directory_index_threshold;
+
+typedef struct IMFS_directory_index IMFS_directory_index;
+
 typedef struct {
   IMFS_jnode_t                          Node;
   rtems_chain_control                   Entries;
   rtems_filesystem_mount_table_entry_t *mt_fs;
+
+  /**
+   * @brief The count of entries in the directory.
+   */
+  size_t                                entry_count;
+
+  /**
+   * @brief The name hash index of the directory entries.
+   *
+   * The index is built lazily once the directory has at least
+   * imfs_directory_index_threshold entries and is discarded once the
+   * directory shrinks below half of the threshold or the index cannot be
+   * allocated.  The Entries chain remains the authoritative list of entries
+   * and defines the readdir() order.
+   */
+  IMFS_directory_index                 *index;
 } IMFS_directory_t;
 
 typedef struct {
@@ -384,6 +421,49 @@ typedef struct {
   block_p         direct;           /* pointer to file image */
 } IMFS_linearfile_t;
 
+/**
+ * @brief A contiguous data area of an extent file.
+ */
+typedef struct {
+  /**
+   * @brief The file offset of the first byte of the extent.
+   */
+  size_t         start;
+
+  /**
+   * @brief The size of the extent in bytes.
+   */
+  size_t         size;
+
+  /**
+   * @brief The extent data.
+   */
+  unsigned char *data;
+
+  /**
+   * @brief Indicates if the extent is used by a shared memory mapping.
+   *
+   * A mapped extent is neither moved nor released before the file is
+   * destroyed.  The file is destroyed after its removal and the unmap of all
+   * its mappings.
+   */
+  bool           mapped;
+} IMFS_extfile_extent;
+
+/**
+ * @brief An in-memory file which stores its data in contiguous extents.
+ *
+ * The extents are sorted by file offset and cover the file data without
+ * gaps.  Each new extent is at least as large as all previous extents
+ * together, so the extent count grows logarithmically with the file size.
+ */
+typedef struct {
+  IMFS_filebase_t      File;
+  IMFS_extfile_extent *extents;
+  size_t               extent_count;
+  size_t               extent_capacity;
+} IMFS_extfile_t;
+
 /* Support copy on write for linear files */
 typedef union {
   IMFS_jnode_t      Node;
@@ -434,6 +514,11 @@ static inline IMFS_memfile_t *IMFS_iop_to_memfile( const rtems_libio_t *iop )
   return (IMFS_memfile_t *) iop->pathinfo.node_access;
 }
 
+static inline IMFS_extfile_t *IMFS_iop_to_extfile( const rtems_libio_t *iop )
+{
+  return (IMFS_extfile_t *) iop->pathinfo.node_access;
+}
+
 typedef struct {
   const IMFS_mknod_control *directory;
   const IMFS_mknod_control *device;
@@ -461,6 +546,7 @@ extern const IMFS_mknod_control IMFS_mknod_control_dir_default;
 extern const IMFS_mknod_control IMFS_mknod_control_dir_minimal;
 extern const IMFS_mknod_control IMFS_mknod_control_device;
 extern const IMFS_mknod_control IMFS_mknod_control_memfile;
+extern const IMFS_mknod_control IMFS_mknod_control_extfile;
 extern const IMFS_node_control IMFS_node_control_linfile;
 extern const IMFS_mknod_control IMFS_mknod_control_fifo;
 extern const IMFS_mknod_control IMFS_mknod_control_enosys;
@@ -1104,6 +1190,38 @@ static inline void IMFS_Set_handlers( rtems_filesystem_location_info_t *loc )
   loc->handlers = node->control->handlers;
 }
 
+/**
+ * @brief Adds the entry to the directory index.
+ *
+ * The entry must already be appended to the directory entries.  Builds the
+ * index if necessary.
+ */
+void IMFS_directory_index_add(
+  IMFS_directory_t *dir,
+  IMFS_jnode_t     *entry_node
+);
+
+/**
+ * @brief Removes the entry from the directory index.
+ *
+ * The entry must already be extracted from the directory entries.
+ */
+void IMFS_directory_index_remove(
+  IMFS_directory_t *dir,
+  IMFS_jnode_t     *entry_node
+);
+
+/**
+ * @brief Searches the directory index for an entry with the specified name.
+ *
+ * The directory must have an index.
+ */
+IMFS_jnode_t *IMFS_directory_index_search(
+  const IMFS_directory_t *dir,
+  const char             *name,
+  size_t                  namelen
+);
+
 static inline void IMFS_add_to_directory(
   IMFS_jnode_t *dir_node,
   IMFS_jnode_t *entry_node
@@ -1113,13 +1231,30 @@ static inline void IMFS_add_to_directory(
 
   entry_node->Parent = dir_node;
   rtems_chain_append_unprotected( &dir->Entries, &entry_node->Node );
+  ++dir->entry_count;
+
+  if (
+    dir->index != NULL
+      || ( imfs_directory_index_threshold != 0
+        && dir->entry_count >= imfs_directory_index_threshold )
+  ) {
+    IMFS_directory_index_add( dir, entry_node );
+  }
 }
 
 static inline void IMFS_remove_from_directory( IMFS_jnode_t *node )
 {
+  IMFS_directory_t *dir;
+
   IMFS_assert( node->Parent != NULL );
+  dir = (IMFS_directory_t *) node->Parent;
   node->Parent = NULL;
   rtems_chain_extract_unprotected( &node->Node );
+  --dir->entry_count;
+
+  if ( dir->index != NULL ) {
+    IMFS_directory_index_remove( dir, node );
+  }
 }
 
 static inline bool IMFS_is_directory( const IMFS_jnode_t *node )
@@ -91,7 +91,10 @@ extern size_t malloc_free_space(void);
 /**
  * @brief Get malloc status information.
  * 
- * Find amount of free heap remaining.
+ * Find amount of free heap remaining.  Objects held by the per-processor
+ * malloc caches are accounted as used blocks.
+ *
+ * @see rtems_malloc_cache_get_information().
  */
 extern int malloc_info(Heap_Information_block *the_info);
 
@@ -90,6 +90,153 @@ void *rtems_heap_null_extend(
 
 extern const rtems_heap_extend_handler rtems_malloc_extend_handler;
 
+/**
+ * @brief The segregated fit index of the separate C Program Heap or NULL.
+ *
+ * If this pointer is not NULL, then the separate C Program Heap uses the
+ * two-level segregated fit allocation method, otherwise it uses the first fit
+ * method.  In case the RTEMS Workspace and the C Program Heap are unified,
+ * then the workspace setting applies.
+ *
+ * This constant is defined by the application configuration option
+ * #CONFIGURE_MALLOC_SEGREGATED_FIT via <rtems/confdefs.h> or a default
+ * configuration.
+ *
+ * @see _Heap_Set_segregated_fit().
+ */
+extern Heap_Segregated_fit *const rtems_malloc_segregated_fit;
+
+/**
+ * @brief The binary logarithm of the object size of the smallest size class
+ *   of the per-processor malloc caches.
+ */
+#define MALLOC_CACHE_MINIMUM_SIZE_LOG2 4
+
+/**
+ * @brief The count of size classes of the per-processor malloc caches.
+ *
+ * The size class with index i contains objects of at least
+ * 2^(MALLOC_CACHE_MINIMUM_SIZE_LOG2 + i) bytes.  Larger requests bypass the
+ * caches.
+ */
+#define MALLOC_CACHE_CLASS_COUNT 6
+
+/**
+ * @brief The maximum count of objects moved between a per-processor malloc
+ *   cache and the C Program Heap with one allocator lock acquisition.
+ */
+#define MALLOC_CACHE_BATCH_MAXIMUM 16
+
+/**
+ * @brief This structure provides the statistics of a per-processor malloc
+ *   cache.
+ */
+typedef struct {
+  /**
+   * @brief This member contains the count of allocations satisfied by the
+   *   cache.
+   */
+  uint32_t hits;
+
+  /**
+   * @brief This member contains the count of allocations which had to refill
+   *   the cache from the C Program Heap.
+   */
+  uint32_t misses;
+
+  /**
+   * @brief This member contains the count of objects put into the cache by
+   *   free().
+   */
+  uint32_t frees;
+
+  /**
+   * @brief This member contains the count of batches returned from the cache
+   *   to the C Program Heap.
+   */
+  uint32_t flushes;
+
+  /**
+   * @brief This member contains the count of objects currently held by the
+   *   cache.
+   */
+  uint32_t cached_objects;
+} rtems_malloc_cache_information;
+
+/**
+ * @brief This structure represents the per-processor malloc cache.
+ *
+ * Each size class has a magazine of objects which are allocated from the C
+ * Program Heap.  The magazines are stored directly after the control in
+ * class-major order.
+ */
+typedef struct {
+  /**
+   * @brief This member protects the cache.
+   *
+   * The lock is only contended if a cache is flushed by
+   * rtems_malloc_cache_flush() on another processor.
+   */
+  ISR_lock_Control Lock;
+
+  /**
+   * @brief This member contains the count of objects in each magazine.
+   */
+  uint32_t count[ MALLOC_CACHE_CLASS_COUNT ];
+
+  /**
+   * @brief This member contains the cache statistics.
+   *
+   * The rtems_malloc_cache_information::cached_objects member is not
+   * maintained.
+   */
+  rtems_malloc_cache_information Stats;
+
+  /**
+   * @brief This member provides the storage of the magazines.
+   */
+  RTEMS_ALIGNED( CPU_CACHE_LINE_BYTES )
+  void *Objects[ RTEMS_ZERO_LENGTH_ARRAY ];
+} Malloc_Cache_control;
+
+/**
+ * @brief This structure provides the per-processor malloc cache
+ *   configuration.
+ */
+typedef struct {
+  /**
+   * @brief This member contains the capacity of each magazine.
+   *
+   * A value of zero disables the per-processor malloc caches.
+   */
+  uint32_t object_count;
+
+  /**
+   * @brief This member contains the size of a control including the magazine
+   *   storage.
+   */
+  size_t control_size;
+
+  /**
+   * @brief This member references the controls of the processors.
+   */
+  Malloc_Cache_control *controls;
+} Malloc_Cache_configuration;
+
+/**
+ * @brief The per-processor malloc cache configuration.
+ *
+ * This constant is defined by the application configuration option
+ * #CONFIGURE_MALLOC_PER_CPU_CACHE_OBJECTS via <rtems/confdefs.h> or a default
+ * configuration.
+ */
+extern const Malloc_Cache_configuration _Malloc_Cache_configuration;
+
+/**
+ * @brief Initializes the per-processor malloc caches.
+ */
+void _Malloc_Cache_initialize( void );
+
 /*
  * Malloc Plugin to Dirty Memory at Allocation Time
  */
@@ -271,6 +418,35 @@ void *rtems_heap_greedy_allocate_all_except_largest(
  */
 void rtems_heap_greedy_free( void *opaque );
 
+/**
+ * @brief Gets the statistics of the malloc cache of the processor.
+ *
+ * @param cpu_index is the index of the processor.
+ *
+ * @param[out] info is the pointer to an rtems_malloc_cache_information object.
+ *
+ * @retval RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval RTEMS_INVALID_ADDRESS The @a info parameter was NULL.
+ *
+ * @retval RTEMS_NOT_CONFIGURED The per-processor malloc caches are disabled.
+ *
+ * @retval RTEMS_INVALID_NUMBER The processor index was invalid.
+ */
+rtems_status_code rtems_malloc_cache_get_information(
+  uint32_t                        cpu_index,
+  rtems_malloc_cache_information *info
+);
+
+/**
+ * @brief Returns all objects of the per-processor malloc caches to the C
+ *   Program Heap.
+ *
+ * This directive may be used before heap consistency checks or to reclaim
+ * memory for large allocations.
+ */
+void rtems_malloc_cache_flush( void );
+
 /** @} */
 
 #ifdef __cplusplus
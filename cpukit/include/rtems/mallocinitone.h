@@ -80,6 +80,7 @@ static inline Heap_Control *_Malloc_Initialize_for_one_area(
     _Internal_error( INTERNAL_ERROR_NO_MEMORY_FOR_HEAP );
   }
 
+  _Heap_Set_segregated_fit( heap, rtems_malloc_segregated_fit );
   return heap;
 }
 
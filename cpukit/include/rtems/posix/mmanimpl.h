@@ -54,6 +54,13 @@ typedef struct mmap_mappings_s {
   size_t             len;   /**< The length of memory mapped */
   int                flags; /**< The mapping flags */
   POSIX_Shm_Control *shm;   /**< The shared memory object or NULL */
+
+  /**
+   * The location of the file of a shared mapping of a regular file.  It keeps
+   * the file and its storage until the unmap.  For other mappings, the mount
+   * table entry of the location is NULL.
+   */
+  rtems_filesystem_location_info_t location;
 } mmap_mapping;
 
 extern rtems_chain_control mmap_mappings;
@@ -107,6 +107,67 @@ extern Objects_Information _POSIX_Message_queue_Information;
     NULL                                              \
   )
 
+/**
+ * @brief Sends multiple messages to a message queue.
+ *
+ * The messages are sent like a sequence of mq_timedsend() calls with the
+ * same message priority would do.  The messages which are queued up are sent
+ * with one acquisition of the message queue lock.  If not even the first
+ * message can be sent immediately, then only the first message is sent and
+ * the caller may block according to the message queue flags.
+ *
+ * @param mqdes The message queue descriptor.
+ * @param msg_ptr The begin address of the messages.  The messages are stored
+ *   consecutively without gaps.
+ * @param msg_lens The array of message lengths.
+ * @param count The count of messages to send.
+ * @param msg_prio The priority of the messages.
+ * @param abstime The absolute timeout, may be NULL to wait forever.
+ *
+ * @return The count of messages sent.  In case of an error, -1 is returned and
+ *   errno is set accordingly.
+ */
+ssize_t mq_send_multiple_np(
+  mqd_t                  mqdes,
+  const char            *msg_ptr,
+  const size_t          *msg_lens,
+  size_t                 count,
+  unsigned int           msg_prio,
+  const struct timespec *abstime
+);
+
+/**
+ * @brief Receives multiple messages from a message queue.
+ *
+ * The pending messages are received up to the count which fits into the
+ * buffer with one acquisition of the message queue lock.  If the message
+ * queue is empty, then at most one message is received and the caller may
+ * block according to the message queue flags.
+ *
+ * @param mqdes The message queue descriptor.
+ * @param[out] msg_ptr The begin address of the buffer to store the messages.
+ *   The messages are stored consecutively without gaps.
+ * @param msg_len The size of the buffer.  It shall be at least the message
+ *   size of the message queue.
+ * @param[out] msg_lens The array to store the message lengths.
+ * @param[out] msg_prios The array to store the message priorities, may be
+ *   NULL.
+ * @param count The maximum count of messages to receive.
+ * @param abstime The absolute timeout, may be NULL to wait forever.
+ *
+ * @return The count of messages received.  In case of an error, -1 is
+ *   returned and errno is set accordingly.
+ */
+ssize_t mq_receive_multiple_np(
+  mqd_t                  mqdes,
+  char                  *msg_ptr,
+  size_t                 msg_len,
+  size_t                *msg_lens,
+  unsigned int          *msg_prios,
+  size_t                 count,
+  const struct timespec *abstime
+);
+
 /** @} */
 
 #ifdef __cplusplus
@@ -58,6 +58,53 @@ rtems_status_code rtems_record_start_server(
   rtems_interval      period
 );
 
+/**
+ * @brief Writes the record stream header and the thread names to the file.
+ *
+ * A record client needs this information at the start of a record stream.
+ *
+ * @param fd The file descriptor.
+ *
+ * @retval 0 Successful operation.
+ * @retval -1 An error occurred.  The errno is set to indicate the error.
+ */
+int rtems_record_sink_write_header( int fd );
+
+/**
+ * @brief Writes the records of all processors available at the time of the
+ *   call to the file.
+ *
+ * The records are fetched through rtems_record_fetch() which copies the items
+ * to the storage array.  Items overwritten by record producers during the
+ * copy are not written to the file.  They are reported through an
+ * RTEMS_RECORD_PER_CPU_OVERFLOW event.
+ *
+ * @param fd The file descriptor, for example of a file, a pipe, or a socket.
+ * @param[out] items The storage array for the fetched items.
+ * @param count The item count of the storage array.  It should be
+ *   rtems_record_get_item_count_for_fetch().
+ *
+ * @retval -1 An error occurred.  The errno is set to indicate the error.
+ *
+ * @return Returns the count of bytes written to the file.
+ */
+ssize_t rtems_record_sink_drain(
+  int                fd,
+  rtems_record_item *items,
+  size_t             count
+);
+
+/**
+ * @brief Runs a record file sink loop.
+ *
+ * Writes the record stream header and then periodically the available
+ * records to the file until a write error occurs.
+ *
+ * @param fd The file descriptor, for example of a file or a pipe.
+ * @param period The drain period in clock ticks.
+ */
+void rtems_record_sink( int fd, rtems_interval period );
+
 /** @} */
 
 #ifdef __cplusplus
@@ -239,6 +239,25 @@ rtems_rfs_buffer_handle_close(rtems_rfs_file_system* fs,
   return 0;
 }
 
+/**
+ * Transfer blocks directly between the media and a user buffer. The transfer
+ * bypasses the buffer cache and copies of the blocks in the cache are kept
+ * coherent with the media.
+ *
+ * @param[in] fs is the file system data.
+ * @param[in] block is the first block number.
+ * @param[in] count is the number of consecutive blocks.
+ * @param[in,out] data is the user buffer. It must be at least count times the
+ * block size long.
+ * @param[in] read Read the data from the media else write it.
+ *
+ * @retval 0 Successful operation.
+ * @retval error_code An error occurred.
+ */
+int rtems_rfs_buffer_transfer(rtems_rfs_file_system* fs,
+                              rtems_rfs_buffer_block block, size_t count,
+                              void* data, bool read);
+
 /**
  * Open the buffer interface.
  *
@@ -178,6 +178,11 @@ rtems_rfs_file_shared_get_size(rtems_rfs_file_system* fs,
   return rtems_rfs_block_get_size(fs, &shared->size);
 }
 
+/**
+ * The minimum number of whole blocks of a direct I/O.
+ */
+#define RTEMS_RFS_FILE_IO_DIRECT_MIN_BLOCKS (2)
+
 /**
  * File flags.
  */
@@ -370,6 +375,30 @@ int rtems_rfs_file_io_start(rtems_rfs_file_handle* handle, size_t* available,
 int rtems_rfs_file_io_end(rtems_rfs_file_handle* handle, size_t size,
                           bool read);
 
+/**
+ * Perform direct I/O on whole blocks of a file. If the file position is at the
+ * start of a block and the I/O covers at least
+ * RTEMS_RFS_FILE_IO_DIRECT_MIN_BLOCKS whole blocks, the blocks are transferred
+ * directly between the media and the user buffer bypassing the buffer cache.
+ * The user buffer is used for the media transfer, so it has to be aligned to
+ * the cache line size (CPU_CACHE_LINE_BYTES). Blocks contiguous on the media are transferred with one request. A write
+ * grows the file as needed. The file position is updated by the amount of
+ * data transferred. If direct I/O is not possible the size is set to 0 and
+ * the I/O has to be performed with rtems_rfs_file_io_start() and
+ * rtems_rfs_file_io_end().
+ *
+ * @param[in] handle is the file handle.
+ * @param[in,out] data is the user buffer.
+ * @param[in,out] size is the amount of data requested on entry and the amount
+ * of data transferred on return.
+ * @param[in] read is the I/O a read if true else it is a write.
+ *
+ * @retval 0 Successful operation.
+ * @retval error_code An error occurred.
+ */
+int rtems_rfs_file_io_direct(rtems_rfs_file_handle* handle, void* data,
+                             size_t* size, bool read);
+
 /**
  * Release the I/O resources without any changes. If data has changed in the
  * buffer and the buffer was not already released as modified the data will be
@@ -916,6 +916,386 @@ rtems_status_code rtems_message_queue_get_number_pending(
  */
 rtems_status_code rtems_message_queue_flush( rtems_id id, uint32_t *count );
 
+/**
+ * @ingroup RTEMSAPIClassicMessage
+ *
+ * @brief Puts multiple messages at the rear of the queue.
+ *
+ * @param id is the queue identifier.
+ *
+ * @param buffer is the begin address of the messages to send.  The messages
+ *   are stored consecutively without gaps.
+ *
+ * @param sizes is the array of the sizes in bytes of the messages to send.
+ *
+ * @param[in, out] count is the pointer to an uint32_t object.  The object
+ *   shall contain the count of messages to send.  When the directive call
+ *   returns, the count of messages actually sent will be stored in this
+ *   object.  This count may be less than the requested count.
+ *
+ * This directive sends the messages like a sequence of
+ * rtems_message_queue_send() calls would do.  Each task waiting at the queue
+ * receives one message.  The messages which are queued up are sent with one
+ * acquisition of the queue lock.  The directive stops at the first message
+ * which cannot be sent, for example since it is larger than the maximum
+ * message size of the queue or since no message buffer is available.  The
+ * messages before this message are sent and the directive call is successful.
+ * Check the count of messages sent to detect that not all messages were sent.
+ * If no message was sent, then the error status of the first message is
+ * returned.
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.  At
+ *   least one message was sent.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The ``buffer`` parameter was NULL.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The ``sizes`` parameter was NULL.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The ``count`` parameter was NULL.
+ *
+ * @retval ::RTEMS_INVALID_NUMBER The count of messages to send was zero.
+ *
+ * @retval ::RTEMS_INVALID_ID There was no queue associated with the identifier
+ *   specified by ``id``.
+ *
+ * @retval ::RTEMS_ILLEGAL_ON_REMOTE_OBJECT The queue resided on a remote node.
+ *
+ * @retval ::RTEMS_INVALID_SIZE The size of the first message was greater than
+ *   the maximum message size of the queue.
+ *
+ * @retval ::RTEMS_TOO_MANY The maximum number of pending messages of the queue
+ *   was reached before the first message was sent.
+ *
+ * @par Constraints
+ * @parblock
+ * The following constraints apply to this directive:
+ *
+ * - The directive may be called from within interrupt context.
+ *
+ * - The directive may be called from within device driver initialization
+ *   context.
+ *
+ * - The directive may be called from within task context.
+ *
+ * - The directive may unblock tasks.  This may cause the calling task to be
+ *   preempted.
+ * @endparblock
+ */
+rtems_status_code rtems_message_queue_send_multiple(
+  rtems_id      id,
+  const void   *buffer,
+  const size_t *sizes,
+  uint32_t     *count
+);
+
+/**
+ * @ingroup RTEMSAPIClassicMessage
+ *
+ * @brief Receives multiple messages from the queue.
+ *
+ * @param id is the queue identifier.
+ *
+ * @param[out] buffer is the begin address of a buffer to store the received
+ *   messages.  The messages are stored consecutively without gaps.  The size
+ *   of the buffer shall be at least the maximum message size of the queue
+ *   times the initial value of the object referenced by ``count``.
+ *
+ * @param[out] sizes is the array to store the sizes in bytes of the received
+ *   messages.  The array shall have at least the initial value of the object
+ *   referenced by ``count`` elements.
+ *
+ * @param[in, out] count is the pointer to an uint32_t object.  The object
+ *   shall contain the maximum count of messages to receive.  When the
+ *   directive call is successful, the count of messages received will be
+ *   stored in this object.
+ *
+ * @param option_set is the option set.
+ *
+ * @param timeout is the timeout in clock ticks if the #RTEMS_WAIT option is
+ *   set.  Use #RTEMS_NO_TIMEOUT to wait potentially forever.
+ *
+ * This directive receives the pending messages of the queue specified by
+ * ``id`` up to the maximum count with one acquisition of the queue lock.  If
+ * the queue is empty, then the directive behaves like
+ * rtems_message_queue_receive() and receives at most one message.
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.  At
+ *   least one message was received.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The ``buffer`` parameter was NULL.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The ``sizes`` parameter was NULL.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The ``count`` parameter was NULL.
+ *
+ * @retval ::RTEMS_INVALID_NUMBER The maximum count of messages to receive was
+ *   zero.
+ *
+ * @retval ::RTEMS_INVALID_ID There was no queue associated with the identifier
+ *   specified by ``id``.
+ *
+ * @retval ::RTEMS_ILLEGAL_ON_REMOTE_OBJECT The queue resided on a remote node.
+ *
+ * @retval ::RTEMS_UNSATISFIED The queue was empty.
+ *
+ * @retval ::RTEMS_TIMEOUT The timeout happened while the calling task was
+ *   waiting to receive a message
+ *
+ * @retval ::RTEMS_OBJECT_WAS_DELETED The queue was deleted while the calling
+ *   task was waiting to receive a message.
+ *
+ * @par Constraints
+ * @parblock
+ * The following constraints apply to this directive:
+ *
+ * - When the #RTEMS_NO_WAIT option is set, the directive may be called from
+ *   within interrupt context.
+ *
+ * - The directive may be called from within task context.
+ *
+ * - When the request cannot be immediately satisfied and the #RTEMS_WAIT
+ *   option is set, the calling task blocks at some point during the directive
+ *   call.
+ *
+ * - The timeout functionality of the directive requires a clock tick.
+ * @endparblock
+ */
+rtems_status_code rtems_message_queue_receive_multiple(
+  rtems_id       id,
+  void          *buffer,
+  size_t        *sizes,
+  uint32_t      *count,
+  rtems_option   option_set,
+  rtems_interval timeout
+);
+
+/**
+ * @ingroup RTEMSAPIClassicMessage
+ *
+ * @brief Obtains a message buffer of the queue.
+ *
+ * @param id is the queue identifier.
+ *
+ * @param[out] buffer is the pointer to a void pointer object.  When the
+ *   directive call is successful, the begin address of the message buffer
+ *   will be stored in this object.
+ *
+ * This directive loans an inactive message buffer of the queue specified by
+ * ``id`` to the caller.  The size of the buffer is the maximum message size of
+ * the queue.  The caller may fill in a message in place and send it with
+ * rtems_message_queue_send_buffer() or return the buffer with
+ * rtems_message_queue_release_buffer().  This avoids the copy of the message
+ * content performed by rtems_message_queue_send().
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The ``buffer`` parameter was NULL.
+ *
+ * @retval ::RTEMS_INVALID_ID There was no queue associated with the identifier
+ *   specified by ``id``.
+ *
+ * @retval ::RTEMS_ILLEGAL_ON_REMOTE_OBJECT The queue resided on a remote node.
+ *
+ * @retval ::RTEMS_TOO_MANY No inactive message buffer was available.
+ *
+ * @par Notes
+ * A loaned buffer counts against the maximum number of pending messages of
+ * the queue until it is sent or released.  The buffers of a queue are freed
+ * when the queue is deleted regardless of outstanding loans.
+ *
+ * @par Constraints
+ * @parblock
+ * The following constraints apply to this directive:
+ *
+ * - The directive may be called from within interrupt context.
+ *
+ * - The directive may be called from within device driver initialization
+ *   context.
+ *
+ * - The directive may be called from within task context.
+ *
+ * - The directive will not cause the calling task to be preempted.
+ * @endparblock
+ */
+rtems_status_code rtems_message_queue_obtain_buffer(
+  rtems_id id,
+  void   **buffer
+);
+
+/**
+ * @ingroup RTEMSAPIClassicMessage
+ *
+ * @brief Puts a loaned message buffer at the rear of the queue.
+ *
+ * @param id is the queue identifier.
+ *
+ * @param buffer is the begin address of a message buffer loaned by
+ *   rtems_message_queue_obtain_buffer() or
+ *   rtems_message_queue_receive_buffer() from this queue.
+ *
+ * @param size is the size in bytes of the message contained in the buffer.
+ *
+ * This directive sends the message contained in the loaned ``buffer`` to the
+ * queue specified by ``id`` without copying it.  If a task is waiting at the
+ * queue in rtems_message_queue_receive_buffer(), then the buffer is handed
+ * over to this task.  If a task is waiting at the queue in
+ * rtems_message_queue_receive(), then the message is copied to the buffer of
+ * this task and the loaned buffer is returned to the queue.  Otherwise, the
+ * buffer is placed at the rear of the queue.  On success, the caller gives up
+ * the loan.
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The ``buffer`` parameter was NULL.
+ *
+ * @retval ::RTEMS_INVALID_ID There was no queue associated with the identifier
+ *   specified by ``id``.
+ *
+ * @retval ::RTEMS_ILLEGAL_ON_REMOTE_OBJECT The queue resided on a remote node.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The ``buffer`` was not a loaned message
+ *   buffer of the queue.
+ *
+ * @retval ::RTEMS_INVALID_SIZE The ``size`` was greater than the maximum
+ *   message size of the queue.  The buffer remains loaned to the caller.
+ *
+ * @par Constraints
+ * @parblock
+ * The following constraints apply to this directive:
+ *
+ * - The directive may be called from within interrupt context.
+ *
+ * - The directive may be called from within device driver initialization
+ *   context.
+ *
+ * - The directive may be called from within task context.
+ *
+ * - The directive may unblock a task.  This may cause the calling task to be
+ *   preempted.
+ * @endparblock
+ */
+rtems_status_code rtems_message_queue_send_buffer(
+  rtems_id id,
+  void    *buffer,
+  size_t   size
+);
+
+/**
+ * @ingroup RTEMSAPIClassicMessage
+ *
+ * @brief Receives a message from the queue in a loaned message buffer.
+ *
+ * @param id is the queue identifier.
+ *
+ * @param[out] buffer is the pointer to a void pointer object.  When the
+ *   directive call is successful, the begin address of the loaned message
+ *   buffer containing the received message will be stored in this object.
+ *
+ * @param[out] size is the pointer to a size_t object.  When the directive call
+ *   is successful, the size in bytes of the received message will be stored in
+ *   this object.
+ *
+ * @param option_set is the option set.
+ *
+ * @param timeout is the timeout in clock ticks if the #RTEMS_WAIT option is
+ *   set.  Use #RTEMS_NO_TIMEOUT to wait potentially forever.
+ *
+ * This directive receives a message from the queue specified by ``id`` like
+ * rtems_message_queue_receive().  In contrast to
+ * rtems_message_queue_receive(), the message is not copied.  The message
+ * buffer is loaned to the caller and shall be returned with
+ * rtems_message_queue_release_buffer() or rtems_message_queue_send_buffer().
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The ``buffer`` parameter was NULL.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The ``size`` parameter was NULL.
+ *
+ * @retval ::RTEMS_INVALID_ID There was no queue associated with the identifier
+ *   specified by ``id``.
+ *
+ * @retval ::RTEMS_ILLEGAL_ON_REMOTE_OBJECT The queue resided on a remote node.
+ *
+ * @retval ::RTEMS_UNSATISFIED The queue was empty.
+ *
+ * @retval ::RTEMS_TIMEOUT The timeout happened while the calling task was
+ *   waiting to receive a message
+ *
+ * @retval ::RTEMS_OBJECT_WAS_DELETED The queue was deleted while the calling
+ *   task was waiting to receive a message.
+ *
+ * @par Notes
+ * A task waiting in this directive receives a message sent by
+ * rtems_message_queue_send() only if the queue has an inactive message buffer
+ * to hold the message.
+ *
+ * @par Constraints
+ * @parblock
+ * The following constraints apply to this directive:
+ *
+ * - When the #RTEMS_NO_WAIT option is set, the directive may be called from
+ *   within interrupt context.
+ *
+ * - The directive may be called from within task context.
+ *
+ * - When the request cannot be immediately satisfied and the #RTEMS_WAIT
+ *   option is set, the calling task blocks at some point during the directive
+ *   call.
+ *
+ * - The timeout functionality of the directive requires a clock tick.
+ * @endparblock
+ */
+rtems_status_code rtems_message_queue_receive_buffer(
+  rtems_id       id,
+  void         **buffer,
+  size_t        *size,
+  rtems_option   option_set,
+  rtems_interval timeout
+);
+
+/**
+ * @ingroup RTEMSAPIClassicMessage
+ *
+ * @brief Returns a loaned message buffer to the queue.
+ *
+ * @param id is the queue identifier.
+ *
+ * @param buffer is the begin address of a message buffer loaned by
+ *   rtems_message_queue_obtain_buffer() or
+ *   rtems_message_queue_receive_buffer() from this queue.
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The ``buffer`` parameter was NULL.
+ *
+ * @retval ::RTEMS_INVALID_ID There was no queue associated with the identifier
+ *   specified by ``id``.
+ *
+ * @retval ::RTEMS_ILLEGAL_ON_REMOTE_OBJECT The queue resided on a remote node.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The ``buffer`` was not a loaned message
+ *   buffer of the queue.
+ *
+ * @par Constraints
+ * @parblock
+ * The following constraints apply to this directive:
+ *
+ * - The directive may be called from within interrupt context.
+ *
+ * - The directive may be called from within device driver initialization
+ *   context.
+ *
+ * - The directive may be called from within task context.
+ *
+ * - The directive will not cause the calling task to be preempted.
+ * @endparblock
+ */
+rtems_status_code rtems_message_queue_release_buffer(
+  rtems_id id,
+  void    *buffer
+);
+
 /* Generated from spec:/rtems/message/if/buffer */
 
 /**
@@ -75,6 +75,22 @@ extern "C" {
  */
 #define RTEMS_SCORE_COREMSG_ENABLE_BLOCKING_SEND
 
+/**
+ *  This macro is defined when the Message Queue Handler maintains an index of
+ *  the pending messages by message priority.  The index makes the insertion
+ *  of a message with a priority in the range of the index independent of the
+ *  count of pending messages.
+ */
+#define RTEMS_SCORE_COREMSG_ENABLE_PRIORITY_INDEX
+
+/**
+ *  This is the count of message priorities covered by the priority index.
+ *  The message priorities 0 down to 1 - CORE_MESSAGE_QUEUE_PRIORITY_LEVELS
+ *  are covered.  These are the POSIX message priorities 0 up to
+ *  CORE_MESSAGE_QUEUE_PRIORITY_LEVELS - 1.
+ */
+#define CORE_MESSAGE_QUEUE_PRIORITY_LEVELS 32
+
 typedef struct CORE_message_queue_Control CORE_message_queue_Control;
 
 /**
@@ -136,6 +152,21 @@ struct CORE_message_queue_Control {
    *  message priority or in FIFO order.
    */
   Chain_Control              Pending_messages;
+  #if defined( RTEMS_SCORE_COREMSG_ENABLE_PRIORITY_INDEX )
+  /** This is a bit map of the priority levels with pending messages.  Bit
+   *  L is set if and only if a message of level L is pending.  The level of
+   *  a message with priority P is -P.
+   */
+  uint32_t                   priority_level_map;
+  /** This is the last pending message of each priority level.  A new message
+   *  is inserted after the last message of its level or of the nearest level
+   *  with a higher priority.  The entry of a level is only valid if the
+   *  corresponding bit of the priority level map is set.
+   */
+  CORE_message_queue_Buffer *priority_level_last[
+    CORE_MESSAGE_QUEUE_PRIORITY_LEVELS
+  ];
+  #endif
   /** This is the address of the memory allocated for message buffers.
    *  It is allocated are part of message queue initialization and freed
    *  as part of destroying it.
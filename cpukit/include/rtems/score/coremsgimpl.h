@@ -74,6 +74,23 @@ extern "C" {
  */
 #define CORE_MESSAGE_QUEUE_URGENT_REQUEST INT_MIN
 
+/**
+ *  @brief Used to indicate a thread waiting to receive a copy of a message.
+ *
+ *  This is the thread wait option value of a thread blocked in
+ *  _CORE_message_queue_Seize().
+ */
+#define CORE_MESSAGE_QUEUE_RECEIVE_COPY 0
+
+/**
+ *  @brief Used to indicate a thread waiting to receive a loaned buffer.
+ *
+ *  This is the thread wait option value of a thread blocked in
+ *  _CORE_message_queue_Seize_buffer().  The thread has no destination
+ *  buffer.  The message is delivered in a buffer of the message queue.
+ */
+#define CORE_MESSAGE_QUEUE_RECEIVE_BUFFER 1
+
 /**
  *  @brief The modes in which a message may be submitted to a message queue.
  *
@@ -334,6 +351,181 @@ Status_Control _CORE_message_queue_Seize(
   Thread_queue_Context       *queue_context
 );
 
+/**
+ * @brief Submits multiple messages to the message queue.
+ *
+ * The messages are submitted in order as with _CORE_message_queue_Submit().
+ * A message is delivered to a thread waiting to receive a message if there
+ * is one, otherwise it is queued up for a future receive.  Queued up messages
+ * are submitted with one acquisition of the message queue lock.
+ *
+ * The calling thread may only block if not even the first message could be
+ * submitted immediately.  In this case, only the first message is submitted.
+ *
+ * @param[in, out] the_message_queue The message queue to submit the messages
+ *   to.
+ * @param executing The executing thread.
+ * @param buffer The starting address of the messages.  The messages are
+ *   stored consecutively without gaps.
+ * @param sizes The array of message sizes.
+ * @param[in, out] count_p On input, the count of messages to submit.  It
+ *   shall be greater than zero.  On output, the count of messages which were
+ *   successfully submitted.
+ * @param submit_type Determines whether the messages are prepended,
+ *        appended, or enqueued in priority order.
+ * @param wait Indicates whether the calling thread is willing to block if
+ *        the message queue is full.
+ * @param queue_context The thread queue context used for
+ *   _CORE_message_queue_Acquire() or _CORE_message_queue_Acquire_critical().
+ *
+ * @retval STATUS_SUCCESSFUL At least one message was successfully submitted
+ *   to the message queue.
+ * @retval STATUS_MESSAGE_INVALID_SIZE The size of the first message was too
+ *   big.
+ * @retval STATUS_TOO_MANY No message buffers were available.
+ * @retval STATUS_MESSAGE_QUEUE_WAIT_IN_ISR The caller is in an ISR, do not
+ *   block!
+ * @retval STATUS_TIMEOUT A timeout occurred.
+ */
+Status_Control _CORE_message_queue_Submit_multiple(
+  CORE_message_queue_Control     *the_message_queue,
+  Thread_Control                 *executing,
+  const void                     *buffer,
+  const size_t                   *sizes,
+  uint32_t                       *count_p,
+  CORE_message_queue_Submit_types submit_type,
+  bool                            wait,
+  Thread_queue_Context           *queue_context
+);
+
+/**
+ * @brief Seizes multiple messages from the message queue.
+ *
+ * The pending messages are copied in order to the destination buffer with
+ * one acquisition of the message queue lock.  If no message is pending, then
+ * this function behaves like _CORE_message_queue_Seize() and receives at
+ * most one message.
+ *
+ * @param[in, out] the_message_queue The message queue to seize the messages
+ *   from.
+ * @param executing The executing thread.
+ * @param[out] buffer The starting address of the destination buffer.  The
+ *   messages are stored consecutively without gaps.  The buffer size shall be
+ *   at least the maximum message size times the count of messages to seize.
+ * @param[out] sizes The array of message sizes.
+ * @param[out] priorities The array of message priorities, may be NULL.
+ * @param[in, out] count_p On input, the maximum count of messages to seize.
+ *   It shall be greater than zero.  On output, the count of messages which
+ *   were seized.
+ * @param wait Indicates whether the calling thread is willing to block if
+ *        the message queue is empty.
+ * @param queue_context The thread queue context used for
+ *   _CORE_message_queue_Acquire() or _CORE_message_queue_Acquire_critical().
+ *
+ * @retval STATUS_SUCCESSFUL At least one message was successfully seized from
+ *   the message queue.
+ * @retval STATUS_UNSATISFIED Wait was set to false and there is currently no
+ *   pending message.
+ * @retval STATUS_TIMEOUT A timeout occurred.
+ */
+Status_Control _CORE_message_queue_Seize_multiple(
+  CORE_message_queue_Control *the_message_queue,
+  Thread_Control             *executing,
+  void                       *buffer,
+  size_t                     *sizes,
+  int                        *priorities,
+  uint32_t                   *count_p,
+  bool                        wait,
+  Thread_queue_Context       *queue_context
+);
+
+/**
+ * @brief Submits a loaned buffer to the message queue.
+ *
+ * The buffer must have been obtained by _CORE_message_queue_Obtain_buffer()
+ * or _CORE_message_queue_Seize_buffer() from this message queue.  The content
+ * of the buffer is not copied, unless a thread waits to receive a copy of the
+ * message.  If a thread waits to receive a loaned buffer, then the buffer is
+ * handed over to this thread.  The caller gives up the loan in any case if
+ * the submit was successful.
+ *
+ * In contrast to _CORE_message_queue_Submit(), the caller will not block
+ * since the message needs no further message buffer.
+ *
+ * @param[in, out] the_message_queue The message queue to submit the buffer to.
+ * @param[in, out] buffer The loaned buffer containing the message.
+ * @param size The size of the message.
+ * @param submit_type Determines whether the message is prepended,
+ *        appended, or enqueued in priority order.
+ * @param queue_context The thread queue context used for
+ *   _CORE_message_queue_Acquire() or _CORE_message_queue_Acquire_critical().
+ *
+ * @retval STATUS_SUCCESSFUL The buffer was successfully submitted to the
+ *   message queue.
+ * @retval STATUS_MESSAGE_INVALID_SIZE The message size was too big.  The
+ *   buffer remains loaned to the caller.
+ */
+Status_Control _CORE_message_queue_Submit_buffer(
+  CORE_message_queue_Control     *the_message_queue,
+  void                           *buffer,
+  size_t                          size,
+  CORE_message_queue_Submit_types submit_type,
+  Thread_queue_Context           *queue_context
+);
+
+/**
+ * @brief Seizes a message from the message queue and loans its buffer.
+ *
+ * In contrast to _CORE_message_queue_Seize(), the message is not copied.  The
+ * caller obtains the buffer of the message and shall return it with
+ * _CORE_message_queue_Release_buffer() or
+ * _CORE_message_queue_Submit_buffer().
+ *
+ * @param[in, out] the_message_queue The message queue to seize a message from.
+ * @param executing The executing thread.
+ * @param[out] buffer_p The loaned buffer containing the message.
+ * @param[out] size_p The size of the message.
+ * @param wait Indicates whether the calling thread is willing to block
+ *        if the message queue is empty.
+ * @param queue_context The thread queue context used for
+ *   _CORE_message_queue_Acquire() or _CORE_message_queue_Acquire_critical().
+ *
+ * @retval STATUS_SUCCESSFUL The message was successfully seized from the
+ *   message queue.
+ * @retval STATUS_UNSATISFIED Wait was set to false and there is currently no
+ *   pending message.
+ * @retval STATUS_TIMEOUT A timeout occurred.
+ *
+ * @note Returns message priority via return area in TCB.
+ *
+ * @note A thread waiting to receive a loaned buffer obtains a message only if
+ *   the message queue has an inactive message buffer or the sender submits a
+ *   loaned buffer.
+ */
+Status_Control _CORE_message_queue_Seize_buffer(
+  CORE_message_queue_Control *the_message_queue,
+  Thread_Control             *executing,
+  void                      **buffer_p,
+  size_t                     *size_p,
+  bool                        wait,
+  Thread_queue_Context       *queue_context
+);
+
+/**
+ * @brief Gets the message buffer of a loaned buffer.
+ *
+ * @param the_message_queue The message queue of the buffer.
+ * @param buffer The loaned buffer.
+ *
+ * @retval pointer The message buffer of the loaned buffer.
+ * @retval NULL The buffer is not a buffer of the message queue or is not
+ *   loaned.
+ */
+CORE_message_queue_Buffer *_CORE_message_queue_Get_loaned_buffer(
+  const CORE_message_queue_Control *the_message_queue,
+  const void                       *buffer
+);
+
 /**
  * @brief Inserts a message into the message queue.
  *
@@ -355,6 +547,23 @@ void _CORE_message_queue_Insert_message(
   CORE_message_queue_Submit_types submit_type
 );
 
+/**
+ * @brief Inserts a message with its content into the message queue.
+ *
+ * In contrast to _CORE_message_queue_Insert_message(), the message content
+ * and size shall be already present in the message buffer.
+ *
+ * @param[in, out] the_message_queue The message queue to insert a message in.
+ * @param[in, out] the_message The message to insert in the message queue.
+ * @param submit_type Determines whether the message is prepended,
+ *        appended, or enqueued in priority order.
+ */
+void _CORE_message_queue_Insert_pending_message(
+  CORE_message_queue_Control     *the_message_queue,
+  CORE_message_queue_Buffer      *the_message,
+  CORE_message_queue_Submit_types submit_type
+);
+
 /**
  * @brief Sends a message to the message queue.
  *
@@ -532,6 +741,52 @@ static inline void _CORE_message_queue_Free_message_buffer(
   );
 }
 
+/**
+ * @brief Obtains an inactive message buffer as a loaned buffer.
+ *
+ * The buffer shall be returned with _CORE_message_queue_Submit_buffer() or
+ * _CORE_message_queue_Release_buffer().
+ *
+ * @param[in, out] the_message_queue The message queue to obtain a buffer from.
+ *
+ * @retval pointer The loaned buffer.  The buffer size is the maximum message
+ *   size of the message queue.
+ * @retval NULL No inactive message buffer was available.
+ */
+static inline void *_CORE_message_queue_Obtain_buffer(
+  CORE_message_queue_Control *the_message_queue
+)
+{
+  CORE_message_queue_Buffer *the_message;
+
+  the_message = _CORE_message_queue_Allocate_message_buffer(
+    the_message_queue
+  );
+
+  if ( the_message == NULL ) {
+    return NULL;
+  }
+
+  /* The off chain state marks the loaned buffers */
+  _Chain_Set_off_chain( &the_message->Node );
+  return the_message->buffer;
+}
+
+/**
+ * @brief Releases a loaned buffer to the inactive message buffer chain.
+ *
+ * @param[in, out] the_message_queue The message queue of the buffer.
+ * @param[in, out] the_message The message buffer of the loaned buffer
+ *   returned by _CORE_message_queue_Get_loaned_buffer().
+ */
+static inline void _CORE_message_queue_Release_buffer(
+  CORE_message_queue_Control *the_message_queue,
+  CORE_message_queue_Buffer  *the_message
+)
+{
+  _CORE_message_queue_Free_message_buffer( the_message_queue, the_message );
+}
+
 /**
  * @brief Gets message priority.
  *
@@ -572,9 +827,33 @@ _CORE_message_queue_Get_pending_message(
   CORE_message_queue_Control *the_message_queue
 )
 {
-  return (CORE_message_queue_Buffer *) _Chain_Get_unprotected(
+  CORE_message_queue_Buffer *the_message;
+
+  the_message = (CORE_message_queue_Buffer *) _Chain_Get_unprotected(
     &the_message_queue->Pending_messages
   );
+
+#if defined( RTEMS_SCORE_COREMSG_ENABLE_PRIORITY_INDEX )
+  if ( the_message != NULL ) {
+    int priority;
+
+    /*
+     * The message was the first pending message, so if it was the last
+     * message of its level, then it was the only one.
+     */
+    priority = _CORE_message_queue_Get_message_priority( the_message );
+
+    if (
+      priority <= 0
+        && priority > -CORE_MESSAGE_QUEUE_PRIORITY_LEVELS
+        && the_message_queue->priority_level_last[ -priority ] == the_message
+    ) {
+      the_message_queue->priority_level_map &= ~( UINT32_C( 1 ) << -priority );
+    }
+  }
+#endif
+
+  return the_message;
 }
 
 #if defined( RTEMS_SCORE_COREMSG_ENABLE_NOTIFICATION )
@@ -668,6 +947,18 @@ static inline Thread_Control *_CORE_message_queue_Dequeue_receiver(
     return NULL;
   }
 
+  /*
+   *  A thread waiting to receive a loaned buffer needs an inactive message
+   *  buffer to receive the copy of the message.
+   */
+  if ( _Chain_Is_empty( &the_message_queue->Inactive_messages ) ) {
+    the_thread = ( *the_message_queue->operations->first )( heads );
+
+    if ( the_thread->Wait.option == CORE_MESSAGE_QUEUE_RECEIVE_BUFFER ) {
+      return NULL;
+    }
+  }
+
   the_thread = ( *the_message_queue->operations->surrender )(
     &the_message_queue->Wait_queue.Queue,
     heads,
@@ -678,6 +969,11 @@ static inline Thread_Control *_CORE_message_queue_Dequeue_receiver(
   *(size_t *) the_thread->Wait.return_argument = size;
   the_thread->Wait.count = (uint32_t) submit_type;
 
+  if ( the_thread->Wait.option == CORE_MESSAGE_QUEUE_RECEIVE_BUFFER ) {
+    the_thread->Wait.return_argument_second.mutable_object =
+      _CORE_message_queue_Obtain_buffer( the_message_queue );
+  }
+
   _CORE_message_queue_Copy_buffer(
     buffer,
     the_thread->Wait.return_argument_second.mutable_object,
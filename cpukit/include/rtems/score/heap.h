@@ -58,8 +58,11 @@ extern "C" {
  * @brief This group contains the Heap Handler implementation.
  *
  * A heap is a doubly linked list of variable size blocks which are allocated
- * using the first fit method.  Garbage collection is performed each time a
- * block is returned to the heap by coalescing neighbor blocks.  Control
+ * using the first fit method.  Optionally, a heap may use a two-level
+ * segregated fit index of the free blocks to allocate with a bounded
+ * execution time, see @ref Heap_Segregated_fit.  Garbage collection is
+ * performed each time a block is returned to the heap by coalescing neighbor
+ * blocks.  Control
  * information for both allocated and free blocks is contained in the heap
  * area.  A heap control structure contains control information for the heap.
  *
@@ -155,6 +158,8 @@ typedef struct Heap_Control Heap_Control;
 
 typedef struct Heap_Block Heap_Block;
 
+typedef struct Heap_Segregated_fit Heap_Segregated_fit;
+
 /**
  * @brief The heap error reason.
  *
@@ -334,6 +339,65 @@ struct Heap_Block {
   Heap_Block *prev;
 };
 
+/**
+ * @brief The binary logarithm of the second level index count of the
+ * segregated fit free block index.
+ */
+#define HEAP_SEGREGATED_FIT_SECOND_LEVEL_LOG2 3
+
+/**
+ * @brief The second level index count of the segregated fit free block index.
+ *
+ * Each power of two size range is divided into this count of size classes.
+ */
+#define HEAP_SEGREGATED_FIT_SECOND_LEVEL_COUNT \
+  ( 1U << HEAP_SEGREGATED_FIT_SECOND_LEVEL_LOG2 )
+
+/**
+ * @brief The first level index count of the segregated fit free block index.
+ *
+ * Block sizes up to 2**32 - 1 bytes are distinguished.  Larger free blocks
+ * share the last size class.
+ */
+#define HEAP_SEGREGATED_FIT_FIRST_LEVEL_COUNT \
+  ( 32 - HEAP_SEGREGATED_FIT_SECOND_LEVEL_LOG2 + 1 )
+
+/**
+ * @brief Two-level segregated fit index of the free blocks.
+ *
+ * If a heap uses this index, then the free list of the heap is kept sorted by
+ * size class.  For each non-empty size class the index references the first
+ * free block of this size class in the free list.  A two-level bitmap
+ * indicates the non-empty size classes.  This allows to find a free block
+ * which satisfies an allocation request with a constant number of operations
+ * independent of the count of free blocks (good fit instead of first fit).
+ *
+ * Since the free list remains a valid doubly linked list of all free blocks,
+ * the operations iterating the free list work unchanged.
+ *
+ * @see _Heap_Set_segregated_fit().
+ */
+struct Heap_Segregated_fit {
+  /**
+   * @brief If bit @a fl is set, then the second level map at index @a fl is
+   * not zero.
+   */
+  uint32_t first_level_map;
+
+  /**
+   * @brief If bit @a sl is set in the second level map at index @a fl, then
+   * the size class ( @a fl, @a sl ) is not empty.
+   */
+  uint32_t second_level_map[ HEAP_SEGREGATED_FIT_FIRST_LEVEL_COUNT ];
+
+  /**
+   * @brief The first free block of each size class or NULL if the size class
+   * is empty.
+   */
+  Heap_Block *first[ HEAP_SEGREGATED_FIT_FIRST_LEVEL_COUNT ]
+                   [ HEAP_SEGREGATED_FIT_SECOND_LEVEL_COUNT ];
+};
+
 /**
  * @brief Control block used to manage a heap.
  */
@@ -346,6 +410,13 @@ struct Heap_Control {
   Heap_Block     *first_block;
   Heap_Block     *last_block;
   Heap_Statistics stats;
+
+  /**
+   * @brief The segregated fit index of the free blocks, or NULL if the heap
+   * uses the first fit allocation method.
+   */
+  Heap_Segregated_fit *segregated_fit;
+
   #ifdef HEAP_PROTECTION
   Heap_Protection Protection;
   #endif
@@ -431,6 +431,210 @@ static inline void _Heap_Set_last_block_size( Heap_Control *heap )
   );
 }
 
+/**
+ * @brief Returns true, if the heap uses a segregated fit index of the free
+ * blocks, otherwise false.
+ *
+ * @param heap The heap to check.
+ *
+ * @retval true The heap uses a segregated fit index.
+ * @retval false The heap uses the first fit method.
+ */
+static inline bool _Heap_Is_segregated_fit( const Heap_Control *heap )
+{
+  return heap->segregated_fit != NULL;
+}
+
+/**
+ * @brief Gets the segregated fit size class of the block size.
+ *
+ * Let @a m be the index of the most significant bit set in @a size.  The
+ * first level index is derived from @a m.  The second level index is given by
+ * the HEAP_SEGREGATED_FIT_SECOND_LEVEL_LOG2 bits following the most
+ * significant bit.  The size class order is consistent with the size order.
+ *
+ * @param size The block size.
+ * @param[out] fl The first level index.
+ * @param[out] sl The second level index.
+ */
+static inline void _Heap_Segregated_fit_mapping(
+  uintptr_t size,
+  uint32_t *fl,
+  uint32_t *sl
+)
+{
+  uint32_t msb;
+
+  if ( size < HEAP_SEGREGATED_FIT_SECOND_LEVEL_COUNT ) {
+    *fl = 0;
+    *sl = (uint32_t) size;
+    return;
+  }
+
+  msb = (uint32_t) ( sizeof( unsigned long ) * 8 - 1 ) -
+        (uint32_t) __builtin_clzl( (unsigned long) size );
+
+  if ( msb >= 32 ) {
+    *fl = HEAP_SEGREGATED_FIT_FIRST_LEVEL_COUNT - 1;
+    *sl = HEAP_SEGREGATED_FIT_SECOND_LEVEL_COUNT - 1;
+    return;
+  }
+
+  *fl = msb - HEAP_SEGREGATED_FIT_SECOND_LEVEL_LOG2 + 1;
+  *sl = (uint32_t) ( size >> ( msb - HEAP_SEGREGATED_FIT_SECOND_LEVEL_LOG2 ) ) -
+        HEAP_SEGREGATED_FIT_SECOND_LEVEL_COUNT;
+}
+
+/**
+ * @brief Inserts the free block into the segregated fit index of the heap.
+ *
+ * The block size shall be valid.
+ *
+ * @param[in, out] heap The heap using a segregated fit index.
+ * @param block The free block to insert.
+ */
+void _Heap_Segregated_fit_insert( Heap_Control *heap, Heap_Block *block );
+
+/**
+ * @brief Removes the free block from the segregated fit index of the heap.
+ *
+ * The block size shall be the size used to insert the block.
+ *
+ * @param[in, out] heap The heap using a segregated fit index.
+ * @param block The free block to remove.
+ */
+void _Heap_Segregated_fit_remove( Heap_Control *heap, Heap_Block *block );
+
+/**
+ * @brief Searches the segregated fit index for a start block of the free list
+ * search.
+ *
+ * The search returns the first free block of the smallest non-empty size
+ * class which guarantees that all its blocks have at least the specified
+ * size.  If no such size class exists, then the first free block of the size
+ * class containing the size is returned.  The free list is sorted by size
+ * class, so all blocks which may satisfy the request are reachable through the
+ * next links of the returned block.
+ *
+ * @param heap The heap using a segregated fit index.
+ * @param size The minimum block size.
+ *
+ * @return The start block of the free list search.  The free list tail is
+ *   returned, if no free block of a sufficient size class exists.
+ */
+Heap_Block *_Heap_Segregated_fit_search( Heap_Control *heap, uintptr_t size );
+
+/**
+ * @brief Returns the first free block to check for an allocation of the block
+ * size.
+ *
+ * @param heap The heap to operate upon.
+ * @param size The minimum block size.
+ *
+ * @return The first free block to check.
+ */
+static inline Heap_Block *_Heap_Free_block_search_start(
+  Heap_Control *heap,
+  uintptr_t     size
+)
+{
+  if ( _Heap_Is_segregated_fit( heap ) ) {
+    return _Heap_Segregated_fit_search( heap, size );
+  }
+
+  return _Heap_Free_list_first( heap );
+}
+
+/**
+ * @brief Inserts the free block into the free block set of the heap.
+ *
+ * The block size shall be valid.  In case the heap uses the first fit method,
+ * then the block is inserted after the anchor in the free list, otherwise it
+ * is inserted according to its size class and the anchor is ignored.
+ *
+ * @param[in, out] heap The heap to operate upon.
+ * @param anchor The block in the free list after which the block is inserted
+ *   for the first fit method.
+ * @param block The block to insert.
+ */
+static inline void _Heap_Free_block_insert(
+  Heap_Control *heap,
+  Heap_Block   *anchor,
+  Heap_Block   *block
+)
+{
+  if ( _Heap_Is_segregated_fit( heap ) ) {
+    _Heap_Segregated_fit_insert( heap, block );
+  } else {
+    _Heap_Free_list_insert_after( anchor, block );
+  }
+}
+
+/**
+ * @brief Removes the free block from the free block set of the heap.
+ *
+ * @param[in, out] heap The heap to operate upon.
+ * @param block The block to remove.
+ */
+static inline void _Heap_Free_block_remove(
+  Heap_Control *heap,
+  Heap_Block   *block
+)
+{
+  if ( _Heap_Is_segregated_fit( heap ) ) {
+    _Heap_Segregated_fit_remove( heap, block );
+  } else {
+    _Heap_Free_list_remove( block );
+  }
+}
+
+/**
+ * @brief Replaces one free block in the free block set of the heap by
+ * another.
+ *
+ * The size of the new block shall be valid.
+ *
+ * @param[in, out] heap The heap to operate upon.
+ * @param old_block The block in the free block set to replace.
+ * @param new_block The block that should replace @a old_block.
+ */
+static inline void _Heap_Free_block_replace(
+  Heap_Control *heap,
+  Heap_Block   *old_block,
+  Heap_Block   *new_block
+)
+{
+  if ( _Heap_Is_segregated_fit( heap ) ) {
+    _Heap_Segregated_fit_remove( heap, old_block );
+    _Heap_Segregated_fit_insert( heap, new_block );
+  } else {
+    _Heap_Free_list_replace( old_block, new_block );
+  }
+}
+
+/**
+ * @brief Sets the size of a free block which is already in the free block
+ * set of the heap.
+ *
+ * @param[in, out] heap The heap to operate upon.
+ * @param block The free block.
+ * @param size The new block size.
+ */
+static inline void _Heap_Free_block_set_size(
+  Heap_Control *heap,
+  Heap_Block   *block,
+  uintptr_t     size
+)
+{
+  if ( _Heap_Is_segregated_fit( heap ) ) {
+    _Heap_Segregated_fit_remove( heap, block );
+    block->size_and_flag = size | HEAP_PREV_BLOCK_USED;
+    _Heap_Segregated_fit_insert( heap, block );
+  } else {
+    block->size_and_flag = size | HEAP_PREV_BLOCK_USED;
+  }
+}
+
 #ifndef HEAP_PROTECTION
   #define _Heap_Protection_free_all_delayed_blocks( heap )    ( (void) 0 )
 #else
@@ -83,6 +83,28 @@ uintptr_t _Heap_Initialize(
   uintptr_t     page_size
 );
 
+/**
+ * @brief Sets the free block index of the heap.
+ *
+ * If @a segregated_fit is not NULL, then the heap uses the two-level
+ * segregated fit index provided by @a segregated_fit for the free blocks.  The
+ * allocation and free operations have a bounded execution time in this case.
+ * The index is built from the current free blocks of the heap, so this
+ * function may be called at any time after _Heap_Initialize().  The storage of
+ * the index shall be available as long as the heap uses it.
+ *
+ * If @a segregated_fit is NULL, then the heap uses the first fit method.
+ *
+ * The caller shall ensure that no other heap operation runs concurrently.
+ *
+ * @param[in, out] heap The heap control.
+ * @param[out] segregated_fit The segregated fit index or NULL.
+ */
+void _Heap_Set_segregated_fit(
+  Heap_Control        *heap,
+  Heap_Segregated_fit *segregated_fit
+);
+
 /**
  * @brief Allocates an aligned memory area with boundary constraint.
  *
@@ -179,6 +179,12 @@ typedef uint16_t Objects_Maximum;
  */
 #define OBJECTS_UNLIMITED_OBJECTS 0x80000000U
 
+/**
+ *  Mask to enable the object name index.  This is used in the configuration
+ *  table when specifying the number of configured objects.
+ */
+#define OBJECTS_NAME_INDEX 0x40000000U
+
 /**
  *  This is the lowest value for the index portion of an object Id.
  */
@@ -347,12 +353,24 @@ static inline Objects_Maximum _Objects_Get_index( Objects_Id id )
 #define _Objects_Is_unlimited( maximum ) \
   ( ( ( maximum ) & OBJECTS_UNLIMITED_OBJECTS ) != 0 )
 
+/**
+ * Returns if the object maximum specifies an object name index.
+ *
+ * @param[in] maximum The object maximum specification.
+ *
+ * @retval true The objects are indexed by name.
+ * @retval false The objects are not indexed by name.
+ */
+#define _Objects_Has_name_index( maximum ) \
+  ( ( ( maximum ) & OBJECTS_NAME_INDEX ) != 0 )
+
 /*
  * We cannot use an inline function for this since it may be evaluated at
  * compile time.
  */
 #define _Objects_Maximum_per_allocation( maximum ) \
-  ( (Objects_Maximum) ( ( maximum ) & ~OBJECTS_UNLIMITED_OBJECTS ) )
+  ( (Objects_Maximum) ( ( maximum ) &              \
+    ~( OBJECTS_UNLIMITED_OBJECTS | OBJECTS_NAME_INDEX ) ) )
 
 /**
  * @brief The local MPCI node number.
@@ -42,6 +42,7 @@
 
 #include <rtems/score/object.h>
 #include <rtems/score/chainimpl.h>
+#include <rtems/score/isrlock.h>
 #include <rtems/score/rbtree.h>
 
 #ifdef __cplusplus
@@ -184,6 +185,54 @@ typedef void ( *Objects_Thread_queue_Extract_callout )(
 );
 #endif
 
+/**
+ * @brief The object name index.
+ *
+ * The name index is a hash table with open addressing and linear probing.  It
+ * contains the local objects of an objects information which are active and
+ * have a name.  It is used by _Objects_Name_to_id_u32() and
+ * _Objects_Get_by_name() instead of a linear search through the local table.
+ *
+ * The index is maintained by the functions which open an object, set the name
+ * of an object, and remove an object from the namespace.  The lookups by name
+ * of object classes without a string name may be done concurrently by any
+ * thread and interrupt service routine, so the table is protected by an
+ * interrupt lock.
+ */
+typedef struct {
+#if ISR_LOCK_NEEDS_OBJECT
+  /**
+   * @brief This lock protects the table.
+   */
+  ISR_lock_Control Lock;
+#endif
+
+  /**
+   * @brief This is the table of objects.
+   *
+   * Unused table entries are NULL.
+   */
+  Objects_Control **table;
+
+  /**
+   * @brief This is the count of table entries.
+   *
+   * The count of table entries is greater than two times the object maximum
+   * of the objects information, so that the table has always unused entries.
+   * _Objects_Extend_information() enlarges the table on demand.
+   */
+  size_t size;
+
+  /**
+   * @brief This is the generation of the table.
+   *
+   * It is incremented by each change of the table.  The threads which close
+   * themselves may change the table without owning the object allocator lock,
+   * see _Objects_Name_index_extend().
+   */
+  unsigned int generation;
+} Objects_Name_index;
+
 typedef struct Objects_Information Objects_Information;
 
 /**
@@ -330,6 +379,16 @@ struct Objects_Information {
    */
   RBTree_Control Global_by_name;
 #endif
+
+  /**
+   * @brief This points to the object name index.
+   *
+   * This member is statically initialized and read-only.  In case the object
+   * name index is enabled for this API class through the OBJECTS_NAME_INDEX
+   * flag of the object maximum, it points to a statically allocated index
+   * defined by <rtems/confdefs.h>, otherwise this member is NULL.
+   */
+  Objects_Name_index *name_index;
 };
 
 /**
@@ -392,6 +451,49 @@ void _Objects_Free_unlimited(
   Objects_Control     *the_object
 );
 
+/**
+ * @brief Gets the initial count of object name index table entries for the
+ *   object maximum.
+ *
+ * @param max The configured object maximum (the OBJECTS_UNLIMITED_OBJECTS and
+ *   OBJECTS_NAME_INDEX flags may be set).
+ */
+#define _Objects_Name_index_size( max )                            \
+  ( _Objects_Has_name_index( max )                                 \
+      ? 2 * (size_t) _Objects_Maximum_per_allocation( max ) + 1   \
+      : 1 )
+
+/**
+ * @brief Statically defines the object name index of an objects information.
+ *
+ * The object name index is only used if the OBJECTS_NAME_INDEX flag of the
+ * object maximum is set, see OBJECTS_NAME_INDEX_REFERENCE().
+ *
+ * @param name The object class C designator namespace prefix, e.g. _Semaphore.
+ * @param max The configured object maximum (the OBJECTS_UNLIMITED_OBJECTS and
+ *   OBJECTS_NAME_INDEX flags may be set).
+ */
+#define OBJECTS_NAME_INDEX_DEFINE( name, max )                          \
+  static Objects_Control *name##_Name_table[ _Objects_Name_index_size( \
+    max                                                                 \
+  ) ];                                                                  \
+  static Objects_Name_index name##_Name_index = {                       \
+    .table = name##_Name_table,                                         \
+    .size = _Objects_Name_index_size( max )                             \
+  }
+
+/**
+ * @brief References the object name index defined by
+ *   OBJECTS_NAME_INDEX_DEFINE() if the OBJECTS_NAME_INDEX flag of the object
+ *   maximum is set, otherwise NULL.
+ *
+ * @param name The object class C designator namespace prefix, e.g. _Semaphore.
+ * @param max The configured object maximum (the OBJECTS_UNLIMITED_OBJECTS and
+ *   OBJECTS_NAME_INDEX flags may be set).
+ */
+#define OBJECTS_NAME_INDEX_REFERENCE( name, max ) \
+  ( _Objects_Has_name_index( max ) ? &name##_Name_index : NULL )
+
 #if defined( RTEMS_MULTIPROCESSING )
 #define OBJECTS_INFORMATION_MP( name, extract )             \
   , extract, RBTREE_INITIALIZER_EMPTY( name.Global_by_id ), \
@@ -438,8 +540,8 @@ void _Objects_Free_unlimited(
  * @param api The object API number, e.g. OBJECTS_CLASSIC_API.
  * @param cls The object class number, e.g. OBJECTS_RTEMS_SEMAPHORES.
  * @param type The object class type.
- * @param max The configured object maximum (the OBJECTS_UNLIMITED_OBJECTS flag
- *   may be set).
+ * @param max The configured object maximum (the OBJECTS_UNLIMITED_OBJECTS and
+ *   OBJECTS_NAME_INDEX flags may be set).
  * @param nl The object name string length, use OBJECTS_NO_STRING_NAME for
  *   objects without a string name.
  * @param ex The optional object extraction method.  Used only if
@@ -450,6 +552,7 @@ void _Objects_Free_unlimited(
     *name##_Local_table[ _Objects_Maximum_per_allocation( max ) ];            \
   static RTEMS_SECTION( ".noinit.rtems.content.objects." #name )              \
     type name##_Objects[ _Objects_Maximum_per_allocation( max ) ];            \
+  OBJECTS_NAME_INDEX_DEFINE( name, max );                                     \
                                                                               \
   Objects_Information name##_Information = {                                  \
     _Objects_Build_id( api, cls, 1, _Objects_Maximum_per_allocation( max ) ), \
@@ -469,7 +572,8 @@ void _Objects_Free_unlimited(
     &name##_Objects[ 0 ].Object OBJECTS_INFORMATION_MP(                       \
       name##_Information,                                                     \
       ex                                                                      \
-    )                                                                         \
+    ),                                                                        \
+    OBJECTS_NAME_INDEX_REFERENCE( name, max )                                 \
   }
 
 /** @} */
@@ -41,6 +41,7 @@
 #include <rtems/score/objectdata.h>
 #include <rtems/score/apimutex.h>
 #include <rtems/score/assert.h>
+#include <rtems/score/atomic.h>
 #include <rtems/score/isrlock.h>
 #include <rtems/score/status.h>
 #include <rtems/score/sysstate.h>
@@ -257,6 +258,96 @@ Objects_Control *_Objects_Get_by_name(
   Objects_Get_by_name_error *error
 );
 
+/**
+ * @brief Inserts the object into the name index of the object information.
+ *
+ * The object name index of the object information shall be enabled.  Objects
+ * without a name are not inserted.
+ *
+ * @param information is the object information.
+ * @param the_object is the active object to insert.
+ */
+void _Objects_Name_index_insert(
+  const Objects_Information *information,
+  Objects_Control           *the_object
+);
+
+/**
+ * @brief Removes the object from the name index of the object information.
+ *
+ * The object name index of the object information shall be enabled.  Objects
+ * which are not in the name index are ignored.
+ *
+ * @param information is the object information.
+ * @param the_object is the object to remove.
+ */
+void _Objects_Name_index_remove(
+  const Objects_Information *information,
+  Objects_Control           *the_object
+);
+
+/**
+ * @brief Searches the name index of the object information for an object
+ *   with the 32-bit integer name.
+ *
+ * The object name index of the object information shall be enabled.  This
+ * function may be called from within any runtime context.
+ *
+ * @param information is the object information.
+ * @param name is the name of the object to find.
+ * @param[out] id is the pointer to an object identifier variable.  The
+ *   identifier of the object with the lowest index and the name will be
+ *   stored in the referenced variable, if an object was found.
+ *
+ * @retval true An object with the name was found.
+ * @retval false No object with the name exists.
+ */
+bool _Objects_Name_index_find_u32(
+  const Objects_Information *information,
+  uint32_t                   name,
+  Objects_Id                *id
+);
+
+/**
+ * @brief Searches the name index of the object information for an object
+ *   with the string name.
+ *
+ * The object name index of the object information shall be enabled.  The
+ * caller shall own the object allocator lock.
+ *
+ * @param information is the object information.
+ * @param name is the name of the object to find.
+ * @param name_length is the length of the name.  It shall be less than or
+ *   equal to the maximum name length of the object information.
+ *
+ * @return Returns the object with the lowest index and the name, or NULL if
+ *   no object with the name exists.
+ */
+Objects_Control *_Objects_Name_index_find_string(
+  const Objects_Information *information,
+  const char                *name,
+  size_t                     name_length
+);
+
+/**
+ * @brief Enlarges the name index of the object information for the new
+ *   object maximum.
+ *
+ * The object name index of the object information shall be enabled.  This
+ * function is used by _Objects_Extend_information() before the object blocks
+ * of the object information are replaced.
+ *
+ * @param information is the object information.
+ * @param maximum is the new object maximum of the object information.
+ *
+ * @retval true The name index is large enough for the new object maximum.
+ * @retval false There was not enough memory to enlarge the name index.
+ */
+bool _Objects_Name_index_extend(
+  const Objects_Information *information,
+  Objects_Maximum            maximum
+);
+
 /**
  * @brief Returns the name associated with object id.
  *
@@ -463,9 +554,12 @@ static inline void _Objects_Namespace_remove_u32(
   Objects_Control           *the_object
 )
 {
-  (void) information;
-
   _Assert( !_Objects_Has_string_name( information ) );
+
+  if ( information->name_index != NULL ) {
+    _Objects_Name_index_remove( information, the_object );
+  }
+
   the_object->name.name_u32 = 0;
 }
 
@@ -672,9 +766,33 @@ static inline void _Objects_Set_local_object(
   _Assert( index >= OBJECTS_INDEX_MINIMUM );
   _Assert( index <= _Objects_Get_maximum_index( information ) );
 
+#if defined( RTEMS_SMP )
+  /*
+   * The object is published to the lock-free readers of _Objects_Get().  Make
+   * sure that they observe the initialized object.
+   */
+  _Atomic_Fence( ATOMIC_ORDER_RELEASE );
+#endif
+
   information->local_table[ index - OBJECTS_INDEX_MINIMUM ] = the_object;
 }
 
+/**
+ * @brief Waits until all lock-free readers of the object tables which may use
+ *   a previous state of the tables are done.
+ *
+ * _Objects_Get() reads the local table of an object information without a
+ * lock with interrupts disabled.  In SMP configurations, this function waits
+ * until each other online processor enabled interrupts at least once.  This
+ * ensures that no reader uses a replaced local table or a removed object
+ * block and that all readers observe the updated local table afterwards.  In
+ * uniprocessor configurations, this function is a compiler memory barrier.
+ *
+ * The caller shall own the object allocator lock.  Interrupts shall be
+ * enabled.
+ */
+void _Objects_Wait_for_readers( void );
+
 /**
  * @brief Invalidates an object Id.
  *
@@ -736,6 +854,10 @@ static inline Objects_Id _Objects_Open_u32(
     the_object
   );
 
+  if ( information->name_index != NULL ) {
+    _Objects_Name_index_insert( information, the_object );
+  }
+
   return the_object->id;
 }
 
@@ -766,6 +888,10 @@ static inline void _Objects_Open_string(
     _Objects_Get_index( the_object->id ),
     the_object
   );
+
+  if ( information->name_index != NULL ) {
+    _Objects_Name_index_insert( information, the_object );
+  }
 }
 
 /**
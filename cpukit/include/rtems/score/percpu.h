@@ -49,6 +49,7 @@
   #include <rtems/score/chain.h>
   #include <rtems/score/isrlock.h>
   #include <rtems/score/smp.h>
+  #include <rtems/score/smplockqueued.h>
   #include <rtems/score/timestamp.h>
   #include <rtems/score/watchdog.h>
 #endif
@@ -633,6 +634,14 @@ typedef struct Per_CPU_Control {
      * system initialization.
      */
   bool boot;
+
+  /**
+     * @brief The queue nodes used by this processor to wait for SMP queued
+     * locks.
+     *
+     * @see _SMP_queued_lock_Wait().
+     */
+  SMP_queued_lock_Processor Queued_lock;
   #endif
 
   struct Record_Control *record;
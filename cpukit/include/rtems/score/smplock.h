@@ -51,8 +51,11 @@
  *
  * The SMP lock provides mutual exclusion in SMP systems at the lowest level.
  *
- * The SMP lock is implemented as a ticket lock.  This provides fairness in
- * case of concurrent lock attempts.
+ * The SMP lock is implemented as a ticket lock by default.  This provides
+ * fairness in case of concurrent lock attempts.  If RTEMS_SMP_QUEUED_LOCK is
+ * defined, then the SMP lock is implemented as a queued lock.  Under
+ * contention, the waiters of a queued lock spin on processor-specific queue
+ * nodes and not on the shared lock word, see @ref SMP_queued_lock_Control.
  *
  * This SMP lock API uses a local context for acquire and release pairs.  Such
  * a context may be used to implement for example the Mellor-Crummey and Scott
@@ -63,6 +66,7 @@
 
 #if defined( RTEMS_SMP )
 
+#include <rtems/score/smplockqueued.h>
 #include <rtems/score/smplockstats.h>
 #include <rtems/score/smplockticket.h>
 #include <rtems/score/isrlevel.h>
@@ -84,7 +88,11 @@ extern "C" {
  * @brief SMP lock control.
  */
 typedef struct {
+#if defined( RTEMS_SMP_QUEUED_LOCK )
+  SMP_queued_lock_Control Queued_lock;
+#else
   SMP_ticket_lock_Control Ticket_lock;
+#endif
 #if defined( RTEMS_DEBUG )
   /**
    * @brief The index of the owning processor of this lock.
@@ -122,22 +130,28 @@ typedef struct {
 #define SMP_LOCK_NO_OWNER 0
 #endif
 
+#if defined( RTEMS_SMP_QUEUED_LOCK )
+#define SMP_LOCK_IMPLEMENTATION_INITIALIZER SMP_QUEUED_LOCK_INITIALIZER
+#else
+#define SMP_LOCK_IMPLEMENTATION_INITIALIZER SMP_TICKET_LOCK_INITIALIZER
+#endif
+
 /**
  * @brief SMP lock control initializer for static initialization.
  */
 #if defined( RTEMS_DEBUG ) && defined( RTEMS_PROFILING )
-  #define SMP_LOCK_INITIALIZER( name ) \
-  { SMP_TICKET_LOCK_INITIALIZER,       \
-    SMP_LOCK_NO_OWNER,                 \
+  #define SMP_LOCK_INITIALIZER( name )        \
+  { SMP_LOCK_IMPLEMENTATION_INITIALIZER,      \
+    SMP_LOCK_NO_OWNER,                        \
     SMP_LOCK_STATS_INITIALIZER( name ) }
 #elif defined( RTEMS_DEBUG )
   #define SMP_LOCK_INITIALIZER( name ) \
-  { SMP_TICKET_LOCK_INITIALIZER, SMP_LOCK_NO_OWNER }
+  { SMP_LOCK_IMPLEMENTATION_INITIALIZER, SMP_LOCK_NO_OWNER }
 #elif defined( RTEMS_PROFILING )
   #define SMP_LOCK_INITIALIZER( name ) \
-  { SMP_TICKET_LOCK_INITIALIZER, SMP_LOCK_STATS_INITIALIZER( name ) }
+  { SMP_LOCK_IMPLEMENTATION_INITIALIZER, SMP_LOCK_STATS_INITIALIZER( name ) }
 #else
-  #define SMP_LOCK_INITIALIZER( name ) { SMP_TICKET_LOCK_INITIALIZER }
+  #define SMP_LOCK_INITIALIZER( name ) { SMP_LOCK_IMPLEMENTATION_INITIALIZER }
 #endif
 
 /**
@@ -150,7 +164,11 @@ static inline void _SMP_lock_Initialize_inline(
   const char       *name
 )
 {
+#if defined( RTEMS_SMP_QUEUED_LOCK )
+  _SMP_queued_lock_Initialize( &lock->Queued_lock );
+#else
   _SMP_ticket_lock_Initialize( &lock->Ticket_lock );
+#endif
 #if defined( RTEMS_DEBUG )
   lock->owner = SMP_LOCK_NO_OWNER;
 #endif
@@ -184,7 +202,11 @@ void _SMP_lock_Initialize( SMP_lock_Control *lock, const char *name );
  */
 static inline void _SMP_lock_Destroy_inline( SMP_lock_Control *lock )
 {
+#if defined( RTEMS_SMP_QUEUED_LOCK )
+  _SMP_queued_lock_Destroy( &lock->Queued_lock );
+#else
   _SMP_ticket_lock_Destroy( &lock->Ticket_lock );
+#endif
   _SMP_lock_Stats_destroy( &lock->Stats );
 }
 
@@ -253,11 +275,19 @@ static inline void _SMP_lock_Acquire_inline(
 #else
   (void) context;
 #endif
+#if defined( RTEMS_SMP_QUEUED_LOCK )
+  _SMP_queued_lock_Acquire(
+    &lock->Queued_lock,
+    &lock->Stats,
+    &context->Stats_context
+  );
+#else
   _SMP_ticket_lock_Acquire(
     &lock->Ticket_lock,
     &lock->Stats,
     &context->Stats_context
   );
+#endif
 #if defined( RTEMS_DEBUG )
   lock->owner = _SMP_lock_Who_am_I();
 #endif
@@ -295,7 +325,11 @@ static inline void _SMP_lock_Release_inline(
 #else
   (void) context;
 #endif
+#if defined( RTEMS_SMP_QUEUED_LOCK )
+  _SMP_queued_lock_Release( &lock->Queued_lock, &context->Stats_context );
+#else
   _SMP_ticket_lock_Release( &lock->Ticket_lock, &context->Stats_context );
+#endif
 }
 
 /**
@@ -0,0 +1,338 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreSMPLock
+ *
+ * @brief This header file provides the interfaces of the
+ *   @ref RTEMSScoreSMPLock related to queued locks.
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTEMS_SCORE_SMPLOCKQUEUED_H
+#define _RTEMS_SCORE_SMPLOCKQUEUED_H
+
+#include <rtems/score/cpuopts.h>
+
+#if defined( RTEMS_SMP )
+
+#include <rtems/score/atomic.h>
+#include <rtems/score/smplockstats.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @addtogroup RTEMSScoreSMPLock
+ *
+ * @{
+ */
+
+/**
+ * @brief This flag indicates that the SMP queued lock is owned.
+ */
+#define SMP_QUEUED_LOCK_LOCKED 0x1U
+
+/**
+ * @brief This flag indicates that the SMP queued lock has exactly one waiter
+ *   which spins on the lock word.
+ */
+#define SMP_QUEUED_LOCK_PENDING 0x2U
+
+/**
+ * @brief This is the shift of the queue tail encoding in the lock word.
+ */
+#define SMP_QUEUED_LOCK_TAIL_SHIFT 2
+
+/**
+ * @brief This mask selects the queue tail encoding in the lock word.
+ */
+#define SMP_QUEUED_LOCK_TAIL_MASK ( ~0U << SMP_QUEUED_LOCK_TAIL_SHIFT )
+
+/**
+ * @brief This is the count of queue nodes available on each processor.
+ *
+ * A processor needs one queue node for each nested SMP queued lock acquire
+ * which waits on the queue.  Nesting happens through interrupts.
+ */
+#define SMP_QUEUED_LOCK_NODE_COUNT 4
+
+/**
+ * @brief SMP queued lock queue node.
+ *
+ * The queue nodes are provided by the processors, see
+ * Per_CPU_Control::Queued_lock.
+ */
+typedef struct {
+  /**
+   * @brief The address of the next node on the queue if it exists, otherwise
+   *   zero.
+   */
+  Atomic_Uintptr next;
+
+  /**
+   * @brief Indicates if a previous node exists on the queue.
+   *
+   * This field is initialized to a non-zero value.  The previous queue head
+   * will set it to zero if it passes the queue head position on.
+   */
+  Atomic_Uint locked;
+
+  /**
+   * @brief The count of queue heads which preceded this node.
+   *
+   * This value is reported as the initial queue length for the SMP lock
+   * statistics.
+   */
+  unsigned int queue_length;
+} SMP_queued_lock_Node;
+
+/**
+ * @brief SMP queued lock processor-specific state.
+ */
+typedef struct {
+  /**
+   * @brief The count of queue nodes currently used by this processor.
+   */
+  unsigned int nest_level;
+
+  /**
+   * @brief The queue nodes of this processor.
+   */
+  SMP_queued_lock_Node Nodes[ SMP_QUEUED_LOCK_NODE_COUNT ];
+} SMP_queued_lock_Processor;
+
+/**
+ * @brief SMP queued lock control.
+ *
+ * The lock state is kept in a single 32-bit word which contains the owner
+ * flag, the pending flag, and an encoding of the queue tail node.  If the
+ * lock is owned, then the first waiter spins on the lock word.  All further
+ * waiters enqueue a node of their processor in a Mellor-Crummey and Scott
+ * (MCS) queue and spin on their own node.  Only the queue head spins on the
+ * lock word.  This avoids the cache line transfers to all waiters on each
+ * lock release which happen with ticket locks.
+ */
+typedef struct {
+  /**
+   * @brief The lock word.
+   */
+  Atomic_Uint value;
+} SMP_queued_lock_Control;
+
+/**
+ * @brief SMP queued lock control initializer for static initialization.
+ */
+#define SMP_QUEUED_LOCK_INITIALIZER { ATOMIC_INITIALIZER_UINT( 0U ) }
+
+/**
+ * @brief Initializes the SMP queued lock.
+ *
+ * Concurrent initialization leads to unpredictable results.
+ *
+ * @param[out] lock The SMP queued lock control.
+ */
+static inline void _SMP_queued_lock_Initialize( SMP_queued_lock_Control *lock )
+{
+  _Atomic_Init_uint( &lock->value, 0U );
+}
+
+/**
+ * @brief Destroys the SMP queued lock.
+ *
+ * Concurrent destruction leads to unpredictable results.
+ *
+ * @param lock The SMP queued lock control.
+ */
+static inline void _SMP_queued_lock_Destroy( SMP_queued_lock_Control *lock )
+{
+  (void) lock;
+}
+
+/**
+ * @brief Waits for the SMP queued lock.
+ *
+ * This is the contended acquire path.
+ *
+ * @param[in, out] lock The lock to acquire.
+ * @param value The lock word value observed by the failed fast path.
+ *
+ * @return Returns the initial queue length of this acquire operation.
+ */
+unsigned int _SMP_queued_lock_Wait(
+  SMP_queued_lock_Control *lock,
+  unsigned int             value
+);
+
+/**
+ * @brief Tries to acquire the SMP queued lock.
+ *
+ * @param[in, out] lock The lock to acquire.
+ *
+ * @retval true The lock was acquired.
+ *
+ * @retval false The lock was not acquired.
+ */
+static inline bool _SMP_queued_lock_Try_acquire(
+  SMP_queued_lock_Control *lock
+)
+{
+  unsigned int expected;
+
+  expected = 0U;
+
+  return _Atomic_Compare_exchange_uint(
+    &lock->value,
+    &expected,
+    SMP_QUEUED_LOCK_LOCKED,
+    ATOMIC_ORDER_ACQUIRE,
+    ATOMIC_ORDER_RELAXED
+  );
+}
+
+/**
+ * @brief Acquires the SMP queued lock.
+ *
+ * @param[in, out] lock The lock to acquire.
+ * @param stats The SMP lock statistics.
+ * @param[out] stats_context The context for the statistics.
+ */
+static inline void _SMP_queued_lock_Do_acquire(
+  SMP_queued_lock_Control *lock
+#if defined( RTEMS_PROFILING )
+  ,
+  SMP_lock_Stats         *stats,
+  SMP_lock_Stats_context *stats_context
+#endif
+)
+{
+  unsigned int value;
+  unsigned int initial_queue_length;
+  bool         success;
+#if defined( RTEMS_PROFILING )
+  SMP_lock_Stats_acquire_context acquire_context;
+
+  _SMP_lock_Stats_acquire_begin( &acquire_context );
+#endif
+
+  value = 0U;
+  success = _Atomic_Compare_exchange_uint(
+    &lock->value,
+    &value,
+    SMP_QUEUED_LOCK_LOCKED,
+    ATOMIC_ORDER_ACQUIRE,
+    ATOMIC_ORDER_RELAXED
+  );
+
+  if ( RTEMS_PREDICT_TRUE( success ) ) {
+    initial_queue_length = 0;
+  } else {
+    initial_queue_length = _SMP_queued_lock_Wait( lock, value );
+  }
+
+#if defined( RTEMS_PROFILING )
+  _SMP_lock_Stats_acquire_end(
+    &acquire_context,
+    stats,
+    stats_context,
+    initial_queue_length
+  );
+#else
+  (void) initial_queue_length;
+#endif
+}
+
+/**
+ * @brief Acquires an SMP queued lock.
+ *
+ * This function will not disable interrupts.  The caller must ensure that the
+ * current thread of execution is not interrupted indefinite once it obtained
+ * the SMP queued lock.  Thread dispatching shall be disabled, since the
+ * contended acquire path uses queue nodes of the current processor.
+ *
+ * @param[in] lock The SMP queued lock control.
+ * @param[in] stats The SMP lock statistics.
+ * @param[out] stats_context The SMP lock statistics context.
+ */
+#if defined( RTEMS_PROFILING )
+  #define _SMP_queued_lock_Acquire( lock, stats, stats_context ) \
+  _SMP_queued_lock_Do_acquire( lock, stats, stats_context )
+#else
+  #define _SMP_queued_lock_Acquire( lock, stats, stats_context ) \
+  _SMP_queued_lock_Do_acquire( lock )
+#endif
+
+/**
+ * @brief Releases the SMP queued lock.
+ *
+ * @param[in, out] lock The SMP queued lock to release.
+ * @param[out] stats_context The SMP lock statistics context.
+ */
+static inline void _SMP_queued_lock_Do_release(
+  SMP_queued_lock_Control *lock
+#if defined( RTEMS_PROFILING )
+  ,
+  const SMP_lock_Stats_context *stats_context
+#endif
+)
+{
+#if defined( RTEMS_PROFILING )
+  _SMP_lock_Stats_release_update( stats_context );
+#endif
+
+  (void) _Atomic_Fetch_sub_uint(
+    &lock->value,
+    SMP_QUEUED_LOCK_LOCKED,
+    ATOMIC_ORDER_RELEASE
+  );
+}
+
+/**
+ * @brief Releases an SMP queued lock.
+ *
+ * @param[in] lock The SMP queued lock control.
+ * @param[in] stats_context The SMP lock statistics context.
+ */
+#if defined( RTEMS_PROFILING )
+  #define _SMP_queued_lock_Release( lock, stats_context ) \
+  _SMP_queued_lock_Do_release( lock, stats_context )
+#else
+  #define _SMP_queued_lock_Release( lock, stats_context ) \
+  _SMP_queued_lock_Do_release( lock )
+#endif
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* RTEMS_SMP */
+
+#endif /* _RTEMS_SCORE_SMPLOCKQUEUED_H */
@@ -1198,6 +1198,7 @@ Objects_Control *_Thread_Allocate_unlimited(
   static RTEMS_SECTION( ".noinit.rtems.content.objects." #name )             \
     Thread_queue_Configured_heads                                            \
                      name##_Heads[ _Objects_Maximum_per_allocation( max ) ]; \
+  OBJECTS_NAME_INDEX_DEFINE( name, max );                                    \
   Thread_Information name##_Information = {                                  \
     { _Objects_Build_id(                                                     \
         api,                                                                 \
@@ -1219,7 +1220,8 @@ Objects_Control *_Thread_Allocate_unlimited(
       NULL,                                                                  \
       NULL,                                                                  \
       &name##_Objects[ 0 ].Control.Object                                    \
-         OBJECTS_INFORMATION_MP( name##_Information.Objects, NULL ) },       \
+         OBJECTS_INFORMATION_MP( name##_Information.Objects, NULL ),         \
+      OBJECTS_NAME_INDEX_REFERENCE( name, max ) },                           \
     { &name##_Heads[ 0 ] }                                                   \
   }
 
@@ -85,6 +85,55 @@ typedef Watchdog_Service_routine ( *Watchdog_Service_routine_entry )(
   Watchdog_Control *
 );
 
+/**
+ * @brief This constant defines the count of index bits of a timer wheel level.
+ */
+#define WATCHDOG_WHEEL_BITS 6
+
+/**
+ * @brief This constant defines the count of slots of a timer wheel level.
+ */
+#define WATCHDOG_WHEEL_SLOTS ( 1U << WATCHDOG_WHEEL_BITS )
+
+/**
+ * @brief This constant defines the count of timer wheel levels.
+ */
+#define WATCHDOG_WHEEL_LEVELS 4
+
+/**
+ * @brief The hierarchical timer wheel to manage scheduled watchdogs with an
+ *   expiration time in clock ticks.
+ *
+ * A watchdog is placed on the lowest level which covers its expiration time
+ * relative to the current time of the wheel.  Watchdogs of higher levels are
+ * moved to lower levels when the current time reaches their slot.  Watchdogs
+ * which expire beyond the range of the highest level are kept on the overflow
+ * chain.
+ */
+typedef struct Watchdog_Wheel {
+  /**
+   * @brief This member contains the last clock tick processed by the wheel.
+   */
+  uint64_t time;
+
+  /**
+   * @brief This member contains the count of watchdogs scheduled on the
+   *   wheel.
+   */
+  size_t count;
+
+  /**
+   * @brief This member contains the slots of the wheel levels.
+   */
+  Chain_Control Slots[ WATCHDOG_WHEEL_LEVELS ][ WATCHDOG_WHEEL_SLOTS ];
+
+  /**
+   * @brief This member contains the watchdogs which expire beyond the range
+   *   of the highest level.
+   */
+  Chain_Control Overflow;
+} Watchdog_Wheel;
+
 /**
  * @brief The watchdog header to manage scheduled watchdogs.
  */
@@ -99,6 +148,12 @@ typedef struct {
    * case no watchdog is scheduled.
    */
   RBTree_Node *first;
+
+  /**
+   * @brief The timer wheel used to manage the scheduled watchdogs or NULL in
+   * case the red-black tree is used.
+   */
+  Watchdog_Wheel *wheel;
 } Watchdog_Header;
 
 /**
@@ -120,7 +175,8 @@ struct Watchdog_Control {
 
     /**
      * @brief this field is a chain node structure and allows this to be placed
-     * on a chain used to manage pending watchdogs by the timer server.
+     * on a chain used to manage pending watchdogs by the timer server or on a
+     * slot of a timer wheel.
      */
     Chain_Node Chain;
   } Node;
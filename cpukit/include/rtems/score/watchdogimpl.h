@@ -112,6 +112,7 @@ static inline void _Watchdog_Header_initialize( Watchdog_Header *header )
 {
   _RBTree_Initialize_empty( &header->Watchdogs );
   header->first = NULL;
+  header->wheel = NULL;
 }
 
 /**
@@ -128,6 +129,23 @@ static inline Watchdog_Control *_Watchdog_Header_first(
   return (Watchdog_Control *) header->first;
 }
 
+/**
+ * @brief Checks if no watchdog is scheduled in the watchdog header.
+ *
+ * @param header The watchdog header to check.
+ *
+ * @retval true No watchdog is scheduled in @a header.
+ * @retval false Otherwise.
+ */
+static inline bool _Watchdog_Header_is_empty( const Watchdog_Header *header )
+{
+  if ( header->wheel != NULL ) {
+    return header->wheel->count == 0;
+  }
+
+  return header->first == NULL;
+}
+
 /**
  * @brief Destroys the watchdog header.
  *
@@ -146,6 +164,39 @@ static inline void _Watchdog_Header_destroy( Watchdog_Header *header )
  */
 void _Watchdog_Tick( struct Per_CPU_Control *cpu );
 
+/**
+ * @brief Performs the specified count of watchdog ticks at once.
+ *
+ * This function may be used by clock drivers which suppress clock ticks while
+ * the processor is idle to account for the ticks which elapsed in the
+ * meantime, see _Watchdog_Ticks_to_next_expiration().
+ *
+ * @param cpu The processor for this watchdog tick.
+ *
+ * @param count The count of ticks to perform.  It shall be greater than zero.
+ */
+void _Watchdog_Tick_multiple( struct Per_CPU_Control *cpu, uint32_t count );
+
+/**
+ * @brief Gets the count of clock ticks until the next scheduled watchdog of
+ *   the processor may expire.
+ *
+ * The returned count may be less than the count of ticks until the actual
+ * expiration, but never greater.
+ *
+ * @param cpu The processor to check.
+ *
+ * @param maximum The maximum count of ticks to return.  It shall be greater
+ *   than zero.
+ *
+ * @return Returns the count of clock ticks, at least one and at most
+ *   @a maximum.
+ */
+uint32_t _Watchdog_Ticks_to_next_expiration(
+  struct Per_CPU_Control *cpu,
+  uint32_t                maximum
+);
+
 /**
  * @brief Gets the state of the watchdog.
  *
@@ -280,6 +331,89 @@ void _Watchdog_Do_tickle(
   _Watchdog_Do_tickle( header, first, now, lock_context )
 #endif
 
+/**
+ * @brief This constant defines the mask to get the slot index of a timer
+ *   wheel level.
+ */
+#define WATCHDOG_WHEEL_MASK ( (uint64_t) WATCHDOG_WHEEL_SLOTS - 1 )
+
+/**
+ * @brief The timer wheels of the processors.
+ *
+ * This array is provided by the application configuration in case
+ * CONFIGURE_WATCHDOG_TIMER_WHEEL is defined.
+ */
+extern Watchdog_Wheel _Watchdog_Wheels[];
+
+/**
+ * @brief Attaches the timer wheels to the clock tick watchdog headers of the
+ *   processors.
+ *
+ * This function is called during system initialization in case
+ * CONFIGURE_WATCHDOG_TIMER_WHEEL is defined.
+ */
+void _Watchdog_Wheel_initialize( void );
+
+/**
+ * @brief Inserts a watchdog into the timer wheel.
+ *
+ * The watchdog must be inactive.
+ *
+ * @param[in, out] wheel is the timer wheel.
+ *
+ * @param[in, out] the_watchdog is the watchdog to insert.
+ *
+ * @param expire is the expiration time for the watchdog.
+ */
+void _Watchdog_Wheel_insert(
+  Watchdog_Wheel   *wheel,
+  Watchdog_Control *the_watchdog,
+  uint64_t          expire
+);
+
+/**
+ * @brief Removes the watchdog from the timer wheel in case it is scheduled.
+ *
+ * @param[in, out] wheel is the timer wheel.
+ *
+ * @param[in, out] the_watchdog is the watchdog to remove.
+ */
+void _Watchdog_Wheel_remove(
+  Watchdog_Wheel   *wheel,
+  Watchdog_Control *the_watchdog
+);
+
+/**
+ * @brief Advances the timer wheel to the current time and calls the routine
+ *   of each expired watchdog.
+ *
+ * @param[in, out] wheel is the timer wheel.
+ *
+ * @param now is the current time in clock ticks.
+ *
+ * @param lock is the lock released before calling the routine and acquired
+ *   after the call.
+ *
+ * @param lock_context is the lock context for the release before calling the
+ *   routine and for the acquire after.
+ */
+void _Watchdog_Wheel_do_tick(
+  Watchdog_Wheel   *wheel,
+  uint64_t          now,
+#if defined( RTEMS_SMP )
+  ISR_lock_Control *lock,
+#endif
+  ISR_lock_Context *lock_context
+);
+
+#if defined( RTEMS_SMP )
+  #define _Watchdog_Wheel_tick( wheel, now, lock, lock_context ) \
+  _Watchdog_Wheel_do_tick( wheel, now, lock, lock_context )
+#else
+  #define _Watchdog_Wheel_tick( wheel, now, lock, lock_context ) \
+  _Watchdog_Wheel_do_tick( wheel, now, lock_context )
+#endif
+
 /**
  * @brief Inserts a watchdog into the set of scheduled watchdogs according to
  * the specified expiration time.
@@ -7,7 +7,8 @@
  *
  * @brief This header file provides data structures used by the implementation
  *   and the @ref RTEMSImplApplConfig to define ::_Workspace_Size,
- *   ::_Workspace_Is_unified, and ::_Workspace_Malloc_initializer.
+ *   ::_Workspace_Is_unified, ::_Workspace_Segregated_fit, and
+ *   ::_Workspace_Malloc_initializer.
  */
 
 /*
@@ -46,6 +47,8 @@ extern "C" {
 
 struct Heap_Control;
 
+struct Heap_Segregated_fit;
+
 /**
  * @defgroup RTEMSScoreWorkspace Workspace Handler
  *
@@ -76,6 +79,18 @@ extern const uintptr_t _Workspace_Size;
  */
 extern const bool _Workspace_Is_unified;
 
+/**
+ * @brief The segregated fit index of the RTEMS Workspace or NULL.
+ *
+ * If this pointer is not NULL, then the RTEMS Workspace uses the two-level
+ * segregated fit allocation method, otherwise it uses the first fit method.
+ *
+ * This constant is defined by the application configuration option
+ * #CONFIGURE_WORKSPACE_SEGREGATED_FIT via <rtems/confdefs.h> or a default
+ * configuration.
+ */
+extern struct Heap_Segregated_fit *const _Workspace_Segregated_fit;
+
 /**
  * @brief Initializes the C Program Heap separated from the RTEMS Workspace.
  *
@@ -120,6 +120,7 @@ static inline void _Workspace_Initialize_for_multiple_areas( void )
   }
 
   _Heap_Protection_set_delayed_free_fraction( &_Workspace_Area, 1 );
+  _Heap_Set_segregated_fit( &_Workspace_Area, _Workspace_Segregated_fit );
 }
 
 #ifdef __cplusplus
@@ -110,6 +110,7 @@ static inline void _Workspace_Initialize_for_one_area( void )
   }
 
   _Heap_Protection_set_delayed_free_fraction( &_Workspace_Area, 1 );
+  _Heap_Set_segregated_fit( &_Workspace_Area, _Workspace_Segregated_fit );
 }
 
 #ifdef __cplusplus
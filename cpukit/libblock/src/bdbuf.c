@@ -84,6 +84,87 @@ typedef struct rtems_bdbuf_waiters {
   rtems_condition_variable cond_var;
 } rtems_bdbuf_waiters;
 
+/**
+ * A slot of the hash index. The key is stored in the slot, so that probing
+ * colliding slots touches only consecutive slots and not the buffer
+ * descriptors. A slot is empty if the buffer descriptor is NULL.
+ */
+typedef struct rtems_bdbuf_hash_slot {
+  const rtems_disk_device *dd;
+  rtems_blkdev_bnum        block;
+  rtems_bdbuf_buffer      *bd;
+} rtems_bdbuf_hash_slot;
+
+/**
+ * The statistics of an access to a buffer. They are gathered under the shard
+ * lock and added to the device statistics under the cache lock.
+ */
+typedef struct rtems_bdbuf_access_stats {
+  uint32_t lookups;            /**< The count of lookups. */
+  uint32_t probes;             /**< The count of visited tree nodes or index
+                                 * slots. */
+  uint32_t recent_hits;        /**< The count of hits in the recent queue. */
+  uint32_t frequent_hits;      /**< The count of hits in the frequent
+                                 * queue. */
+  uint32_t recent_evictions;   /**< The count of buffers recycled from the
+                                 * recent queue. */
+  uint32_t frequent_evictions; /**< The count of buffers recycled from the
+                                 * frequent queue. */
+} rtems_bdbuf_access_stats;
+
+/**
+ * The replacement policy queues. Buffers in the free or cached state are on
+ * the queue of the buffer.
+ */
+typedef enum {
+  RTEMS_BDBUF_QUEUE_RECENT,
+  RTEMS_BDBUF_QUEUE_FREQUENT
+} rtems_bdbuf_queue;
+
+/**
+ * A shard of the BD buffer cache. The groups of the cache are distributed
+ * round-robin to the shards. Each shard manages the buffers of its groups with
+ * its own lock, lookup tree, lists and waiters. A buffer is looked up in the
+ * shard selected by rtems_bdbuf_get_shard().
+ */
+typedef struct rtems_bdbuf_shard {
+  rtems_mutex *lock;            /**< The shard lock. It is the cache lock if
+                                          * the cache has only one shard. */
+  rtems_mutex  shard_lock;      /**< The lock storage of this shard. */
+
+  rtems_bdbuf_buffer *tree;     /**< Buffer descriptor lookup AVL tree
+                                          * root of this shard. */
+  rtems_bdbuf_hash_slot *hash_slots; /**< Buffer descriptor lookup hash
+                                          * index of this shard. */
+  uint32_t            hash_mask; /**< The hash index slot count minus
+                                          * one. */
+  rtems_chain_control lru;      /**< Least recently used list. It is the
+                                          * recent queue of the 2Q
+                                          * replacement policy. */
+  rtems_chain_control frequent; /**< Frequent queue of the 2Q replacement
+                                          * policy. */
+  uint32_t            recent_count; /**< The count of buffers on the recent
+                                          * queue. */
+  uint32_t            recent_limit; /**< The recent queue size above which
+                                          * buffers are recycled from the
+                                          * recent queue first. */
+  uint32_t           *ghosts;   /**< Ghost filter of the 2Q replacement
+                                          * policy. */
+  uint32_t            ghost_mask; /**< The ghost filter slot count minus
+                                          * one. */
+  rtems_chain_control modified; /**< Modified buffers list */
+  rtems_chain_control sync;     /**< Buffers to sync list */
+
+  rtems_bdbuf_waiters access_waiters;   /**< Wait for a buffer in
+                                          * ACCESS_CACHED, ACCESS_MODIFIED or
+                                          * ACCESS_EMPTY
+                                          * state. */
+  rtems_bdbuf_waiters transfer_waiters; /**< Wait for a buffer in TRANSFER
+                                          * state. */
+  rtems_bdbuf_waiters buffer_waiters;   /**< Wait for a buffer and no one is
+                                          * available. */
+} rtems_bdbuf_shard;
+
 /**
  * The BD buffer cache.
  */
@@ -105,8 +186,11 @@ typedef struct rtems_bdbuf_cache {
                                           * buffer size that fit in a group. */
   uint32_t            flags;             /**< Configuration flags. */
 
-  rtems_mutex        lock;           /**< The cache lock. It locks all
-                                          * cache data, BD and lists. */
+  rtems_mutex        lock;           /**< The cache lock. It locks the
+                                          * swapout, sync and read-ahead state
+                                          * and the device statistics. With a
+                                          * single shard it locks all cache
+                                          * data, BD and lists. */
   rtems_mutex        sync_lock;      /**< Sync calls block writes. */
   bool               sync_active;    /**< True if a sync is active. */
   rtems_id           sync_requester; /**< The sync requester. */
@@ -114,20 +198,8 @@ typedef struct rtems_bdbuf_cache {
                                           * BDBUF_INVALID_DEV not a device
                                           * sync. */
 
-  rtems_bdbuf_buffer *tree;     /**< Buffer descriptor lookup AVL tree
-                                          * root. There is only one. */
-  rtems_chain_control lru;      /**< Least recently used list */
-  rtems_chain_control modified; /**< Modified buffers list */
-  rtems_chain_control sync;     /**< Buffers to sync list */
-
-  rtems_bdbuf_waiters access_waiters;   /**< Wait for a buffer in
-                                          * ACCESS_CACHED, ACCESS_MODIFIED or
-                                          * ACCESS_EMPTY
-                                          * state. */
-  rtems_bdbuf_waiters transfer_waiters; /**< Wait for a buffer in TRANSFER
-                                          * state. */
-  rtems_bdbuf_waiters buffer_waiters;   /**< Wait for a buffer and no one is
-                                          * available. */
+  rtems_bdbuf_shard *shards;      /**< The cache shards. */
+  uint32_t           shard_count; /**< The number of shards. */
 
   rtems_bdbuf_swapout_transfer *swapout_transfer;
   rtems_bdbuf_swapout_worker   *swapout_workers;
@@ -184,12 +256,6 @@ static rtems_task rtems_bdbuf_read_ahead_task( rtems_task_argument arg );
 static rtems_bdbuf_cache bdbuf_cache = {
   .lock = RTEMS_MUTEX_INITIALIZER( NULL ),
   .sync_lock = RTEMS_MUTEX_INITIALIZER( NULL ),
-  .access_waiters =
-    { .cond_var = RTEMS_CONDITION_VARIABLE_INITIALIZER( NULL ) },
-  .transfer_waiters =
-    { .cond_var = RTEMS_CONDITION_VARIABLE_INITIALIZER( NULL ) },
-  .buffer_waiters =
-    { .cond_var = RTEMS_CONDITION_VARIABLE_INITIALIZER( NULL ) },
   .once = PTHREAD_ONCE_INIT
 };
 
@@ -222,23 +288,26 @@ uint32_t rtems_bdbuf_list_count( rtems_chain_control *list )
 void rtems_bdbuf_show_usage( void )
 {
   uint32_t group;
+  uint32_t shard;
   uint32_t total = 0;
-  uint32_t val;
+  uint32_t lru = 0;
+  uint32_t modified = 0;
+  uint32_t sync = 0;
 
   for ( group = 0; group < bdbuf_cache.group_count; group++ ) {
     total += bdbuf_cache.groups[ group ].users;
   }
+  for ( shard = 0; shard < bdbuf_cache.shard_count; shard++ ) {
+    lru += rtems_bdbuf_list_count( &bdbuf_cache.shards[ shard ].lru );
+    lru += rtems_bdbuf_list_count( &bdbuf_cache.shards[ shard ].frequent );
+    modified += rtems_bdbuf_list_count( &bdbuf_cache.shards[ shard ].modified );
+    sync += rtems_bdbuf_list_count( &bdbuf_cache.shards[ shard ].sync );
+  }
   printf( "bdbuf:group users=%lu", total );
-  val = rtems_bdbuf_list_count( &bdbuf_cache.lru );
-  printf( ", lru=%lu", val );
-  total = val;
-  val = rtems_bdbuf_list_count( &bdbuf_cache.modified );
-  printf( ", mod=%lu", val );
-  total += val;
-  val = rtems_bdbuf_list_count( &bdbuf_cache.sync );
-  printf( ", sync=%lu", val );
-  total += val;
-  printf( ", total=%lu\n", total );
+  printf( ", lru=%lu", lru );
+  printf( ", mod=%lu", modified );
+  printf( ", sync=%lu", sync );
+  printf( ", total=%lu\n", lru + modified + sync );
 }
 
 /**
@@ -278,6 +347,56 @@ void rtems_bdbuf_show_users( const char *where, rtems_bdbuf_buffer *bd )
 #define RTEMS_BDBUF_AVL_MAX_HEIGHT ( 32 )
 #endif
 
+/**
+ * The shard of a block is selected by the disk device and the block number
+ * shifted right by this value.  All blocks of such an extent belong to the same
+ * shard, so that multi-block read requests stay within one shard.
+ */
+#ifndef RTEMS_BDBUF_SHARD_EXTENT_SHIFT
+#define RTEMS_BDBUF_SHARD_EXTENT_SHIFT 5
+#endif
+
+/**
+ * The 2Q replacement policy recycles buffers from the recent queue first if it
+ * holds more than the buffers of a shard divided by this value.
+ */
+#ifndef RTEMS_BDBUF_RECENT_QUEUE_DIVISOR
+#define RTEMS_BDBUF_RECENT_QUEUE_DIVISOR 4
+#endif
+
+/**
+ * The initial read-ahead window in blocks of a sequential read stream detected
+ * by the adaptive read-ahead.  The window doubles each time the stream reaches
+ * its trigger block up to the configured maximum read-ahead blocks.
+ */
+#ifndef RTEMS_BDBUF_READ_AHEAD_WINDOW_INITIAL
+#define RTEMS_BDBUF_READ_AHEAD_WINDOW_INITIAL 2
+#endif
+
+/**
+ * Sequential read stream of the adaptive read-ahead. The streams of a device
+ * are protected by the cache lock.
+ */
+struct rtems_blkdev_read_ahead_stream {
+  rtems_blkdev_bnum last;       /**< The last block read by the stream. */
+  rtems_blkdev_bnum trigger;    /**< Block value to trigger the next
+                                 * read-ahead request of the stream. */
+  rtems_blkdev_bnum next;       /**< Start block for the next read-ahead
+                                 * request of the stream. */
+  uint32_t          nr_blocks;  /**< Size of the pending read-ahead request
+                                 * in blocks, zero if no request is
+                                 * pending. */
+  uint32_t          window;     /**< Current read-ahead window of the stream
+                                 * in blocks, zero for an unused stream. */
+  uint32_t          age;        /**< Time stamp of the last use. */
+  uint32_t          generation; /**< Incremented each time the stream is
+                                 * reused for another sequence. */
+  bool              peek;       /**< The pending request was issued by a
+                                 * peek. */
+  bool              issued;     /**< The stream issued a read-ahead
+                                 * request. */
+};
+
 static void rtems_bdbuf_fatal( rtems_fatal_code error )
 {
   rtems_fatal( RTEMS_FATAL_SOURCE_BDBUF, error );
@@ -297,18 +416,22 @@ static void rtems_bdbuf_fatal_with_state(
  * @param root pointer to the root node of the AVL-Tree
  * @param dd disk device search key
  * @param block block search key
+ * @param[in, out] probes the count of visited nodes is added to this value
  * @retval NULL node with the specified dd/block is not found
  * @return pointer to the node with specified dd/block
  */
 static rtems_bdbuf_buffer *rtems_bdbuf_avl_search(
   rtems_bdbuf_buffer     **root,
   const rtems_disk_device *dd,
-  rtems_blkdev_bnum        block
+  rtems_blkdev_bnum        block,
+  uint32_t                *probes
 )
 {
   rtems_bdbuf_buffer *p = *root;
 
   while ( ( p != NULL ) && ( ( p->dd != dd ) || ( p->block != block ) ) ) {
+    ++*probes;
+
     if (
       ( (uintptr_t) p->dd < (uintptr_t) dd ) ||
       ( ( p->dd == dd ) && ( p->block < block ) )
@@ -319,6 +442,10 @@ static rtems_bdbuf_buffer *rtems_bdbuf_avl_search(
     }
   }
 
+  if ( p != NULL ) {
+    ++*probes;
+  }
+
   return p;
 }
 
@@ -745,6 +872,181 @@ static int rtems_bdbuf_avl_remove(
   return 0;
 }
 
+static bool rtems_bdbuf_has_hash_index( void )
+{
+  return bdbuf_config.lookup_engine == RTEMS_BDBUF_LOOKUP_HASH_INDEX;
+}
+
+static uint32_t rtems_bdbuf_hash_home(
+  const rtems_bdbuf_shard *shard,
+  const rtems_disk_device *dd,
+  rtems_blkdev_bnum        block
+)
+{
+  uint32_t h;
+
+  h = block * 0x9e3779b1U;
+  h ^= (uint32_t) ( (uintptr_t) dd >> 4 ) * 0x85ebca6bU;
+  h ^= h >> 16;
+
+  return h & shard->hash_mask;
+}
+
+static rtems_bdbuf_buffer *rtems_bdbuf_hash_search(
+  const rtems_bdbuf_shard *shard,
+  const rtems_disk_device *dd,
+  rtems_blkdev_bnum        block,
+  uint32_t                *probes
+)
+{
+  uint32_t i = rtems_bdbuf_hash_home( shard, dd, block );
+
+  while ( true ) {
+    const rtems_bdbuf_hash_slot *slot = &shard->hash_slots[ i ];
+
+    ++*probes;
+
+    if ( slot->bd == NULL ) {
+      return NULL;
+    }
+
+    if ( slot->dd == dd && slot->block == block ) {
+      return slot->bd;
+    }
+
+    i = ( i + 1 ) & shard->hash_mask;
+  }
+}
+
+/**
+ * Inserts the buffer to the hash index. The index has at least twice as many
+ * slots as buffers, so there is always an empty slot.
+ *
+ * @retval 0 The buffer was added successfully.
+ * @retval -1 A buffer for the block is already in the index.
+ */
+static int rtems_bdbuf_hash_insert(
+  rtems_bdbuf_shard  *shard,
+  rtems_bdbuf_buffer *bd
+)
+{
+  uint32_t i = rtems_bdbuf_hash_home( shard, bd->dd, bd->block );
+
+  while ( shard->hash_slots[ i ].bd != NULL ) {
+    const rtems_bdbuf_hash_slot *slot = &shard->hash_slots[ i ];
+
+    if ( slot->dd == bd->dd && slot->block == bd->block ) {
+      return -1;
+    }
+
+    i = ( i + 1 ) & shard->hash_mask;
+  }
+
+  shard->hash_slots[ i ].dd = bd->dd;
+  shard->hash_slots[ i ].block = bd->block;
+  shard->hash_slots[ i ].bd = bd;
+
+  return 0;
+}
+
+/**
+ * Removes the buffer from the hash index. The following slots of the probe
+ * sequence are shifted backwards, so that no tombstones are necessary.
+ *
+ * @retval 0 The buffer was removed.
+ * @retval -1 The buffer is not in the index.
+ */
+static int rtems_bdbuf_hash_remove(
+  rtems_bdbuf_shard        *shard,
+  const rtems_bdbuf_buffer *bd
+)
+{
+  rtems_bdbuf_hash_slot *slots = shard->hash_slots;
+  uint32_t               mask = shard->hash_mask;
+  uint32_t               i = rtems_bdbuf_hash_home( shard, bd->dd, bd->block );
+  uint32_t               j;
+
+  while ( slots[ i ].bd != bd ) {
+    if ( slots[ i ].bd == NULL ) {
+      return -1;
+    }
+
+    i = ( i + 1 ) & mask;
+  }
+
+  j = i;
+
+  while ( true ) {
+    uint32_t k;
+
+    j = ( j + 1 ) & mask;
+
+    if ( slots[ j ].bd == NULL ) {
+      break;
+    }
+
+    k = rtems_bdbuf_hash_home( shard, slots[ j ].dd, slots[ j ].block );
+
+    /*
+     * Keep the entry in slot j if its home slot k is cyclically in (i, j].
+     */
+    if ( i <= j ? ( i < k && k <= j ) : ( i < k || k <= j ) ) {
+      continue;
+    }
+
+    slots[ i ] = slots[ j ];
+    i = j;
+  }
+
+  slots[ i ].bd = NULL;
+
+  return 0;
+}
+
+/**
+ * Searches the buffer of the block in the lookup engine of the shard.
+ *
+ * @param[in, out] probes The count of visited tree nodes or index slots is
+ *   added to this value.
+ */
+static rtems_bdbuf_buffer *rtems_bdbuf_lookup_search(
+  rtems_bdbuf_shard       *shard,
+  const rtems_disk_device *dd,
+  rtems_blkdev_bnum        block,
+  uint32_t                *probes
+)
+{
+  if ( rtems_bdbuf_has_hash_index() ) {
+    return rtems_bdbuf_hash_search( shard, dd, block, probes );
+  }
+
+  return rtems_bdbuf_avl_search( &shard->tree, dd, block, probes );
+}
+
+static int rtems_bdbuf_lookup_insert(
+  rtems_bdbuf_shard  *shard,
+  rtems_bdbuf_buffer *bd
+)
+{
+  if ( rtems_bdbuf_has_hash_index() ) {
+    return rtems_bdbuf_hash_insert( shard, bd );
+  }
+
+  return rtems_bdbuf_avl_insert( &shard->tree, bd );
+}
+
+static int rtems_bdbuf_lookup_remove(
+  rtems_bdbuf_shard        *shard,
+  const rtems_bdbuf_buffer *bd
+)
+{
+  if ( rtems_bdbuf_has_hash_index() ) {
+    return rtems_bdbuf_hash_remove( shard, bd );
+  }
+
+  return rtems_bdbuf_avl_remove( &shard->tree, bd );
+}
+
 static void rtems_bdbuf_set_state(
   rtems_bdbuf_buffer   *bd,
   rtems_bdbuf_buf_state state
@@ -770,6 +1072,27 @@ static rtems_blkdev_bnum rtems_bdbuf_media_block(
   }
 }
 
+/**
+ * Prefetches the home slot of the block in the hash index before the shard is
+ * locked. The slot is only a hint, so it does not matter if the disk device
+ * changes concurrently.
+ */
+static void rtems_bdbuf_lookup_prefetch(
+  const rtems_bdbuf_shard *shard,
+  const rtems_disk_device *dd,
+  rtems_blkdev_bnum        block
+)
+{
+  if ( rtems_bdbuf_has_hash_index() && block < dd->block_count ) {
+    rtems_blkdev_bnum media_block = rtems_bdbuf_media_block( dd, block ) +
+                                    dd->start;
+
+    __builtin_prefetch(
+      &shard->hash_slots[ rtems_bdbuf_hash_home( shard, dd, media_block ) ]
+    );
+  }
+}
+
 /**
  * Lock the mutex. A single task can nest calls.
  *
@@ -822,6 +1145,133 @@ static void rtems_bdbuf_unlock_sync( void )
   rtems_bdbuf_unlock( &bdbuf_cache.sync_lock );
 }
 
+static bool rtems_bdbuf_is_sharded( void )
+{
+  return bdbuf_cache.shard_count > 1;
+}
+
+/**
+ * Lock the cache while a shard is locked. With a single shard the cache lock
+ * is the shard lock and is already owned by the caller.
+ */
+static void rtems_bdbuf_lock_cache_nested( void )
+{
+  if ( rtems_bdbuf_is_sharded() ) {
+    rtems_bdbuf_lock_cache();
+  }
+}
+
+/**
+ * Unlock the cache locked by rtems_bdbuf_lock_cache_nested().
+ */
+static void rtems_bdbuf_unlock_cache_nested( void )
+{
+  if ( rtems_bdbuf_is_sharded() ) {
+    rtems_bdbuf_unlock_cache();
+  }
+}
+
+static void rtems_bdbuf_lock_shard( rtems_bdbuf_shard *shard )
+{
+  rtems_bdbuf_lock( shard->lock );
+}
+
+static void rtems_bdbuf_unlock_shard( rtems_bdbuf_shard *shard )
+{
+  rtems_bdbuf_unlock( shard->lock );
+}
+
+/**
+ * Lock all shards and the cache. The shards are locked in index order and
+ * before the cache lock. A task owns at most one shard lock otherwise.
+ */
+static void rtems_bdbuf_lock_all( void )
+{
+  uint32_t i;
+
+  for ( i = 0; i < bdbuf_cache.shard_count; ++i ) {
+    rtems_bdbuf_lock_shard( &bdbuf_cache.shards[ i ] );
+  }
+
+  rtems_bdbuf_lock_cache_nested();
+}
+
+static void rtems_bdbuf_unlock_all( void )
+{
+  uint32_t i;
+
+  rtems_bdbuf_unlock_cache_nested();
+
+  for ( i = bdbuf_cache.shard_count; i > 0; --i ) {
+    rtems_bdbuf_unlock_shard( &bdbuf_cache.shards[ i - 1 ] );
+  }
+}
+
+/**
+ * Get the shard responsible for the block of the device.
+ *
+ * @param dd The disk device.
+ * @param block The block number relative to the disk device.
+ */
+static rtems_bdbuf_shard *rtems_bdbuf_get_shard(
+  const rtems_disk_device *dd,
+  rtems_blkdev_bnum        block
+)
+{
+  uint32_t key;
+
+  if ( !rtems_bdbuf_is_sharded() ) {
+    return &bdbuf_cache.shards[ 0 ];
+  }
+
+  key = (uint32_t) ( (uintptr_t) dd >> 4 ) ^
+        ( block >> RTEMS_BDBUF_SHARD_EXTENT_SHIFT );
+  key *= 0x9e3779b1U;
+
+  return &bdbuf_cache.shards[ ( key >> 16 ) % bdbuf_cache.shard_count ];
+}
+
+/**
+ * Get the shard which owns the group of the buffer. A buffer in use is in the
+ * lookup tree of the shard selected by rtems_bdbuf_get_shard() for its block,
+ * since it was taken from the LRU list of this shard.
+ */
+static rtems_bdbuf_shard *rtems_bdbuf_shard_of_buffer(
+  const rtems_bdbuf_buffer *bd
+)
+{
+  size_t group_index;
+
+  if ( !rtems_bdbuf_is_sharded() ) {
+    return &bdbuf_cache.shards[ 0 ];
+  }
+
+  group_index = (size_t) ( bd->group - bdbuf_cache.groups );
+
+  return &bdbuf_cache.shards[ group_index % bdbuf_cache.shard_count ];
+}
+
+/**
+ * Limit the transfer count of a multi-block read so that it does not cross
+ * the shard extent of the start block.
+ */
+static uint32_t rtems_bdbuf_shard_transfer_limit(
+  rtems_blkdev_bnum block,
+  uint32_t          transfer_count
+)
+{
+  if ( rtems_bdbuf_is_sharded() ) {
+    uint32_t extent_size = UINT32_C( 1 ) << RTEMS_BDBUF_SHARD_EXTENT_SHIFT;
+    uint32_t extent_rest = extent_size - ( block & ( extent_size - 1 ) );
+
+    if ( transfer_count > extent_rest ) {
+      transfer_count = extent_rest;
+    }
+  }
+
+  return transfer_count;
+}
+
 static void rtems_bdbuf_group_obtain( rtems_bdbuf_buffer *bd )
 {
   ++bd->group->users;
@@ -844,17 +1294,20 @@ static void rtems_bdbuf_group_release( rtems_bdbuf_buffer *bd )
  *
  * A counter is used to save the release call when no one is waiting.
  *
- * The function assumes the cache is locked on entry and it will be locked on
+ * The function assumes the shard is locked on entry and it will be locked on
  * exit.
  */
-static void rtems_bdbuf_anonymous_wait( rtems_bdbuf_waiters *waiters )
+static void rtems_bdbuf_anonymous_wait(
+  rtems_bdbuf_shard   *shard,
+  rtems_bdbuf_waiters *waiters
+)
 {
   /*
    * Indicate we are waiting.
    */
   ++waiters->count;
 
-  rtems_condition_variable_wait( &waiters->cond_var, &bdbuf_cache.lock );
+  rtems_condition_variable_wait( &waiters->cond_var, shard->lock );
 
   --waiters->count;
 }
@@ -866,7 +1319,7 @@ static void rtems_bdbuf_wait(
 {
   rtems_bdbuf_group_obtain( bd );
   ++bd->waiters;
-  rtems_bdbuf_anonymous_wait( waiters );
+  rtems_bdbuf_anonymous_wait( rtems_bdbuf_shard_of_buffer( bd ), waiters );
   --bd->waiters;
   rtems_bdbuf_group_release( bd );
 }
@@ -893,37 +1346,145 @@ static void rtems_bdbuf_wake_swapper( void )
   }
 }
 
-static bool rtems_bdbuf_has_buffer_waiters( void )
+static bool rtems_bdbuf_has_buffer_waiters( const rtems_bdbuf_shard *shard )
 {
-  return bdbuf_cache.buffer_waiters.count;
+  return shard->buffer_waiters.count;
 }
 
 static void rtems_bdbuf_remove_from_tree( rtems_bdbuf_buffer *bd )
 {
-  if ( rtems_bdbuf_avl_remove( &bdbuf_cache.tree, bd ) != 0 ) {
+  rtems_bdbuf_shard *shard = rtems_bdbuf_shard_of_buffer( bd );
+
+  if ( rtems_bdbuf_lookup_remove( shard, bd ) != 0 ) {
     rtems_bdbuf_fatal_with_state( bd->state, RTEMS_BDBUF_FATAL_TREE_RM );
   }
 }
 
-static void rtems_bdbuf_remove_from_tree_and_lru_list( rtems_bdbuf_buffer *bd )
+static bool rtems_bdbuf_has_2q_policy( void )
 {
-  switch ( bd->state ) {
-    case RTEMS_BDBUF_STATE_FREE:
-      break;
-    case RTEMS_BDBUF_STATE_CACHED:
-      rtems_bdbuf_remove_from_tree( bd );
-      break;
-    default:
-      rtems_bdbuf_fatal_with_state( bd->state, RTEMS_BDBUF_FATAL_STATE_10 );
-  }
-
-  rtems_chain_extract_unprotected( &bd->link );
+  return bdbuf_config.replacement_policy == RTEMS_BDBUF_REPLACEMENT_2Q;
 }
 
-static void rtems_bdbuf_make_free_and_add_to_lru_list( rtems_bdbuf_buffer *bd )
-{
-  rtems_bdbuf_set_state( bd, RTEMS_BDBUF_STATE_FREE );
-  rtems_chain_prepend_unprotected( &bdbuf_cache.lru, &bd->link );
+/**
+ * Returns the queue of the buffer and accounts the buffer which is about to
+ * be added to the queue.
+ */
+static rtems_chain_control *rtems_bdbuf_enqueue(
+  rtems_bdbuf_shard        *shard,
+  const rtems_bdbuf_buffer *bd
+)
+{
+  if ( bd->queue == RTEMS_BDBUF_QUEUE_FREQUENT ) {
+    return &shard->frequent;
+  }
+
+  ++shard->recent_count;
+  return &shard->lru;
+}
+
+/**
+ * Extracts the buffer from the list it is on. Buffers in the free or cached
+ * state are on a queue of the replacement policy.
+ */
+static void rtems_bdbuf_extract_from_list( rtems_bdbuf_buffer *bd )
+{
+  if (
+    bd->queue == RTEMS_BDBUF_QUEUE_RECENT &&
+    ( bd->state == RTEMS_BDBUF_STATE_FREE ||
+      bd->state == RTEMS_BDBUF_STATE_CACHED )
+  ) {
+    --rtems_bdbuf_shard_of_buffer( bd )->recent_count;
+  }
+
+  rtems_chain_extract_unprotected( &bd->link );
+}
+
+static uint32_t rtems_bdbuf_ghost_hash(
+  const rtems_disk_device *dd,
+  rtems_blkdev_bnum        block
+)
+{
+  uint32_t h;
+
+  h = (uint32_t) ( (uintptr_t) dd >> 4 ) * 0x9e3779b1U;
+  h ^= block;
+  h ^= h >> 16;
+  h *= 0x85ebca6bU;
+  h ^= h >> 13;
+  h *= 0xc2b2ae35U;
+  h ^= h >> 16;
+
+  /*
+   * A zero tag marks an empty ghost slot.
+   */
+  return h | 1;
+}
+
+/**
+ * Remembers a block evicted from the recent queue. The ghost filter is
+ * direct-mapped, so a newer block replaces an older block of the same slot.
+ * This bounds the memory of the ghost queue of the 2Q policy.
+ */
+static void rtems_bdbuf_ghost_add(
+  rtems_bdbuf_shard       *shard,
+  const rtems_disk_device *dd,
+  rtems_blkdev_bnum        block
+)
+{
+  uint32_t tag = rtems_bdbuf_ghost_hash( dd, block );
+
+  shard->ghosts[ ( tag >> 1 ) & shard->ghost_mask ] = tag;
+}
+
+/**
+ * Checks if the block was recently evicted from the recent queue and forgets
+ * it.
+ */
+static bool rtems_bdbuf_ghost_take(
+  rtems_bdbuf_shard       *shard,
+  const rtems_disk_device *dd,
+  rtems_blkdev_bnum        block
+)
+{
+  uint32_t  tag = rtems_bdbuf_ghost_hash( dd, block );
+  uint32_t *slot = &shard->ghosts[ ( tag >> 1 ) & shard->ghost_mask ];
+
+  if ( *slot != tag ) {
+    return false;
+  }
+
+  *slot = 0;
+  return true;
+}
+
+static void rtems_bdbuf_remove_from_tree_and_lru_list( rtems_bdbuf_buffer *bd )
+{
+  switch ( bd->state ) {
+    case RTEMS_BDBUF_STATE_FREE:
+      break;
+    case RTEMS_BDBUF_STATE_CACHED:
+      rtems_bdbuf_remove_from_tree( bd );
+      break;
+    default:
+      rtems_bdbuf_fatal_with_state( bd->state, RTEMS_BDBUF_FATAL_STATE_10 );
+  }
+
+  rtems_bdbuf_extract_from_list( bd );
+}
+
+static void rtems_bdbuf_make_free_and_add_to_lru_list( rtems_bdbuf_buffer *bd )
+{
+  rtems_bdbuf_shard *shard = rtems_bdbuf_shard_of_buffer( bd );
+
+  /*
+   * Free buffers are at the head of the recent queue and are recycled first.
+   */
+  rtems_bdbuf_set_state( bd, RTEMS_BDBUF_STATE_FREE );
+  bd->queue = RTEMS_BDBUF_QUEUE_RECENT;
+  rtems_chain_prepend_unprotected(
+    rtems_bdbuf_enqueue( shard, bd ),
+    &bd->link
+  );
 }
 
 static void rtems_bdbuf_make_empty( rtems_bdbuf_buffer *bd )
@@ -935,8 +1496,13 @@ static void rtems_bdbuf_make_cached_and_add_to_lru_list(
   rtems_bdbuf_buffer *bd
 )
 {
+  rtems_bdbuf_shard *shard = rtems_bdbuf_shard_of_buffer( bd );
+
   rtems_bdbuf_set_state( bd, RTEMS_BDBUF_STATE_CACHED );
-  rtems_chain_append_unprotected( &bdbuf_cache.lru, &bd->link );
+  rtems_chain_append_unprotected(
+    rtems_bdbuf_enqueue( shard, bd ),
+    &bd->link
+  );
 }
 
 static void rtems_bdbuf_discard_buffer( rtems_bdbuf_buffer *bd )
@@ -949,12 +1515,27 @@ static void rtems_bdbuf_discard_buffer( rtems_bdbuf_buffer *bd )
   }
 }
 
+static bool rtems_bdbuf_is_sync_active_for_device(
+  const rtems_disk_device *dd
+)
+{
+  bool active;
+
+  rtems_bdbuf_lock_cache_nested();
+  active = bdbuf_cache.sync_active && bdbuf_cache.sync_device == dd;
+  rtems_bdbuf_unlock_cache_nested();
+
+  return active;
+}
+
 static void rtems_bdbuf_add_to_modified_list_after_access(
   rtems_bdbuf_buffer *bd
 )
 {
-  if ( bdbuf_cache.sync_active && bdbuf_cache.sync_device == bd->dd ) {
-    rtems_bdbuf_unlock_cache();
+  rtems_bdbuf_shard *shard = rtems_bdbuf_shard_of_buffer( bd );
+
+  if ( rtems_bdbuf_is_sync_active_for_device( bd->dd ) ) {
+    rtems_bdbuf_unlock_shard( shard );
 
     /*
      * Wait for the sync lock.
@@ -962,7 +1543,7 @@ static void rtems_bdbuf_add_to_modified_list_after_access(
     rtems_bdbuf_lock_sync();
 
     rtems_bdbuf_unlock_sync();
-    rtems_bdbuf_lock_cache();
+    rtems_bdbuf_lock_shard( shard );
   }
 
   /*
@@ -984,24 +1565,26 @@ static void rtems_bdbuf_add_to_modified_list_after_access(
   }
 
   rtems_bdbuf_set_state( bd, RTEMS_BDBUF_STATE_MODIFIED );
-  rtems_chain_append_unprotected( &bdbuf_cache.modified, &bd->link );
+  rtems_chain_append_unprotected( &shard->modified, &bd->link );
 
   if ( bd->waiters ) {
-    rtems_bdbuf_wake( &bdbuf_cache.access_waiters );
-  } else if ( rtems_bdbuf_has_buffer_waiters() ) {
+    rtems_bdbuf_wake( &shard->access_waiters );
+  } else if ( rtems_bdbuf_has_buffer_waiters( shard ) ) {
     rtems_bdbuf_wake_swapper();
   }
 }
 
 static void rtems_bdbuf_add_to_lru_list_after_access( rtems_bdbuf_buffer *bd )
 {
+  rtems_bdbuf_shard *shard = rtems_bdbuf_shard_of_buffer( bd );
+
   rtems_bdbuf_group_release( bd );
   rtems_bdbuf_make_cached_and_add_to_lru_list( bd );
 
   if ( bd->waiters ) {
-    rtems_bdbuf_wake( &bdbuf_cache.access_waiters );
+    rtems_bdbuf_wake( &shard->access_waiters );
   } else {
-    rtems_bdbuf_wake( &bdbuf_cache.buffer_waiters );
+    rtems_bdbuf_wake( &shard->buffer_waiters );
   }
 }
 
@@ -1028,13 +1611,15 @@ static size_t rtems_bdbuf_bds_per_group( size_t size )
 
 static void rtems_bdbuf_discard_buffer_after_access( rtems_bdbuf_buffer *bd )
 {
+  rtems_bdbuf_shard *shard = rtems_bdbuf_shard_of_buffer( bd );
+
   rtems_bdbuf_group_release( bd );
   rtems_bdbuf_discard_buffer( bd );
 
   if ( bd->waiters ) {
-    rtems_bdbuf_wake( &bdbuf_cache.access_waiters );
+    rtems_bdbuf_wake( &shard->access_waiters );
   } else {
-    rtems_bdbuf_wake( &bdbuf_cache.buffer_waiters );
+    rtems_bdbuf_wake( &shard->buffer_waiters );
   }
 }
 
@@ -1084,7 +1669,9 @@ static rtems_bdbuf_buffer *rtems_bdbuf_group_realloc(
   }
 
   if ( b > 1 ) {
-    rtems_bdbuf_wake( &bdbuf_cache.buffer_waiters );
+    rtems_bdbuf_shard *shard = rtems_bdbuf_shard_of_buffer( group->bdbuf );
+
+    rtems_bdbuf_wake( &shard->buffer_waiters );
   }
 
   return group->bdbuf;
@@ -1096,27 +1683,73 @@ static void rtems_bdbuf_setup_empty_buffer(
   rtems_blkdev_bnum   block
 )
 {
+  rtems_bdbuf_shard *shard = rtems_bdbuf_shard_of_buffer( bd );
+
   bd->dd = dd;
   bd->block = block;
   bd->avl.left = NULL;
   bd->avl.right = NULL;
   bd->waiters = 0;
 
-  if ( rtems_bdbuf_avl_insert( &bdbuf_cache.tree, bd ) != 0 ) {
+  /*
+   * The 2Q policy adds a block evicted recently from the recent queue directly
+   * to the frequent queue.
+   */
+  if (
+    rtems_bdbuf_has_2q_policy() && rtems_bdbuf_ghost_take( shard, dd, block )
+  ) {
+    bd->queue = RTEMS_BDBUF_QUEUE_FREQUENT;
+  } else {
+    bd->queue = RTEMS_BDBUF_QUEUE_RECENT;
+  }
+
+  if ( rtems_bdbuf_lookup_insert( shard, bd ) != 0 ) {
     rtems_bdbuf_fatal( RTEMS_BDBUF_FATAL_RECYCLE );
   }
 
   rtems_bdbuf_make_empty( bd );
 }
 
-static rtems_bdbuf_buffer *rtems_bdbuf_get_buffer_from_lru_list(
-  rtems_disk_device *dd,
-  rtems_blkdev_bnum  block
+/**
+ * Accounts the eviction of the buffer if it holds a cached block. The 2Q
+ * policy remembers blocks evicted from the recent queue in the ghost filter.
+ */
+static void rtems_bdbuf_account_eviction(
+  rtems_bdbuf_shard        *shard,
+  const rtems_bdbuf_buffer *bd,
+  rtems_bdbuf_access_stats *access_stats
+)
+{
+  if ( bd->state != RTEMS_BDBUF_STATE_CACHED ) {
+    return;
+  }
+
+  if ( bd->queue == RTEMS_BDBUF_QUEUE_FREQUENT ) {
+    if ( access_stats != NULL ) {
+      ++access_stats->frequent_evictions;
+    }
+  } else {
+    if ( access_stats != NULL ) {
+      ++access_stats->recent_evictions;
+    }
+
+    if ( rtems_bdbuf_has_2q_policy() ) {
+      rtems_bdbuf_ghost_add( shard, bd->dd, bd->block );
+    }
+  }
+}
+
+static rtems_bdbuf_buffer *rtems_bdbuf_get_buffer_from_queue(
+  rtems_bdbuf_shard        *shard,
+  rtems_chain_control      *queue,
+  rtems_disk_device        *dd,
+  rtems_blkdev_bnum         block,
+  rtems_bdbuf_access_stats *access_stats
 )
 {
-  rtems_chain_node *node = rtems_chain_first( &bdbuf_cache.lru );
+  rtems_chain_node *node = rtems_chain_first( queue );
 
-  while ( !rtems_chain_is_tail( &bdbuf_cache.lru, node ) ) {
+  while ( !rtems_chain_is_tail( queue, node ) ) {
     rtems_bdbuf_buffer *bd = (rtems_bdbuf_buffer *) node;
     rtems_bdbuf_buffer *empty_bd = NULL;
 
@@ -1136,10 +1769,12 @@ static rtems_bdbuf_buffer *rtems_bdbuf_get_buffer_from_lru_list(
      */
     if ( bd->waiters == 0 ) {
       if ( bd->group->bds_per_group == dd->bds_per_group ) {
+        rtems_bdbuf_account_eviction( shard, bd, access_stats );
         rtems_bdbuf_remove_from_tree_and_lru_list( bd );
 
         empty_bd = bd;
       } else if ( bd->group->users == 0 ) {
+        rtems_bdbuf_account_eviction( shard, bd, access_stats );
         empty_bd = rtems_bdbuf_group_realloc( bd->group, dd->bds_per_group );
       }
     }
@@ -1156,6 +1791,67 @@ static rtems_bdbuf_buffer *rtems_bdbuf_get_buffer_from_lru_list(
   return NULL;
 }
 
+/**
+ * Selects the queue to recycle a buffer from first. The 2Q replacement policy
+ * protects the frequent queue as long as the recent queue is within its limit
+ * and has no free buffers.
+ */
+static bool rtems_bdbuf_recycle_recent_first( const rtems_bdbuf_shard *shard )
+{
+  const rtems_bdbuf_buffer *first;
+
+  if (
+    shard->recent_count > shard->recent_limit ||
+    rtems_chain_is_empty( &shard->frequent ) ||
+    rtems_chain_is_empty( &shard->lru )
+  ) {
+    return true;
+  }
+
+  first = (const rtems_bdbuf_buffer *) rtems_chain_immutable_first(
+    &shard->lru
+  );
+
+  return first->state == RTEMS_BDBUF_STATE_FREE;
+}
+
+static rtems_bdbuf_buffer *rtems_bdbuf_get_buffer_from_lru_list(
+  rtems_bdbuf_shard        *shard,
+  rtems_disk_device        *dd,
+  rtems_blkdev_bnum         block,
+  rtems_bdbuf_access_stats *access_stats
+)
+{
+  rtems_chain_control *queues[ 2 ];
+  size_t               i;
+
+  if ( rtems_bdbuf_recycle_recent_first( shard ) ) {
+    queues[ 0 ] = &shard->lru;
+    queues[ 1 ] = &shard->frequent;
+  } else {
+    queues[ 0 ] = &shard->frequent;
+    queues[ 1 ] = &shard->lru;
+  }
+
+  for ( i = 0; i < RTEMS_ARRAY_SIZE( queues ); ++i ) {
+    rtems_bdbuf_buffer *bd;
+
+    bd = rtems_bdbuf_get_buffer_from_queue(
+      shard,
+      queues[ i ],
+      dd,
+      block,
+      access_stats
+    );
+
+    if ( bd != NULL ) {
+      return bd;
+    }
+  }
+
+  return NULL;
+}
+
 static rtems_status_code rtems_bdbuf_create_task(
   rtems_name          name,
   rtems_task_priority priority,
@@ -1274,12 +1970,128 @@ static size_t rtems_bdbuf_read_request_size( uint32_t transfer_count )
          sizeof( rtems_blkdev_sg_buffer ) * transfer_count;
 }
 
+/**
+ * Returns the hash index slot count for a shard with the buffer count. There
+ * are at least twice as many slots as buffers to keep the probe sequences
+ * short.
+ */
+static uint32_t rtems_bdbuf_hash_slot_count( uint32_t buffer_count )
+{
+  uint32_t slot_count = 2;
+
+  while ( slot_count < 2 * buffer_count ) {
+    slot_count *= 2;
+  }
+
+  return slot_count;
+}
+
+static void rtems_bdbuf_shards_destroy(
+  rtems_bdbuf_shard *shards,
+  uint32_t           shard_count
+)
+{
+  uint32_t i;
+
+  for ( i = 0; i < shard_count; ++i ) {
+    free( shards[ i ].hash_slots );
+    free( shards[ i ].ghosts );
+  }
+
+  free( shards );
+}
+
+static rtems_bdbuf_shard *rtems_bdbuf_shards_create( uint32_t shard_count )
+{
+  rtems_bdbuf_shard *shards;
+  uint32_t           i;
+
+  shards = calloc( shard_count, sizeof( *shards ) );
+  if ( shards == NULL ) {
+    return NULL;
+  }
+
+  for ( i = 0; i < shard_count; ++i ) {
+    rtems_bdbuf_shard *shard = &shards[ i ];
+    uint32_t           buffer_count;
+
+    /*
+     * The groups are distributed round-robin to the shards.
+     */
+    buffer_count = ( bdbuf_cache.group_count - i + shard_count - 1 ) /
+                   shard_count * bdbuf_cache.max_bds_per_group;
+
+    if ( rtems_bdbuf_has_hash_index() ) {
+      uint32_t slot_count = rtems_bdbuf_hash_slot_count( buffer_count );
+
+      shard->hash_slots = calloc( slot_count, sizeof( *shard->hash_slots ) );
+      if ( shard->hash_slots == NULL ) {
+        rtems_bdbuf_shards_destroy( shards, shard_count );
+        return NULL;
+      }
+
+      shard->hash_mask = slot_count - 1;
+    }
+
+    if ( rtems_bdbuf_has_2q_policy() ) {
+      uint32_t ghost_count;
+
+      /*
+       * The ghost filter remembers about half as many blocks as the shard has
+       * buffers.
+       */
+      ghost_count = rtems_bdbuf_hash_slot_count( buffer_count / 4 );
+
+      shard->ghosts = calloc( ghost_count, sizeof( *shard->ghosts ) );
+      if ( shard->ghosts == NULL ) {
+        rtems_bdbuf_shards_destroy( shards, shard_count );
+        return NULL;
+      }
+
+      shard->ghost_mask = ghost_count - 1;
+    }
+
+    if ( shard_count > 1 ) {
+      rtems_mutex_init( &shard->shard_lock, "bdbuf shard lock" );
+      shard->lock = &shard->shard_lock;
+    } else {
+      shard->lock = &bdbuf_cache.lock;
+    }
+
+    rtems_chain_initialize_empty( &shard->lru );
+    rtems_chain_initialize_empty( &shard->frequent );
+    rtems_chain_initialize_empty( &shard->modified );
+    rtems_chain_initialize_empty( &shard->sync );
+
+    shard->recent_limit = buffer_count / RTEMS_BDBUF_RECENT_QUEUE_DIVISOR;
+    if ( shard->recent_limit == 0 ) {
+      shard->recent_limit = 1;
+    }
+
+    rtems_condition_variable_init(
+      &shard->access_waiters.cond_var,
+      "bdbuf access"
+    );
+    rtems_condition_variable_init(
+      &shard->transfer_waiters.cond_var,
+      "bdbuf transfer"
+    );
+    rtems_condition_variable_init(
+      &shard->buffer_waiters.cond_var,
+      "bdbuf buffer"
+    );
+  }
+
+  return shards;
+}
+
 static rtems_status_code rtems_bdbuf_do_init( void )
 {
   rtems_bdbuf_group  *group;
   rtems_bdbuf_buffer *bd;
   uint8_t            *buffer;
   size_t              b;
+  uint32_t            shard_count;
   rtems_status_code   sc;
 
   if ( rtems_bdbuf_tracer ) {
@@ -1305,28 +2117,24 @@ static rtems_status_code rtems_bdbuf_do_init( void )
     return RTEMS_INVALID_NUMBER;
   }
 
+  /*
+   * Each shard needs at least one group.
+   */
+  shard_count = bdbuf_config.shard_count != 0 ? bdbuf_config.shard_count : 1;
+  if (
+    shard_count > 1 &&
+    shard_count > bdbuf_config.size / bdbuf_config.buffer_max
+  ) {
+    return RTEMS_INVALID_NUMBER;
+  }
+
   bdbuf_cache.sync_device = BDBUF_INVALID_DEV;
 
   rtems_chain_initialize_empty( &bdbuf_cache.swapout_free_workers );
-  rtems_chain_initialize_empty( &bdbuf_cache.lru );
-  rtems_chain_initialize_empty( &bdbuf_cache.modified );
-  rtems_chain_initialize_empty( &bdbuf_cache.sync );
   rtems_chain_initialize_empty( &bdbuf_cache.read_ahead_chain );
 
   rtems_mutex_set_name( &bdbuf_cache.lock, "bdbuf lock" );
   rtems_mutex_set_name( &bdbuf_cache.sync_lock, "bdbuf sync lock" );
-  rtems_condition_variable_set_name(
-    &bdbuf_cache.access_waiters.cond_var,
-    "bdbuf access"
-  );
-  rtems_condition_variable_set_name(
-    &bdbuf_cache.transfer_waiters.cond_var,
-    "bdbuf transfer"
-  );
-  rtems_condition_variable_set_name(
-    &bdbuf_cache.buffer_waiters.cond_var,
-    "bdbuf buffer"
-  );
 
   rtems_bdbuf_lock_cache();
 
@@ -1361,6 +2169,17 @@ static rtems_status_code rtems_bdbuf_do_init( void )
     goto error;
   }
 
+  /*
+   * Allocate the shards. The groups are distributed round-robin to the
+   * shards, see rtems_bdbuf_shard_of_buffer().
+   */
+  bdbuf_cache.shards = rtems_bdbuf_shards_create( shard_count );
+  if ( !bdbuf_cache.shards ) {
+    goto error;
+  }
+
+  bdbuf_cache.shard_count = shard_count;
+
   /*
    * Allocate memory for buffer memory. The buffer memory will be cache
    * aligned. It is possible to free the memory allocated by
@@ -1389,7 +2208,7 @@ static rtems_status_code rtems_bdbuf_do_init( void )
     bd->group = group;
     bd->buffer = buffer;
 
-    rtems_chain_append_unprotected( &bdbuf_cache.lru, &bd->link );
+    rtems_bdbuf_make_free_and_add_to_lru_list( bd );
 
     if (
       ( b % bdbuf_cache.max_bds_per_group ) ==
@@ -1505,6 +2324,11 @@ error:
   }
 
   free( bdbuf_cache.buffers );
+
+  if ( bdbuf_cache.shards != NULL ) {
+    rtems_bdbuf_shards_destroy( bdbuf_cache.shards, bdbuf_cache.shard_count );
+  }
+
   free( bdbuf_cache.groups );
   free( bdbuf_cache.bds );
   free( bdbuf_cache.swapout_transfer );
@@ -1560,13 +2384,15 @@ static void rtems_bdbuf_wait_for_transient_event( void )
 
 static void rtems_bdbuf_wait_for_access( rtems_bdbuf_buffer *bd )
 {
+  rtems_bdbuf_shard *shard = rtems_bdbuf_shard_of_buffer( bd );
+
   while ( true ) {
     switch ( bd->state ) {
       case RTEMS_BDBUF_STATE_MODIFIED:
         rtems_bdbuf_group_release( bd );
         /* Fall through */
       case RTEMS_BDBUF_STATE_CACHED:
-        rtems_chain_extract_unprotected( &bd->link );
+        rtems_bdbuf_extract_from_list( bd );
         /* Fall through */
       case RTEMS_BDBUF_STATE_EMPTY:
         return;
@@ -1574,12 +2400,12 @@ static void rtems_bdbuf_wait_for_access( rtems_bdbuf_buffer *bd )
       case RTEMS_BDBUF_STATE_ACCESS_EMPTY:
       case RTEMS_BDBUF_STATE_ACCESS_MODIFIED:
       case RTEMS_BDBUF_STATE_ACCESS_PURGED:
-        rtems_bdbuf_wait( bd, &bdbuf_cache.access_waiters );
+        rtems_bdbuf_wait( bd, &shard->access_waiters );
         break;
       case RTEMS_BDBUF_STATE_SYNC:
       case RTEMS_BDBUF_STATE_TRANSFER:
       case RTEMS_BDBUF_STATE_TRANSFER_PURGED:
-        rtems_bdbuf_wait( bd, &bdbuf_cache.transfer_waiters );
+        rtems_bdbuf_wait( bd, &shard->transfer_waiters );
         break;
       default:
         rtems_bdbuf_fatal_with_state( bd->state, RTEMS_BDBUF_FATAL_STATE_7 );
@@ -1591,9 +2417,11 @@ static void rtems_bdbuf_request_sync_for_modified_buffer(
   rtems_bdbuf_buffer *bd
 )
 {
+  rtems_bdbuf_shard *shard = rtems_bdbuf_shard_of_buffer( bd );
+
   rtems_bdbuf_set_state( bd, RTEMS_BDBUF_STATE_SYNC );
   rtems_chain_extract_unprotected( &bd->link );
-  rtems_chain_append_unprotected( &bdbuf_cache.sync, &bd->link );
+  rtems_chain_append_unprotected( &shard->sync, &bd->link );
   rtems_bdbuf_wake_swapper();
 }
 
@@ -1605,6 +2433,8 @@ static void rtems_bdbuf_request_sync_for_modified_buffer(
  */
 static bool rtems_bdbuf_wait_for_recycle( rtems_bdbuf_buffer *bd )
 {
+  rtems_bdbuf_shard *shard = rtems_bdbuf_shard_of_buffer( bd );
+
   while ( true ) {
     switch ( bd->state ) {
       case RTEMS_BDBUF_STATE_FREE:
@@ -1623,19 +2453,19 @@ static bool rtems_bdbuf_wait_for_recycle( rtems_bdbuf_buffer *bd )
            * pong with another recycle waiter.  The state of the buffer is
            * arbitrary afterwards.
            */
-          rtems_bdbuf_anonymous_wait( &bdbuf_cache.buffer_waiters );
+          rtems_bdbuf_anonymous_wait( shard, &shard->buffer_waiters );
           return false;
         }
       case RTEMS_BDBUF_STATE_ACCESS_CACHED:
       case RTEMS_BDBUF_STATE_ACCESS_EMPTY:
       case RTEMS_BDBUF_STATE_ACCESS_MODIFIED:
       case RTEMS_BDBUF_STATE_ACCESS_PURGED:
-        rtems_bdbuf_wait( bd, &bdbuf_cache.access_waiters );
+        rtems_bdbuf_wait( bd, &shard->access_waiters );
         break;
       case RTEMS_BDBUF_STATE_SYNC:
       case RTEMS_BDBUF_STATE_TRANSFER:
       case RTEMS_BDBUF_STATE_TRANSFER_PURGED:
-        rtems_bdbuf_wait( bd, &bdbuf_cache.transfer_waiters );
+        rtems_bdbuf_wait( bd, &shard->transfer_waiters );
         break;
       default:
         rtems_bdbuf_fatal_with_state( bd->state, RTEMS_BDBUF_FATAL_STATE_8 );
@@ -1645,6 +2475,8 @@ static bool rtems_bdbuf_wait_for_recycle( rtems_bdbuf_buffer *bd )
 
 static void rtems_bdbuf_wait_for_sync_done( rtems_bdbuf_buffer *bd )
 {
+  rtems_bdbuf_shard *shard = rtems_bdbuf_shard_of_buffer( bd );
+
   while ( true ) {
     switch ( bd->state ) {
       case RTEMS_BDBUF_STATE_CACHED:
@@ -1658,7 +2490,7 @@ static void rtems_bdbuf_wait_for_sync_done( rtems_bdbuf_buffer *bd )
       case RTEMS_BDBUF_STATE_SYNC:
       case RTEMS_BDBUF_STATE_TRANSFER:
       case RTEMS_BDBUF_STATE_TRANSFER_PURGED:
-        rtems_bdbuf_wait( bd, &bdbuf_cache.transfer_waiters );
+        rtems_bdbuf_wait( bd, &shard->transfer_waiters );
         break;
       default:
         rtems_bdbuf_fatal_with_state( bd->state, RTEMS_BDBUF_FATAL_STATE_9 );
@@ -1666,23 +2498,25 @@ static void rtems_bdbuf_wait_for_sync_done( rtems_bdbuf_buffer *bd )
   }
 }
 
-static void rtems_bdbuf_wait_for_buffer( void )
+static void rtems_bdbuf_wait_for_buffer( rtems_bdbuf_shard *shard )
 {
-  if ( !rtems_chain_is_empty( &bdbuf_cache.modified ) ) {
+  if ( !rtems_chain_is_empty( &shard->modified ) ) {
     rtems_bdbuf_wake_swapper();
   }
 
-  rtems_bdbuf_anonymous_wait( &bdbuf_cache.buffer_waiters );
+  rtems_bdbuf_anonymous_wait( shard, &shard->buffer_waiters );
 }
 
 static void rtems_bdbuf_sync_after_access( rtems_bdbuf_buffer *bd )
 {
+  rtems_bdbuf_shard *shard = rtems_bdbuf_shard_of_buffer( bd );
+
   rtems_bdbuf_set_state( bd, RTEMS_BDBUF_STATE_SYNC );
 
-  rtems_chain_append_unprotected( &bdbuf_cache.sync, &bd->link );
+  rtems_chain_append_unprotected( &shard->sync, &bd->link );
 
   if ( bd->waiters ) {
-    rtems_bdbuf_wake( &bdbuf_cache.access_waiters );
+    rtems_bdbuf_wake( &shard->access_waiters );
   }
 
   rtems_bdbuf_wake_swapper();
@@ -1699,21 +2533,23 @@ static void rtems_bdbuf_sync_after_access( rtems_bdbuf_buffer *bd )
       rtems_bdbuf_remove_from_tree( bd );
       rtems_bdbuf_make_free_and_add_to_lru_list( bd );
     }
-    rtems_bdbuf_wake( &bdbuf_cache.buffer_waiters );
+    rtems_bdbuf_wake( &shard->buffer_waiters );
   }
 }
 
 static rtems_bdbuf_buffer *rtems_bdbuf_get_buffer_for_read_ahead(
+  rtems_bdbuf_shard *shard,
   rtems_disk_device *dd,
   rtems_blkdev_bnum  block
 )
 {
   rtems_bdbuf_buffer *bd = NULL;
+  uint32_t            probes = 0;
 
-  bd = rtems_bdbuf_avl_search( &bdbuf_cache.tree, dd, block );
+  bd = rtems_bdbuf_lookup_search( shard, dd, block, &probes );
 
   if ( bd == NULL ) {
-    bd = rtems_bdbuf_get_buffer_from_lru_list( dd, block );
+    bd = rtems_bdbuf_get_buffer_from_lru_list( shard, dd, block, NULL );
 
     if ( bd != NULL ) {
       rtems_bdbuf_group_obtain( bd );
@@ -1729,35 +2565,67 @@ static rtems_bdbuf_buffer *rtems_bdbuf_get_buffer_for_read_ahead(
   return bd;
 }
 
+/**
+ * Counts a hit in the queue of the buffer. In contrast to the least recently
+ * used policy, the 2Q policy does not promote a block on a hit in the recent
+ * queue, since such hits are usually correlated references, e.g. a file read
+ * in chunks smaller than the block size.
+ */
+static void rtems_bdbuf_account_hit(
+  const rtems_bdbuf_buffer *bd,
+  rtems_bdbuf_access_stats *access_stats
+)
+{
+  if (
+    bd->state == RTEMS_BDBUF_STATE_CACHED ||
+    bd->state == RTEMS_BDBUF_STATE_MODIFIED
+  ) {
+    if ( bd->queue == RTEMS_BDBUF_QUEUE_FREQUENT ) {
+      ++access_stats->frequent_hits;
+    } else {
+      ++access_stats->recent_hits;
+    }
+  }
+}
+
 static rtems_bdbuf_buffer *rtems_bdbuf_get_buffer_for_access(
-  rtems_disk_device *dd,
-  rtems_blkdev_bnum  block
+  rtems_bdbuf_shard        *shard,
+  rtems_disk_device        *dd,
+  rtems_blkdev_bnum         block,
+  rtems_bdbuf_access_stats *access_stats
 )
 {
   rtems_bdbuf_buffer *bd = NULL;
 
   do {
-    bd = rtems_bdbuf_avl_search( &bdbuf_cache.tree, dd, block );
+    ++access_stats->lookups;
+    bd = rtems_bdbuf_lookup_search( shard, dd, block, &access_stats->probes );
 
     if ( bd != NULL ) {
       if ( bd->group->bds_per_group != dd->bds_per_group ) {
         if ( rtems_bdbuf_wait_for_recycle( bd ) ) {
           rtems_bdbuf_remove_from_tree_and_lru_list( bd );
           rtems_bdbuf_make_free_and_add_to_lru_list( bd );
-          rtems_bdbuf_wake( &bdbuf_cache.buffer_waiters );
+          rtems_bdbuf_wake( &shard->buffer_waiters );
         }
         bd = NULL;
       }
     } else {
-      bd = rtems_bdbuf_get_buffer_from_lru_list( dd, block );
+      bd = rtems_bdbuf_get_buffer_from_lru_list(
+        shard,
+        dd,
+        block,
+        access_stats
+      );
 
       if ( bd == NULL ) {
-        rtems_bdbuf_wait_for_buffer();
+        rtems_bdbuf_wait_for_buffer( shard );
       }
     }
   } while ( bd == NULL );
 
   rtems_bdbuf_wait_for_access( bd );
+  rtems_bdbuf_account_hit( bd, access_stats );
   rtems_bdbuf_group_obtain( bd );
 
   return bd;
@@ -1785,17 +2653,47 @@ static rtems_status_code rtems_bdbuf_get_media_block(
   return sc;
 }
 
+static void rtems_bdbuf_add_access_stats(
+  rtems_disk_device              *dd,
+  const rtems_bdbuf_access_stats *access_stats
+)
+{
+  dd->stats.lookups += access_stats->lookups;
+  dd->stats.lookup_probes += access_stats->probes;
+  dd->stats.recent_hits += access_stats->recent_hits;
+  dd->stats.frequent_hits += access_stats->frequent_hits;
+  dd->stats.recent_evictions += access_stats->recent_evictions;
+  dd->stats.frequent_evictions += access_stats->frequent_evictions;
+}
+
+/**
+ * Update the access statistics of the device. The statistics are protected by
+ * the cache lock and not by the shard lock.
+ */
+static void rtems_bdbuf_account_access(
+  rtems_disk_device              *dd,
+  const rtems_bdbuf_access_stats *access_stats
+)
+{
+  rtems_bdbuf_lock_cache_nested();
+  rtems_bdbuf_add_access_stats( dd, access_stats );
+  rtems_bdbuf_unlock_cache_nested();
+}
+
 rtems_status_code rtems_bdbuf_get(
   rtems_disk_device   *dd,
   rtems_blkdev_bnum    block,
   rtems_bdbuf_buffer **bd_ptr
 )
 {
-  rtems_status_code   sc = RTEMS_SUCCESSFUL;
-  rtems_bdbuf_buffer *bd = NULL;
-  rtems_blkdev_bnum   media_block;
+  rtems_status_code        sc = RTEMS_SUCCESSFUL;
+  rtems_bdbuf_buffer      *bd = NULL;
+  rtems_blkdev_bnum        media_block;
+  rtems_bdbuf_shard       *shard = rtems_bdbuf_get_shard( dd, block );
+  rtems_bdbuf_access_stats access_stats = { 0 };
 
-  rtems_bdbuf_lock_cache();
+  rtems_bdbuf_lookup_prefetch( shard, dd, block );
+  rtems_bdbuf_lock_shard( shard );
 
   sc = rtems_bdbuf_get_media_block( dd, block, &media_block );
   if ( sc == RTEMS_SUCCESSFUL ) {
@@ -1811,7 +2709,13 @@ rtems_status_code rtems_bdbuf_get(
       );
     }
 
-    bd = rtems_bdbuf_get_buffer_for_access( dd, media_block );
+    bd = rtems_bdbuf_get_buffer_for_access(
+      shard,
+      dd,
+      media_block,
+      &access_stats
+    );
+    rtems_bdbuf_account_access( dd, &access_stats );
 
     switch ( bd->state ) {
       case RTEMS_BDBUF_STATE_CACHED:
@@ -1841,7 +2745,7 @@ rtems_status_code rtems_bdbuf_get(
     }
   }
 
-  rtems_bdbuf_unlock_cache();
+  rtems_bdbuf_unlock_shard( shard );
 
   *bd_ptr = bd;
 
@@ -1867,29 +2771,61 @@ static void rtems_bdbuf_transfer_done(
   rtems_event_transient_send( req->io_task );
 }
 
-static rtems_status_code rtems_bdbuf_execute_transfer_request(
-  rtems_disk_device    *dd,
-  rtems_blkdev_request *req,
-  bool                  cache_locked
+static void rtems_bdbuf_wake_after_transfer(
+  rtems_bdbuf_shard *shard,
+  bool               wake_transfer_waiters,
+  bool               wake_buffer_waiters
 )
 {
-  rtems_status_code sc = RTEMS_SUCCESSFUL;
-  uint32_t          transfer_index = 0;
-  bool              wake_transfer_waiters = false;
-  bool              wake_buffer_waiters = false;
-
-  if ( cache_locked ) {
-    rtems_bdbuf_unlock_cache();
+  if ( wake_transfer_waiters ) {
+    rtems_bdbuf_wake( &shard->transfer_waiters );
   }
 
-  /* The return value will be ignored for transfer requests */
-  dd->ioctl( dd->phys_dev, RTEMS_BLKIO_REQUEST, req );
+  if ( wake_buffer_waiters ) {
+    rtems_bdbuf_wake( &shard->buffer_waiters );
+  }
+}
 
-  /* Wait for transfer request completion */
+/**
+ * Execute the transfer request and finish the transferred buffers.
+ *
+ * @param dd The disk device.
+ * @param req The transfer request.
+ * @param locked_shard The shard locked by the caller or NULL if the caller
+ *   owns no lock.  The buffers of a read request belong to this shard.  The
+ *   buffers of a write request may belong to different shards.
+ */
+static rtems_status_code rtems_bdbuf_execute_transfer_request(
+  rtems_disk_device    *dd,
+  rtems_blkdev_request *req,
+  rtems_bdbuf_shard    *locked_shard
+)
+{
+  rtems_status_code  sc = RTEMS_SUCCESSFUL;
+  uint32_t           transfer_index = 0;
+  bool               wake_transfer_waiters = false;
+  bool               wake_buffer_waiters = false;
+  rtems_bdbuf_shard *shard;
+
+  if ( locked_shard != NULL ) {
+    rtems_bdbuf_unlock_shard( locked_shard );
+  }
+
+  /* The return value will be ignored for transfer requests */
+  dd->ioctl( dd->phys_dev, RTEMS_BLKIO_REQUEST, req );
+
+  /* Wait for transfer request completion */
   rtems_bdbuf_wait_for_transient_event();
   sc = req->status;
 
-  rtems_bdbuf_lock_cache();
+  if ( locked_shard != NULL ) {
+    shard = locked_shard;
+  } else {
+    shard = rtems_bdbuf_shard_of_buffer( req->bufs[ 0 ].user );
+  }
+
+  rtems_bdbuf_lock_shard( shard );
+  rtems_bdbuf_lock_cache_nested();
 
   /* Statistics */
   if ( req->req == RTEMS_BLKDEV_REQ_READ ) {
@@ -1905,9 +2841,27 @@ static rtems_status_code rtems_bdbuf_execute_transfer_request(
     }
   }
 
+  rtems_bdbuf_unlock_cache_nested();
+
   for ( transfer_index = 0; transfer_index < req->bufnum; ++transfer_index ) {
     rtems_bdbuf_buffer *bd = req->bufs[ transfer_index ].user;
-    bool                waiters = bd->waiters;
+    rtems_bdbuf_shard  *bd_shard = rtems_bdbuf_shard_of_buffer( bd );
+    bool                waiters;
+
+    if ( bd_shard != shard ) {
+      rtems_bdbuf_wake_after_transfer(
+        shard,
+        wake_transfer_waiters,
+        wake_buffer_waiters
+      );
+      wake_transfer_waiters = false;
+      wake_buffer_waiters = false;
+      rtems_bdbuf_unlock_shard( shard );
+      shard = bd_shard;
+      rtems_bdbuf_lock_shard( shard );
+    }
+
+    waiters = bd->waiters;
 
     if ( waiters ) {
       wake_transfer_waiters = true;
@@ -1928,16 +2882,18 @@ static rtems_status_code rtems_bdbuf_execute_transfer_request(
     }
   }
 
-  if ( wake_transfer_waiters ) {
-    rtems_bdbuf_wake( &bdbuf_cache.transfer_waiters );
-  }
+  rtems_bdbuf_wake_after_transfer(
+    shard,
+    wake_transfer_waiters,
+    wake_buffer_waiters
+  );
 
-  if ( wake_buffer_waiters ) {
-    rtems_bdbuf_wake( &bdbuf_cache.buffer_waiters );
-  }
+  if ( shard != locked_shard ) {
+    rtems_bdbuf_unlock_shard( shard );
 
-  if ( !cache_locked ) {
-    rtems_bdbuf_unlock_cache();
+    if ( locked_shard != NULL ) {
+      rtems_bdbuf_lock_shard( locked_shard );
+    }
   }
 
   if ( sc == RTEMS_SUCCESSFUL || sc == RTEMS_UNSATISFIED ) {
@@ -1948,6 +2904,7 @@ static rtems_status_code rtems_bdbuf_execute_transfer_request(
 }
 
 static rtems_status_code rtems_bdbuf_execute_read_request(
+  rtems_bdbuf_shard  *shard,
   rtems_disk_device  *dd,
   rtems_bdbuf_buffer *bd,
   uint32_t            transfer_count
@@ -1985,7 +2942,7 @@ static rtems_status_code rtems_bdbuf_execute_read_request(
   while ( transfer_index < transfer_count ) {
     media_block += media_blocks_per_block;
 
-    bd = rtems_bdbuf_get_buffer_for_read_ahead( dd, media_block );
+    bd = rtems_bdbuf_get_buffer_for_read_ahead( shard, dd, media_block );
 
     if ( bd == NULL ) {
       break;
@@ -2007,7 +2964,7 @@ static rtems_status_code rtems_bdbuf_execute_read_request(
 
   req->bufnum = transfer_index;
 
-  return rtems_bdbuf_execute_transfer_request( dd, req, true );
+  return rtems_bdbuf_execute_transfer_request( dd, req, shard );
 }
 
 static bool rtems_bdbuf_is_read_ahead_active( const rtems_disk_device *dd )
@@ -2023,135 +2980,759 @@ static void rtems_bdbuf_read_ahead_cancel( rtems_disk_device *dd )
   }
 }
 
-static void rtems_bdbuf_read_ahead_reset( rtems_disk_device *dd )
-{
-  rtems_bdbuf_read_ahead_cancel( dd );
-  dd->read_ahead.trigger = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
-}
+static bool rtems_bdbuf_has_adaptive_read_ahead( void )
+{
+  return bdbuf_config.read_ahead_streams > 0;
+}
+
+static void rtems_bdbuf_read_ahead_reset( rtems_disk_device *dd )
+{
+  rtems_blkdev_read_ahead_stream *streams = dd->read_ahead.streams;
+  uint32_t                        i;
+
+  rtems_bdbuf_read_ahead_cancel( dd );
+  dd->read_ahead.trigger = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
+
+  if ( streams == NULL ) {
+    return;
+  }
+
+  for ( i = 0; i < bdbuf_config.read_ahead_streams; ++i ) {
+    rtems_blkdev_read_ahead_stream *stream = &streams[ i ];
+
+    stream->nr_blocks = 0;
+    stream->window = 0;
+    ++stream->generation;
+  }
+}
+
+static void rtems_bdbuf_read_ahead_add_to_chain( rtems_disk_device *dd )
+{
+  rtems_status_code    sc;
+  rtems_chain_control *chain = &bdbuf_cache.read_ahead_chain;
+
+  if ( rtems_chain_is_empty( chain ) ) {
+    sc = rtems_event_send(
+      bdbuf_cache.read_ahead_task,
+      RTEMS_BDBUF_READ_AHEAD_WAKE_UP
+    );
+    if ( sc != RTEMS_SUCCESSFUL ) {
+      rtems_bdbuf_fatal( RTEMS_BDBUF_FATAL_RA_WAKE_UP );
+    }
+  }
+
+  rtems_chain_append_unprotected( chain, &dd->read_ahead.node );
+}
+
+static void rtems_bdbuf_check_read_ahead_trigger(
+  rtems_disk_device *dd,
+  rtems_blkdev_bnum  block
+)
+{
+  if (
+    bdbuf_cache.read_ahead_task != 0 && dd->read_ahead.trigger == block &&
+    !rtems_bdbuf_is_read_ahead_active( dd )
+  ) {
+    dd->read_ahead.nr_blocks = RTEMS_DISK_READ_AHEAD_SIZE_AUTO;
+    rtems_bdbuf_read_ahead_add_to_chain( dd );
+  }
+}
+
+static void rtems_bdbuf_set_read_ahead_trigger(
+  rtems_disk_device *dd,
+  rtems_blkdev_bnum  block
+)
+{
+  if ( dd->read_ahead.trigger != block ) {
+    rtems_bdbuf_read_ahead_cancel( dd );
+    dd->read_ahead.trigger = block + 1;
+    dd->read_ahead.next = block + 2;
+  }
+}
+
+/**
+ * Starts a new sequential read stream. The least recently used stream of the
+ * device is reused. The streams of the device are allocated on demand.
+ *
+ * @retval NULL The streams of the device could not be allocated.
+ */
+static rtems_blkdev_read_ahead_stream *rtems_bdbuf_read_ahead_new_stream(
+  rtems_disk_device *dd,
+  rtems_blkdev_bnum  last,
+  uint32_t           window
+)
+{
+  rtems_blkdev_read_ahead        *read_ahead = &dd->read_ahead;
+  rtems_blkdev_read_ahead_stream *stream;
+  uint32_t                        i;
+
+  if ( read_ahead->streams == NULL ) {
+    read_ahead->streams = calloc(
+      bdbuf_config.read_ahead_streams,
+      sizeof( *read_ahead->streams )
+    );
+
+    if ( read_ahead->streams == NULL ) {
+      return NULL;
+    }
+  }
+
+  stream = &read_ahead->streams[ 0 ];
+
+  for ( i = 1; i < bdbuf_config.read_ahead_streams; ++i ) {
+    rtems_blkdev_read_ahead_stream *candidate = &read_ahead->streams[ i ];
+
+    if ( stream->window == 0 ) {
+      break;
+    }
+
+    if (
+      candidate->window == 0 || ( read_ahead->stamp - candidate->age ) >
+                                  ( read_ahead->stamp - stream->age )
+    ) {
+      stream = candidate;
+    }
+  }
+
+  if ( window > bdbuf_config.max_read_ahead_blocks ) {
+    window = bdbuf_config.max_read_ahead_blocks;
+  }
+
+  ++stream->generation;
+  stream->last = last;
+  stream->trigger = last + 1;
+  stream->next = last + 2;
+  stream->nr_blocks = 0;
+  stream->window = window;
+  stream->age = ++read_ahead->stamp;
+  stream->peek = false;
+  stream->issued = false;
+
+  return stream;
+}
+
+/**
+ * Tracks the read of a block in the sequential read streams of the device.
+ * The read-ahead window of a stream grows each time the stream reaches its
+ * trigger block and shrinks if blocks read ahead were recycled before use.
+ */
+static void rtems_bdbuf_read_ahead_track(
+  rtems_disk_device *dd,
+  rtems_blkdev_bnum  block,
+  bool               hit
+)
+{
+  rtems_blkdev_read_ahead        *read_ahead = &dd->read_ahead;
+  rtems_blkdev_read_ahead_stream *stream = NULL;
+  uint32_t                        i;
+
+  if ( bdbuf_cache.read_ahead_task == 0 ) {
+    return;
+  }
+
+  for (
+    i = 0;
+    read_ahead->streams != NULL && i < bdbuf_config.read_ahead_streams;
+    ++i
+  ) {
+    rtems_blkdev_read_ahead_stream *candidate = &read_ahead->streams[ i ];
+
+    if (
+      candidate->window != 0 &&
+      ( block == candidate->last || block == candidate->last + 1 )
+    ) {
+      stream = candidate;
+      break;
+    }
+  }
+
+  if ( stream == NULL ) {
+    if ( !hit ) {
+      rtems_bdbuf_read_ahead_new_stream(
+        dd,
+        block,
+        RTEMS_BDBUF_READ_AHEAD_WINDOW_INITIAL
+      );
+    }
+
+    return;
+  }
+
+  stream->age = ++read_ahead->stamp;
+
+  if ( block == stream->last ) {
+    return;
+  }
+
+  stream->last = block;
+
+  if ( !hit && stream->nr_blocks == 0 ) {
+    if ( stream->issued && block < stream->next ) {
+      stream->window = ( stream->window + 1 ) / 2;
+    } else if ( block >= stream->next ) {
+      stream->trigger = block + 1;
+      stream->next = block + 2;
+    }
+  }
+
+  if ( block == stream->trigger && stream->nr_blocks == 0 ) {
+    if ( stream->issued ) {
+      stream->window *= 2;
+
+      if ( stream->window > bdbuf_config.max_read_ahead_blocks ) {
+        stream->window = bdbuf_config.max_read_ahead_blocks;
+      }
+    }
+
+    stream->nr_blocks = stream->window;
+    stream->peek = false;
+
+    if ( !rtems_bdbuf_is_read_ahead_active( dd ) ) {
+      rtems_bdbuf_read_ahead_add_to_chain( dd );
+    }
+  }
+}
+
+/**
+ * Update the read statistics and the read-ahead state of the device. The
+ * state is protected by the cache lock and not by the shard lock.
+ */
+static void rtems_bdbuf_account_read(
+  rtems_disk_device              *dd,
+  rtems_blkdev_bnum               block,
+  bool                            hit,
+  const rtems_bdbuf_access_stats *access_stats
+)
+{
+  rtems_bdbuf_lock_cache_nested();
+
+  rtems_bdbuf_add_access_stats( dd, access_stats );
+
+  if ( hit ) {
+    ++dd->stats.read_hits;
+  } else {
+    ++dd->stats.read_misses;
+  }
+
+  if ( rtems_bdbuf_has_adaptive_read_ahead() ) {
+    rtems_bdbuf_read_ahead_track( dd, block, hit );
+  } else {
+    if ( !hit ) {
+      rtems_bdbuf_set_read_ahead_trigger( dd, block );
+    }
+
+    rtems_bdbuf_check_read_ahead_trigger( dd, block );
+  }
+
+  rtems_bdbuf_unlock_cache_nested();
+}
+
+rtems_status_code rtems_bdbuf_read(
+  rtems_disk_device   *dd,
+  rtems_blkdev_bnum    block,
+  rtems_bdbuf_buffer **bd_ptr
+)
+{
+  rtems_status_code        sc = RTEMS_SUCCESSFUL;
+  rtems_bdbuf_buffer      *bd = NULL;
+  rtems_blkdev_bnum        media_block;
+  rtems_bdbuf_shard       *shard = rtems_bdbuf_get_shard( dd, block );
+  rtems_bdbuf_access_stats access_stats = { 0 };
+
+  rtems_bdbuf_lookup_prefetch( shard, dd, block );
+  rtems_bdbuf_lock_shard( shard );
+
+  sc = rtems_bdbuf_get_media_block( dd, block, &media_block );
+  if ( sc == RTEMS_SUCCESSFUL ) {
+    if ( rtems_bdbuf_tracer ) {
+      printf(
+        "bdbuf:read: %" PRIu32 " (%" PRIu32 ") (dev = %08x)\n",
+        media_block,
+        block,
+        (unsigned) dd->dev
+      );
+    }
+
+    bd = rtems_bdbuf_get_buffer_for_access(
+      shard,
+      dd,
+      media_block,
+      &access_stats
+    );
+    switch ( bd->state ) {
+      case RTEMS_BDBUF_STATE_CACHED:
+        rtems_bdbuf_account_read( dd, block, true, &access_stats );
+        rtems_bdbuf_set_state( bd, RTEMS_BDBUF_STATE_ACCESS_CACHED );
+        break;
+      case RTEMS_BDBUF_STATE_MODIFIED:
+        rtems_bdbuf_account_read( dd, block, true, &access_stats );
+        rtems_bdbuf_set_state( bd, RTEMS_BDBUF_STATE_ACCESS_MODIFIED );
+        break;
+      case RTEMS_BDBUF_STATE_EMPTY:
+        rtems_bdbuf_account_read( dd, block, false, &access_stats );
+        sc = rtems_bdbuf_execute_read_request( shard, dd, bd, 1 );
+        if ( sc == RTEMS_SUCCESSFUL ) {
+          rtems_bdbuf_extract_from_list( bd );
+          rtems_bdbuf_set_state( bd, RTEMS_BDBUF_STATE_ACCESS_CACHED );
+          rtems_bdbuf_group_obtain( bd );
+        } else {
+          bd = NULL;
+        }
+        break;
+      default:
+        rtems_bdbuf_fatal_with_state( bd->state, RTEMS_BDBUF_FATAL_STATE_4 );
+        break;
+    }
+  }
+
+  rtems_bdbuf_unlock_shard( shard );
+
+  *bd_ptr = bd;
+
+  return sc;
+}
+
+void rtems_bdbuf_peek(
+  rtems_disk_device *dd,
+  rtems_blkdev_bnum  block,
+  uint32_t           nr_blocks
+)
+{
+  rtems_bdbuf_lock_cache();
+
+  if ( bdbuf_cache.read_ahead_enabled && nr_blocks > 0 ) {
+    if ( rtems_bdbuf_has_adaptive_read_ahead() ) {
+      rtems_blkdev_read_ahead_stream *stream;
+
+      /*
+       * The stream continues with the peeked blocks.
+       */
+      stream = rtems_bdbuf_read_ahead_new_stream( dd, block - 1, nr_blocks );
+
+      if ( stream != NULL ) {
+        stream->next = block;
+        stream->nr_blocks = stream->window;
+        stream->peek = true;
+
+        if ( !rtems_bdbuf_is_read_ahead_active( dd ) ) {
+          rtems_bdbuf_read_ahead_add_to_chain( dd );
+        }
+      }
+    } else {
+      rtems_bdbuf_read_ahead_reset( dd );
+      dd->read_ahead.next = block;
+      dd->read_ahead.nr_blocks = nr_blocks;
+      rtems_bdbuf_read_ahead_add_to_chain( dd );
+    }
+  }
+
+  rtems_bdbuf_unlock_cache();
+}
+
+/**
+ * The maximum count of blocks of a direct transfer request.  Larger direct
+ * transfers are split into several requests to bound the stack space of the
+ * request.
+ */
+#define RTEMS_BDBUF_DIRECT_TRANSFER_MAX 64
+
+/**
+ * The visitor of the buffers of the blocks of a direct transfer.  It is
+ * called with the shard lock owned for each block with a buffer in the
+ * cache.  The data is the part of the transfer data of the block.  If the
+ * visitor waited for the buffer, then it returns true and the buffer of the
+ * block is looked up again.
+ */
+typedef bool ( *rtems_bdbuf_direct_visitor )(
+  rtems_bdbuf_shard  *shard,
+  rtems_bdbuf_buffer *bd,
+  uint8_t            *data,
+  size_t              block_size
+);
+
+static void rtems_bdbuf_direct_visit(
+  rtems_disk_device         *dd,
+  rtems_blkdev_bnum          block,
+  uint32_t                   block_count,
+  uint8_t                   *data,
+  rtems_bdbuf_direct_visitor visitor
+)
+{
+  rtems_bdbuf_shard *locked_shard = NULL;
+  uint32_t           block_size = dd->block_size;
+  uint32_t           probes = 0;
+  uint32_t           i;
+
+  for ( i = 0; i < block_count; ++i ) {
+    rtems_bdbuf_shard  *shard = rtems_bdbuf_get_shard( dd, block + i );
+    rtems_blkdev_bnum   media_block;
+    rtems_bdbuf_buffer *bd;
+
+    media_block = rtems_bdbuf_media_block( dd, block + i ) + dd->start;
+
+    if ( shard != locked_shard ) {
+      if ( locked_shard != NULL ) {
+        rtems_bdbuf_unlock_shard( locked_shard );
+      }
+
+      rtems_bdbuf_lock_shard( shard );
+      locked_shard = shard;
+    }
+
+    do {
+      bd = rtems_bdbuf_lookup_search( shard, dd, media_block, &probes );
+    } while (
+      bd != NULL && bd->group->bds_per_group == dd->bds_per_group
+        && ( *visitor )( shard, bd, data + i * block_size, block_size )
+    );
+  }
+
+  if ( locked_shard != NULL ) {
+    rtems_bdbuf_unlock_shard( locked_shard );
+  }
+}
+
+/**
+ * Wait for the transfer of the buffer in progress or until the buffer is
+ * released by its user.  Returns true, if the caller waited, otherwise false.
+ */
+static bool rtems_bdbuf_direct_wait(
+  rtems_bdbuf_shard  *shard,
+  rtems_bdbuf_buffer *bd
+)
+{
+  switch ( bd->state ) {
+    case RTEMS_BDBUF_STATE_ACCESS_CACHED:
+    case RTEMS_BDBUF_STATE_ACCESS_EMPTY:
+    case RTEMS_BDBUF_STATE_ACCESS_MODIFIED:
+    case RTEMS_BDBUF_STATE_ACCESS_PURGED:
+      rtems_bdbuf_wait( bd, &shard->access_waiters );
+      return true;
+    case RTEMS_BDBUF_STATE_SYNC:
+    case RTEMS_BDBUF_STATE_TRANSFER:
+    case RTEMS_BDBUF_STATE_TRANSFER_PURGED:
+      rtems_bdbuf_wait( bd, &shard->transfer_waiters );
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Copy the data of a buffer with valid data to the transfer data of a direct
+ * read since it may be more recent than the data on the device.
+ */
+static bool rtems_bdbuf_direct_copy_from_cache(
+  rtems_bdbuf_shard  *shard,
+  rtems_bdbuf_buffer *bd,
+  uint8_t            *data,
+  size_t              block_size
+)
+{
+  switch ( bd->state ) {
+    case RTEMS_BDBUF_STATE_CACHED:
+    case RTEMS_BDBUF_STATE_MODIFIED:
+      memcpy( data, bd->buffer, block_size );
+      return false;
+    default:
+      return rtems_bdbuf_direct_wait( shard, bd );
+  }
+}
+
+/**
+ * Copy the transfer data of a successful direct write to a buffer with valid
+ * data.
+ */
+static bool rtems_bdbuf_direct_copy_to_cache(
+  rtems_bdbuf_shard  *shard,
+  rtems_bdbuf_buffer *bd,
+  uint8_t            *data,
+  size_t              block_size
+)
+{
+  switch ( bd->state ) {
+    case RTEMS_BDBUF_STATE_CACHED:
+    case RTEMS_BDBUF_STATE_MODIFIED:
+      memcpy( bd->buffer, data, block_size );
+      return false;
+    default:
+      return rtems_bdbuf_direct_wait( shard, bd );
+  }
+}
+
+/**
+ * Write a modified buffer of a block of a direct read back to the device and
+ * wait for the transfer of a buffer in progress.  Otherwise, a buffer could
+ * be written to the device and recycled while the direct read is in progress.
+ * The direct read would then return the stale data of the device since the
+ * buffer is no longer available to update the transfer data.
+ */
+static bool rtems_bdbuf_direct_write_back(
+  rtems_bdbuf_shard  *shard,
+  rtems_bdbuf_buffer *bd,
+  uint8_t            *data,
+  size_t              block_size
+)
+{
+  (void) data;
+  (void) block_size;
+
+  switch ( bd->state ) {
+    case RTEMS_BDBUF_STATE_MODIFIED:
+      rtems_bdbuf_request_sync_for_modified_buffer( bd );
+      rtems_bdbuf_wait( bd, &shard->transfer_waiters );
+      return true;
+    case RTEMS_BDBUF_STATE_SYNC:
+    case RTEMS_BDBUF_STATE_TRANSFER:
+    case RTEMS_BDBUF_STATE_TRANSFER_PURGED:
+      rtems_bdbuf_wait( bd, &shard->transfer_waiters );
+      return true;
+    default:
+      /*
+       * The buffer is either consistent with the device or in use.  The
+       * data of a buffer in use is copied to the transfer data after the
+       * user released it.
+       */
+      return false;
+  }
+}
+
+/**
+ * Discard the buffer of a block of a direct write.  Before the transfer, this
+ * prevents that a modified buffer is written to the device after the transfer
+ * and overwrites the new data.  After a failed transfer, the content of the
+ * block on the device is unknown.
+ */
+static bool rtems_bdbuf_direct_discard(
+  rtems_bdbuf_shard  *shard,
+  rtems_bdbuf_buffer *bd,
+  uint8_t            *data,
+  size_t              block_size
+)
+{
+  bool wake_buffer_waiters;
+
+  (void) data;
+  (void) block_size;
+
+  switch ( bd->state ) {
+    case RTEMS_BDBUF_STATE_MODIFIED:
+      rtems_bdbuf_group_release( bd );
+      /* Fall through */
+    case RTEMS_BDBUF_STATE_CACHED:
+      rtems_bdbuf_extract_from_list( bd );
+      wake_buffer_waiters = bd->waiters == 0;
+      rtems_bdbuf_discard_buffer( bd );
+
+      if ( wake_buffer_waiters ) {
+        rtems_bdbuf_wake( &shard->buffer_waiters );
+      }
+
+      return false;
+    default:
+      return rtems_bdbuf_direct_wait( shard, bd );
+  }
+}
+
+/**
+ * Transfer the blocks directly between the device and the transfer data with
+ * one scatter/gather request for each part of at most
+ * RTEMS_BDBUF_DIRECT_TRANSFER_MAX blocks.  The caller owns no lock.
+ */
+static rtems_status_code rtems_bdbuf_execute_direct_request(
+  rtems_disk_device      *dd,
+  rtems_blkdev_bnum       block,
+  uint32_t                block_count,
+  uint8_t                *data,
+  rtems_blkdev_request_op req_op
+)
+{
+  rtems_status_code     sc = RTEMS_SUCCESSFUL;
+  rtems_blkdev_request *req;
+  uint32_t              block_size = dd->block_size;
+  uint32_t              transfer_count;
+  uint32_t              transfer_index;
+
+  req = bdbuf_alloc(
+    rtems_bdbuf_read_request_size( RTEMS_BDBUF_DIRECT_TRANSFER_MAX )
+  );
+
+  while ( sc == RTEMS_SUCCESSFUL && block_count > 0 ) {
+    transfer_count = block_count;
+
+    if ( transfer_count > RTEMS_BDBUF_DIRECT_TRANSFER_MAX ) {
+      transfer_count = RTEMS_BDBUF_DIRECT_TRANSFER_MAX;
+    }
+
+    req->req = req_op;
+    req->done = rtems_bdbuf_transfer_done;
+    req->io_task = rtems_task_self();
+    req->bufnum = transfer_count;
+
+    for ( transfer_index = 0; transfer_index < transfer_count;
+          ++transfer_index ) {
+      rtems_blkdev_sg_buffer *sg = &req->bufs[ transfer_index ];
+
+      sg->user = NULL;
+      sg->block = rtems_bdbuf_media_block( dd, block + transfer_index ) +
+                  dd->start;
+      sg->length = block_size;
+      sg->buffer = data + transfer_index * block_size;
+    }
+
+    if ( rtems_bdbuf_tracer ) {
+      printf(
+        "bdbuf:direct-%s: %" PRIu32 " (%" PRIu32 ") (dev = %08x)\n",
+        req_op == RTEMS_BLKDEV_REQ_READ ? "read" : "write",
+        block,
+        transfer_count,
+        (unsigned) dd->dev
+      );
+    }
+
+    /* The return value will be ignored for transfer requests */
+    dd->ioctl( dd->phys_dev, RTEMS_BLKIO_REQUEST, req );
 
-static void rtems_bdbuf_read_ahead_add_to_chain( rtems_disk_device *dd )
-{
-  rtems_status_code    sc;
-  rtems_chain_control *chain = &bdbuf_cache.read_ahead_chain;
+    /* Wait for transfer request completion */
+    rtems_bdbuf_wait_for_transient_event();
+    sc = req->status;
 
-  if ( rtems_chain_is_empty( chain ) ) {
-    sc = rtems_event_send(
-      bdbuf_cache.read_ahead_task,
-      RTEMS_BDBUF_READ_AHEAD_WAKE_UP
-    );
-    if ( sc != RTEMS_SUCCESSFUL ) {
-      rtems_bdbuf_fatal( RTEMS_BDBUF_FATAL_RA_WAKE_UP );
+    rtems_bdbuf_lock_cache();
+
+    ++dd->stats.direct_transfers;
+
+    if ( req_op == RTEMS_BLKDEV_REQ_READ ) {
+      dd->stats.read_blocks += transfer_count;
+      if ( sc != RTEMS_SUCCESSFUL ) {
+        ++dd->stats.read_errors;
+      }
+    } else {
+      dd->stats.write_blocks += transfer_count;
+      ++dd->stats.write_transfers;
+      if ( sc != RTEMS_SUCCESSFUL ) {
+        ++dd->stats.write_errors;
+      }
     }
+
+    rtems_bdbuf_unlock_cache();
+
+    block += transfer_count;
+    block_count -= transfer_count;
+    data += transfer_count * block_size;
   }
 
-  rtems_chain_append_unprotected( chain, &dd->read_ahead.node );
+  if ( sc != RTEMS_SUCCESSFUL ) {
+    sc = RTEMS_IO_ERROR;
+  }
+
+  return sc;
 }
 
-static void rtems_bdbuf_check_read_ahead_trigger(
-  rtems_disk_device *dd,
-  rtems_blkdev_bnum  block
+static rtems_status_code rtems_bdbuf_check_direct_blocks(
+  const rtems_disk_device *dd,
+  rtems_blkdev_bnum        block,
+  uint32_t                 block_count
 )
 {
-  if (
-    bdbuf_cache.read_ahead_task != 0 && dd->read_ahead.trigger == block &&
-    !rtems_bdbuf_is_read_ahead_active( dd )
-  ) {
-    dd->read_ahead.nr_blocks = RTEMS_DISK_READ_AHEAD_SIZE_AUTO;
-    rtems_bdbuf_read_ahead_add_to_chain( dd );
+  if ( block > dd->block_count || block_count > dd->block_count - block ) {
+    return RTEMS_INVALID_ID;
   }
+
+  return RTEMS_SUCCESSFUL;
 }
 
-static void rtems_bdbuf_set_read_ahead_trigger(
+rtems_status_code rtems_bdbuf_read_direct(
   rtems_disk_device *dd,
-  rtems_blkdev_bnum  block
+  rtems_blkdev_bnum  block,
+  uint32_t           block_count,
+  void              *buffer
 )
 {
-  if ( dd->read_ahead.trigger != block ) {
-    rtems_bdbuf_read_ahead_cancel( dd );
-    dd->read_ahead.trigger = block + 1;
-    dd->read_ahead.next = block + 2;
+  rtems_status_code sc;
+
+  sc = rtems_bdbuf_check_direct_blocks( dd, block, block_count );
+  if ( sc != RTEMS_SUCCESSFUL || block_count == 0 ) {
+    return sc;
   }
-}
 
-rtems_status_code rtems_bdbuf_read(
-  rtems_disk_device   *dd,
-  rtems_blkdev_bnum    block,
-  rtems_bdbuf_buffer **bd_ptr
-)
-{
-  rtems_status_code   sc = RTEMS_SUCCESSFUL;
-  rtems_bdbuf_buffer *bd = NULL;
-  rtems_blkdev_bnum   media_block;
+  rtems_bdbuf_direct_visit(
+    dd,
+    block,
+    block_count,
+    buffer,
+    rtems_bdbuf_direct_write_back
+  );
 
-  rtems_bdbuf_lock_cache();
+  sc = rtems_bdbuf_execute_direct_request(
+    dd,
+    block,
+    block_count,
+    buffer,
+    RTEMS_BLKDEV_REQ_READ
+  );
 
-  sc = rtems_bdbuf_get_media_block( dd, block, &media_block );
   if ( sc == RTEMS_SUCCESSFUL ) {
-    if ( rtems_bdbuf_tracer ) {
-      printf(
-        "bdbuf:read: %" PRIu32 " (%" PRIu32 ") (dev = %08x)\n",
-        media_block,
-        block,
-        (unsigned) dd->dev
-      );
-    }
-
-    bd = rtems_bdbuf_get_buffer_for_access( dd, media_block );
-    switch ( bd->state ) {
-      case RTEMS_BDBUF_STATE_CACHED:
-        ++dd->stats.read_hits;
-        rtems_bdbuf_set_state( bd, RTEMS_BDBUF_STATE_ACCESS_CACHED );
-        break;
-      case RTEMS_BDBUF_STATE_MODIFIED:
-        ++dd->stats.read_hits;
-        rtems_bdbuf_set_state( bd, RTEMS_BDBUF_STATE_ACCESS_MODIFIED );
-        break;
-      case RTEMS_BDBUF_STATE_EMPTY:
-        ++dd->stats.read_misses;
-        rtems_bdbuf_set_read_ahead_trigger( dd, block );
-        sc = rtems_bdbuf_execute_read_request( dd, bd, 1 );
-        if ( sc == RTEMS_SUCCESSFUL ) {
-          rtems_bdbuf_set_state( bd, RTEMS_BDBUF_STATE_ACCESS_CACHED );
-          rtems_chain_extract_unprotected( &bd->link );
-          rtems_bdbuf_group_obtain( bd );
-        } else {
-          bd = NULL;
-        }
-        break;
-      default:
-        rtems_bdbuf_fatal_with_state( bd->state, RTEMS_BDBUF_FATAL_STATE_4 );
-        break;
-    }
-
-    rtems_bdbuf_check_read_ahead_trigger( dd, block );
+    rtems_bdbuf_direct_visit(
+      dd,
+      block,
+      block_count,
+      buffer,
+      rtems_bdbuf_direct_copy_from_cache
+    );
   }
 
-  rtems_bdbuf_unlock_cache();
-
-  *bd_ptr = bd;
-
   return sc;
 }
 
-void rtems_bdbuf_peek(
+rtems_status_code rtems_bdbuf_write_direct(
   rtems_disk_device *dd,
   rtems_blkdev_bnum  block,
-  uint32_t           nr_blocks
+  uint32_t           block_count,
+  const void        *buffer
 )
 {
-  rtems_bdbuf_lock_cache();
+  rtems_status_code sc;
+  uint8_t          *data = RTEMS_DECONST( void *, buffer );
 
-  if ( bdbuf_cache.read_ahead_enabled && nr_blocks > 0 ) {
-    rtems_bdbuf_read_ahead_reset( dd );
-    dd->read_ahead.next = block;
-    dd->read_ahead.nr_blocks = nr_blocks;
-    rtems_bdbuf_read_ahead_add_to_chain( dd );
+  sc = rtems_bdbuf_check_direct_blocks( dd, block, block_count );
+  if ( sc != RTEMS_SUCCESSFUL || block_count == 0 ) {
+    return sc;
   }
 
-  rtems_bdbuf_unlock_cache();
+  /*
+   * The transfer overwrites the blocks, so the data of the buffers is no
+   * longer needed.  Buffers may be read from the device while the transfer is
+   * in progress.  Update them with the new data after a successful transfer.
+   */
+  rtems_bdbuf_direct_visit(
+    dd,
+    block,
+    block_count,
+    data,
+    rtems_bdbuf_direct_discard
+  );
+
+  sc = rtems_bdbuf_execute_direct_request(
+    dd,
+    block,
+    block_count,
+    data,
+    RTEMS_BLKDEV_REQ_WRITE
+  );
+
+  rtems_bdbuf_direct_visit(
+    dd,
+    block,
+    block_count,
+    data,
+    sc == RTEMS_SUCCESSFUL ?
+      rtems_bdbuf_direct_copy_to_cache : rtems_bdbuf_direct_discard
+  );
+
+  return sc;
 }
 
-static rtems_status_code rtems_bdbuf_check_bd_and_lock_cache(
+static rtems_status_code rtems_bdbuf_check_bd_and_lock_shard(
   rtems_bdbuf_buffer *bd,
   const char         *kind
 )
@@ -2163,7 +3744,7 @@ static rtems_status_code rtems_bdbuf_check_bd_and_lock_cache(
     printf( "bdbuf:%s: %" PRIu32 "\n", kind, bd->block );
     rtems_bdbuf_show_users( kind, bd );
   }
-  rtems_bdbuf_lock_cache();
+  rtems_bdbuf_lock_shard( rtems_bdbuf_shard_of_buffer( bd ) );
 
   return RTEMS_SUCCESSFUL;
 }
@@ -2172,7 +3753,7 @@ rtems_status_code rtems_bdbuf_release( rtems_bdbuf_buffer *bd )
 {
   rtems_status_code sc = RTEMS_SUCCESSFUL;
 
-  sc = rtems_bdbuf_check_bd_and_lock_cache( bd, "release" );
+  sc = rtems_bdbuf_check_bd_and_lock_shard( bd, "release" );
   if ( sc != RTEMS_SUCCESSFUL ) {
     return sc;
   }
@@ -2197,7 +3778,7 @@ rtems_status_code rtems_bdbuf_release( rtems_bdbuf_buffer *bd )
     rtems_bdbuf_show_usage();
   }
 
-  rtems_bdbuf_unlock_cache();
+  rtems_bdbuf_unlock_shard( rtems_bdbuf_shard_of_buffer( bd ) );
 
   return RTEMS_SUCCESSFUL;
 }
@@ -2206,7 +3787,7 @@ rtems_status_code rtems_bdbuf_release_modified( rtems_bdbuf_buffer *bd )
 {
   rtems_status_code sc = RTEMS_SUCCESSFUL;
 
-  sc = rtems_bdbuf_check_bd_and_lock_cache( bd, "release modified" );
+  sc = rtems_bdbuf_check_bd_and_lock_shard( bd, "release modified" );
   if ( sc != RTEMS_SUCCESSFUL ) {
     return sc;
   }
@@ -2229,7 +3810,7 @@ rtems_status_code rtems_bdbuf_release_modified( rtems_bdbuf_buffer *bd )
     rtems_bdbuf_show_usage();
   }
 
-  rtems_bdbuf_unlock_cache();
+  rtems_bdbuf_unlock_shard( rtems_bdbuf_shard_of_buffer( bd ) );
 
   return RTEMS_SUCCESSFUL;
 }
@@ -2238,7 +3819,7 @@ rtems_status_code rtems_bdbuf_sync( rtems_bdbuf_buffer *bd )
 {
   rtems_status_code sc = RTEMS_SUCCESSFUL;
 
-  sc = rtems_bdbuf_check_bd_and_lock_cache( bd, "sync" );
+  sc = rtems_bdbuf_check_bd_and_lock_shard( bd, "sync" );
   if ( sc != RTEMS_SUCCESSFUL ) {
     return sc;
   }
@@ -2261,7 +3842,7 @@ rtems_status_code rtems_bdbuf_sync( rtems_bdbuf_buffer *bd )
     rtems_bdbuf_show_usage();
   }
 
-  rtems_bdbuf_unlock_cache();
+  rtems_bdbuf_unlock_shard( rtems_bdbuf_shard_of_buffer( bd ) );
 
   return RTEMS_SUCCESSFUL;
 }
@@ -2397,7 +3978,7 @@ static void rtems_bdbuf_swapout_write( rtems_bdbuf_swapout_transfer *transfer )
         rtems_bdbuf_execute_transfer_request(
           dd,
           &transfer->write_req,
-          false
+          NULL
         );
 
         transfer->write_req.status = RTEMS_RESOURCE_IN_USE;
@@ -2427,6 +4008,7 @@ static void rtems_bdbuf_swapout_write( rtems_bdbuf_swapout_transfer *transfer )
  * Process the modified list of buffers. There is a sync or modified list that
  * needs to be handled so we have a common function to do the work.
  *
+ * @param shard The shard of the list. The shard is locked by the caller.
  * @param dd_ptr Pointer to the device to handle. If BDBUF_INVALID_DEV no
  * device is selected so select the device of the first buffer to be written to
  * disk.
@@ -2438,6 +4020,7 @@ static void rtems_bdbuf_swapout_write( rtems_bdbuf_swapout_transfer *transfer )
  *                    amount.
  */
 static void rtems_bdbuf_swapout_modified_processing(
+  rtems_bdbuf_shard   *shard,
   rtems_disk_device  **dd_ptr,
   rtems_chain_control *chain,
   rtems_chain_control *transfer,
@@ -2473,7 +4056,7 @@ static void rtems_bdbuf_swapout_modified_processing(
        */
       if (
         sync_all || ( sync_active && ( *dd_ptr == bd->dd ) ) ||
-        rtems_bdbuf_has_buffer_waiters()
+        rtems_bdbuf_has_buffer_waiters( shard )
       ) {
         bd->hold_timer = 0;
       }
@@ -2548,7 +4131,8 @@ static void rtems_bdbuf_swapout_modified_processing(
  * a device at a time. The task level loop will repeat this operation while
  * there are buffers to be written. If the transfer fails place the buffers
  * back on the modified list and try again later. The cache is unlocked while
- * the buffers are being written to disk.
+ * the buffers are being written to disk. The lists of the shards are processed
+ * one shard at a time, so that at most one shard is locked.
  *
  * @param timer_delta It update_timers is true update the timers by this
  *                    amount.
@@ -2567,6 +4151,7 @@ static bool rtems_bdbuf_swapout_processing(
   rtems_bdbuf_swapout_worker *worker;
   bool                        transfered_buffers = false;
   bool                        sync_active;
+  uint32_t                    i;
 
   rtems_bdbuf_lock_cache();
 
@@ -2608,37 +4193,51 @@ static bool rtems_bdbuf_swapout_processing(
     transfer->dd = bdbuf_cache.sync_device;
   }
 
+  rtems_bdbuf_unlock_cache();
+
   /*
    * If we have any buffers in the sync queue move them to the modified
    * list. The first sync buffer will select the device we use.
    */
-  rtems_bdbuf_swapout_modified_processing(
-    &transfer->dd,
-    &bdbuf_cache.sync,
-    &transfer->bds,
-    true,
-    false,
-    timer_delta
-  );
+  for ( i = 0; i < bdbuf_cache.shard_count; ++i ) {
+    rtems_bdbuf_shard *shard = &bdbuf_cache.shards[ i ];
+
+    rtems_bdbuf_lock_shard( shard );
+    rtems_bdbuf_swapout_modified_processing(
+      shard,
+      &transfer->dd,
+      &shard->sync,
+      &transfer->bds,
+      true,
+      false,
+      timer_delta
+    );
+    rtems_bdbuf_unlock_shard( shard );
+  }
 
   /*
-   * Process the cache's modified list.
+   * Process the cache's modified lists.
    */
-  rtems_bdbuf_swapout_modified_processing(
-    &transfer->dd,
-    &bdbuf_cache.modified,
-    &transfer->bds,
-    sync_active,
-    update_timers,
-    timer_delta
-  );
+  for ( i = 0; i < bdbuf_cache.shard_count; ++i ) {
+    rtems_bdbuf_shard *shard = &bdbuf_cache.shards[ i ];
+
+    rtems_bdbuf_lock_shard( shard );
+    rtems_bdbuf_swapout_modified_processing(
+      shard,
+      &transfer->dd,
+      &shard->modified,
+      &transfer->bds,
+      sync_active,
+      update_timers,
+      timer_delta
+    );
+    rtems_bdbuf_unlock_shard( shard );
+  }
 
   /*
-   * We have all the buffers that have been modified for this device so the
-   * cache can be unlocked because the state of each buffer has been set to
-   * TRANSFER.
+   * We have all the buffers that have been modified for this device and the
+   * state of each buffer has been set to TRANSFER.
    */
-  rtems_bdbuf_unlock_cache();
 
   /*
    * If there are buffers to transfer to the media transfer them.
@@ -2807,7 +4406,10 @@ static rtems_task rtems_bdbuf_swapout_task( rtems_task_argument arg )
   rtems_task_exit();
 }
 
-static void rtems_bdbuf_purge_list( rtems_chain_control *purge_list )
+static void rtems_bdbuf_purge_list(
+  rtems_bdbuf_shard   *shard,
+  rtems_chain_control *purge_list
+)
 {
   bool              wake_buffer_waiters = false;
   rtems_chain_node *node = NULL;
@@ -2823,50 +4425,78 @@ static void rtems_bdbuf_purge_list( rtems_chain_control *purge_list )
   }
 
   if ( wake_buffer_waiters ) {
-    rtems_bdbuf_wake( &bdbuf_cache.buffer_waiters );
+    rtems_bdbuf_wake( &shard->buffer_waiters );
+  }
+}
+
+static void rtems_bdbuf_gather_buffer_for_purge(
+  rtems_bdbuf_shard   *shard,
+  rtems_chain_control *purge_list,
+  rtems_bdbuf_buffer  *bd
+)
+{
+  switch ( bd->state ) {
+    case RTEMS_BDBUF_STATE_FREE:
+    case RTEMS_BDBUF_STATE_EMPTY:
+    case RTEMS_BDBUF_STATE_ACCESS_PURGED:
+    case RTEMS_BDBUF_STATE_TRANSFER_PURGED:
+      break;
+    case RTEMS_BDBUF_STATE_SYNC:
+      rtems_bdbuf_wake( &shard->transfer_waiters );
+      /* Fall through */
+    case RTEMS_BDBUF_STATE_MODIFIED:
+      rtems_bdbuf_group_release( bd );
+      /* Fall through */
+    case RTEMS_BDBUF_STATE_CACHED:
+      rtems_bdbuf_extract_from_list( bd );
+      rtems_chain_append_unprotected( purge_list, &bd->link );
+      break;
+    case RTEMS_BDBUF_STATE_TRANSFER:
+      rtems_bdbuf_set_state( bd, RTEMS_BDBUF_STATE_TRANSFER_PURGED );
+      break;
+    case RTEMS_BDBUF_STATE_ACCESS_CACHED:
+    case RTEMS_BDBUF_STATE_ACCESS_EMPTY:
+    case RTEMS_BDBUF_STATE_ACCESS_MODIFIED:
+      rtems_bdbuf_set_state( bd, RTEMS_BDBUF_STATE_ACCESS_PURGED );
+      break;
+    default:
+      rtems_bdbuf_fatal( RTEMS_BDBUF_FATAL_STATE_11 );
   }
 }
 
 static void rtems_bdbuf_gather_for_purge(
+  rtems_bdbuf_shard       *shard,
   rtems_chain_control     *purge_list,
   const rtems_disk_device *dd
 )
 {
   rtems_bdbuf_buffer  *stack[ RTEMS_BDBUF_AVL_MAX_HEIGHT ];
   rtems_bdbuf_buffer **prev = stack;
-  rtems_bdbuf_buffer  *cur = bdbuf_cache.tree;
+  rtems_bdbuf_buffer  *cur = shard->tree;
+
+  if ( rtems_bdbuf_has_hash_index() ) {
+    uint32_t i;
+
+    /*
+     * The gathering does not change the index, so a linear scan of the slots
+     * visits each buffer exactly once.
+     */
+    for ( i = 0; i <= shard->hash_mask; ++i ) {
+      rtems_bdbuf_buffer *bd = shard->hash_slots[ i ].bd;
+
+      if ( bd != NULL && bd->dd == dd ) {
+        rtems_bdbuf_gather_buffer_for_purge( shard, purge_list, bd );
+      }
+    }
+
+    return;
+  }
 
   *prev = NULL;
 
   while ( cur != NULL ) {
     if ( cur->dd == dd ) {
-      switch ( cur->state ) {
-        case RTEMS_BDBUF_STATE_FREE:
-        case RTEMS_BDBUF_STATE_EMPTY:
-        case RTEMS_BDBUF_STATE_ACCESS_PURGED:
-        case RTEMS_BDBUF_STATE_TRANSFER_PURGED:
-          break;
-        case RTEMS_BDBUF_STATE_SYNC:
-          rtems_bdbuf_wake( &bdbuf_cache.transfer_waiters );
-          /* Fall through */
-        case RTEMS_BDBUF_STATE_MODIFIED:
-          rtems_bdbuf_group_release( cur );
-          /* Fall through */
-        case RTEMS_BDBUF_STATE_CACHED:
-          rtems_chain_extract_unprotected( &cur->link );
-          rtems_chain_append_unprotected( purge_list, &cur->link );
-          break;
-        case RTEMS_BDBUF_STATE_TRANSFER:
-          rtems_bdbuf_set_state( cur, RTEMS_BDBUF_STATE_TRANSFER_PURGED );
-          break;
-        case RTEMS_BDBUF_STATE_ACCESS_CACHED:
-        case RTEMS_BDBUF_STATE_ACCESS_EMPTY:
-        case RTEMS_BDBUF_STATE_ACCESS_MODIFIED:
-          rtems_bdbuf_set_state( cur, RTEMS_BDBUF_STATE_ACCESS_PURGED );
-          break;
-        default:
-          rtems_bdbuf_fatal( RTEMS_BDBUF_FATAL_STATE_11 );
-      }
+      rtems_bdbuf_gather_buffer_for_purge( shard, purge_list, cur );
     }
 
     if ( cur->avl.left != NULL ) {
@@ -2899,21 +4529,47 @@ static void rtems_bdbuf_gather_for_purge(
   }
 }
 
+/**
+ * Purge the buffers of the device. All shards and the cache are locked by the
+ * caller.
+ */
 static void rtems_bdbuf_do_purge_dev( rtems_disk_device *dd )
 {
-  rtems_chain_control purge_list;
+  uint32_t i;
 
-  rtems_chain_initialize_empty( &purge_list );
   rtems_bdbuf_read_ahead_reset( dd );
-  rtems_bdbuf_gather_for_purge( &purge_list, dd );
-  rtems_bdbuf_purge_list( &purge_list );
+
+  for ( i = 0; i < bdbuf_cache.shard_count; ++i ) {
+    rtems_bdbuf_shard  *shard = &bdbuf_cache.shards[ i ];
+    rtems_chain_control purge_list;
+
+    rtems_chain_initialize_empty( &purge_list );
+    rtems_bdbuf_gather_for_purge( shard, &purge_list, dd );
+    rtems_bdbuf_purge_list( shard, &purge_list );
+  }
 }
 
 void rtems_bdbuf_purge_dev( rtems_disk_device *dd )
 {
-  rtems_bdbuf_lock_cache();
+  rtems_bdbuf_lock_all();
   rtems_bdbuf_do_purge_dev( dd );
+  rtems_bdbuf_unlock_all();
+}
+
+void rtems_bdbuf_release_read_ahead( rtems_disk_device *dd )
+{
+  rtems_blkdev_read_ahead_stream *streams = dd->read_ahead.streams;
+
+  if ( streams == NULL ) {
+    return;
+  }
+
+  rtems_bdbuf_lock_cache();
+  rtems_bdbuf_read_ahead_reset( dd );
+  dd->read_ahead.streams = NULL;
   rtems_bdbuf_unlock_cache();
+
+  free( streams );
 }
 
 rtems_status_code rtems_bdbuf_set_block_size(
@@ -2932,7 +4588,7 @@ rtems_status_code rtems_bdbuf_set_block_size(
     (void) rtems_bdbuf_syncdev( dd );
   }
 
-  rtems_bdbuf_lock_cache();
+  rtems_bdbuf_lock_all();
 
   if ( block_size > 0 ) {
     size_t bds_per_group = rtems_bdbuf_bds_per_group( block_size );
@@ -2968,11 +4624,159 @@ rtems_status_code rtems_bdbuf_set_block_size(
     sc = RTEMS_INVALID_NUMBER;
   }
 
-  rtems_bdbuf_unlock_cache();
+  rtems_bdbuf_unlock_all();
 
   return sc;
 }
 
+/**
+ * Reads the blocks ahead. Each contiguous run of blocks which are not cached
+ * is read by one scatter/gather request.
+ *
+ * @return The count of issued requests.
+ */
+static uint32_t rtems_bdbuf_execute_read_ahead_runs(
+  rtems_bdbuf_shard *shard,
+  rtems_disk_device *dd,
+  rtems_blkdev_bnum  block,
+  uint32_t           transfer_count
+)
+{
+  rtems_blkdev_bnum end = block + transfer_count;
+  uint32_t          transfers = 0;
+
+  while ( block < end ) {
+    rtems_blkdev_bnum   media_block = rtems_bdbuf_media_block( dd, block ) +
+                                      dd->start;
+    rtems_bdbuf_buffer *bd = rtems_bdbuf_get_buffer_for_read_ahead(
+      shard,
+      dd,
+      media_block
+    );
+
+    /*
+     * The buffers of the blocks read by a request are in the lookup engine
+     * afterwards, so that they are skipped here.
+     */
+    if ( bd != NULL ) {
+      rtems_bdbuf_execute_read_request( shard, dd, bd, end - block );
+      ++transfers;
+    }
+
+    ++block;
+  }
+
+  return transfers;
+}
+
+/**
+ * Carries out the pending read-ahead request of one sequential read stream of
+ * the device. The device is appended to the read-ahead chain again if further
+ * streams have a pending request. The cache is locked by the caller.
+ */
+static void rtems_bdbuf_read_ahead_streams( rtems_disk_device *dd )
+{
+  rtems_blkdev_read_ahead_stream *stream = NULL;
+  rtems_blkdev_bnum               block;
+  uint32_t                        nr_blocks;
+  uint32_t                        generation;
+  bool                            peek;
+  rtems_bdbuf_shard              *shard;
+  uint32_t                        i;
+
+  rtems_chain_set_off_chain( &dd->read_ahead.node );
+
+  for (
+    i = 0;
+    dd->read_ahead.streams != NULL && i < bdbuf_config.read_ahead_streams;
+    ++i
+  ) {
+    rtems_blkdev_read_ahead_stream *candidate = &dd->read_ahead.streams[ i ];
+
+    if ( candidate->nr_blocks != 0 ) {
+      if ( stream != NULL ) {
+        rtems_chain_append_unprotected(
+          &bdbuf_cache.read_ahead_chain,
+          &dd->read_ahead.node
+        );
+        break;
+      }
+
+      stream = candidate;
+    }
+  }
+
+  if ( stream == NULL ) {
+    return;
+  }
+
+  block = stream->next;
+  nr_blocks = stream->nr_blocks;
+  generation = stream->generation;
+  peek = stream->peek;
+  stream->nr_blocks = 0;
+
+  /*
+   * The read-ahead state is protected by the cache lock, the buffers are
+   * protected by the shard lock.
+   */
+  shard = rtems_bdbuf_get_shard( dd, block );
+  rtems_bdbuf_unlock_cache();
+  rtems_bdbuf_lock_shard( shard );
+
+  if ( block < dd->block_count ) {
+    uint32_t transfer_count = nr_blocks;
+    uint32_t blocks_until_end_of_disk = dd->block_count - block;
+    uint32_t max_transfer_count = rtems_bdbuf_shard_transfer_limit(
+      block,
+      bdbuf_config.max_read_ahead_blocks
+    );
+    uint32_t transfers;
+
+    if ( transfer_count > max_transfer_count ) {
+      transfer_count = max_transfer_count;
+    }
+
+    if ( transfer_count > blocks_until_end_of_disk ) {
+      transfer_count = blocks_until_end_of_disk;
+    }
+
+    rtems_bdbuf_lock_cache_nested();
+
+    if ( stream->generation == generation ) {
+      stream->issued = true;
+
+      if ( transfer_count < blocks_until_end_of_disk ) {
+        stream->trigger = block + transfer_count / 2;
+        stream->next = block + transfer_count;
+      } else {
+        stream->trigger = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
+      }
+    }
+
+    rtems_bdbuf_unlock_cache_nested();
+
+    transfers = rtems_bdbuf_execute_read_ahead_runs(
+      shard,
+      dd,
+      block,
+      transfer_count
+    );
+
+    rtems_bdbuf_lock_cache_nested();
+    dd->stats.read_ahead_transfers += transfers;
+
+    if ( peek ) {
+      ++dd->stats.read_ahead_peeks;
+    }
+
+    rtems_bdbuf_unlock_cache_nested();
+  }
+
+  rtems_bdbuf_unlock_shard( shard );
+  rtems_bdbuf_lock_cache();
+}
+
 static rtems_task rtems_bdbuf_read_ahead_task( rtems_task_argument arg )
 {
   (void) arg;
@@ -2991,26 +4795,47 @@ static rtems_task rtems_bdbuf_read_ahead_task( rtems_task_argument arg )
         rtems_disk_device,
         read_ahead.node
       );
-      rtems_blkdev_bnum block = dd->read_ahead.next;
-      rtems_blkdev_bnum media_block = 0;
-      rtems_status_code sc = rtems_bdbuf_get_media_block(
-        dd,
-        block,
-        &media_block
-      );
+      rtems_blkdev_bnum  block;
+      uint32_t           nr_blocks;
+      rtems_blkdev_bnum  media_block = 0;
+      rtems_bdbuf_shard *shard;
+      rtems_status_code  sc;
+
+      if ( rtems_bdbuf_has_adaptive_read_ahead() ) {
+        rtems_bdbuf_read_ahead_streams( dd );
+        continue;
+      }
 
+      block = dd->read_ahead.next;
+      nr_blocks = dd->read_ahead.nr_blocks;
+      shard = rtems_bdbuf_get_shard( dd, block );
       rtems_chain_set_off_chain( &dd->read_ahead.node );
 
+      /*
+       * The read-ahead state is protected by the cache lock, the buffers are
+       * protected by the shard lock.
+       */
+      rtems_bdbuf_unlock_cache();
+      rtems_bdbuf_lock_shard( shard );
+
+      sc = rtems_bdbuf_get_media_block( dd, block, &media_block );
+
       if ( sc == RTEMS_SUCCESSFUL ) {
         rtems_bdbuf_buffer *bd = rtems_bdbuf_get_buffer_for_read_ahead(
+          shard,
           dd,
           media_block
         );
 
         if ( bd != NULL ) {
-          uint32_t transfer_count = dd->read_ahead.nr_blocks;
+          uint32_t transfer_count = nr_blocks;
           uint32_t blocks_until_end_of_disk = dd->block_count - block;
-          uint32_t max_transfer_count = bdbuf_config.max_read_ahead_blocks;
+          uint32_t max_transfer_count = rtems_bdbuf_shard_transfer_limit(
+            block,
+            bdbuf_config.max_read_ahead_blocks
+          );
+
+          rtems_bdbuf_lock_cache_nested();
 
           if ( transfer_count == RTEMS_DISK_READ_AHEAD_SIZE_AUTO ) {
             transfer_count = blocks_until_end_of_disk;
@@ -3035,11 +4860,17 @@ static rtems_task rtems_bdbuf_read_ahead_task( rtems_task_argument arg )
           }
 
           ++dd->stats.read_ahead_transfers;
-          rtems_bdbuf_execute_read_request( dd, bd, transfer_count );
+          rtems_bdbuf_unlock_cache_nested();
+          rtems_bdbuf_execute_read_request( shard, dd, bd, transfer_count );
         }
       } else {
+        rtems_bdbuf_lock_cache_nested();
         dd->read_ahead.trigger = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
+        rtems_bdbuf_unlock_cache_nested();
       }
+
+      rtems_bdbuf_unlock_shard( shard );
+      rtems_bdbuf_lock_cache();
     }
 
     rtems_bdbuf_unlock_cache();
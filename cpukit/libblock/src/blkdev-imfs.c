@@ -269,6 +269,7 @@ static void rtems_blkdev_imfs_destroy( IMFS_jnode_t *node )
 
   (void) rtems_bdbuf_syncdev( dd );
   rtems_bdbuf_purge_dev( dd );
+  rtems_bdbuf_release_read_ahead( dd );
 
   if ( ctx->fd >= 0 ) {
     close( ctx->fd );
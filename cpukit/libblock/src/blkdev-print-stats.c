@@ -66,6 +66,11 @@ void rtems_blkdev_print_stats(
     " WRITE TRANSFERS      | %" PRIu32 "\n"
     " WRITE BLOCKS         | %" PRIu32 "\n"
     " WRITE ERRORS         | %" PRIu32 "\n"
+    " RECENT HITS          | %" PRIu32 "\n"
+    " FREQUENT HITS        | %" PRIu32 "\n"
+    " RECENT EVICTIONS     | %" PRIu32 "\n"
+    " FREQUENT EVICTIONS   | %" PRIu32 "\n"
+    " DIRECT TRANSFERS     | %" PRIu32 "\n"
     "----------------------+--------------------------------------------------------\n",
     media_block_size,
     media_block_count,
@@ -78,6 +83,11 @@ void rtems_blkdev_print_stats(
     stats->read_errors,
     stats->write_transfers,
     stats->write_blocks,
-    stats->write_errors
+    stats->write_errors,
+    stats->recent_hits,
+    stats->frequent_hits,
+    stats->recent_evictions,
+    stats->frequent_evictions,
+    stats->direct_transfers
   );
 }
@@ -321,6 +321,8 @@ rtems_status_code rtems_disk_create_log(
 
 static void free_disk_device( rtems_disk_device *dd )
 {
+  rtems_bdbuf_release_read_ahead( dd );
+
   if ( is_physical_disk( dd ) ) {
     ( *dd->ioctl )( dd, RTEMS_BLKIO_DELETED, NULL );
   }
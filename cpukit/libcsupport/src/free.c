@@ -92,10 +92,25 @@ void free( void *ptr )
   }
 
   /*
-   *  Do not attempt to free memory if in a critical section or ISR.
+   *  Do not attempt to free memory if in a critical section or ISR.  The
+   *  per-processor malloc cache may still take the object since this needs no
+   *  allocator lock.
    */
   if ( _Malloc_System_state() != MALLOC_SYSTEM_STATE_NORMAL ) {
-    _Malloc_Deferred_free( ptr );
+    if (
+      !_Malloc_Cache_Is_enabled() ||
+      !_Malloc_Cache_free_deferred( RTEMS_Malloc_Heap, ptr )
+    ) {
+      _Malloc_Deferred_free( ptr );
+    }
+
+    return;
+  }
+
+  if (
+    _Malloc_Cache_Is_enabled() &&
+    _Malloc_Cache_free( RTEMS_Malloc_Heap, ptr )
+  ) {
     return;
   }
 
@@ -53,6 +53,89 @@ Malloc_System_state _Malloc_System_state( void );
 
 void _Malloc_Process_deferred_frees( void );
 
+/**
+ * @brief Allocates an object from the malloc cache of the current processor.
+ *
+ * The cache is refilled from the heap if necessary.
+ *
+ * @param heap is the C Program Heap.
+ *
+ * @param size is the allocation size in bytes.
+ *
+ * @return Returns the begin address of the allocated memory area, or NULL if
+ *   the size is not covered by a size class or the heap is exhausted.
+ */
+void *_Malloc_Cache_allocate( Heap_Control *heap, size_t size );
+
+/**
+ * @brief Puts the object into the malloc cache of the current processor.
+ *
+ * If the magazine is full, then a batch of objects is returned to the heap.
+ *
+ * An object which is already in the magazine of the current processor leads
+ * to the RTEMS_FATAL_SOURCE_INVALID_HEAP_FREE fatal error.  If
+ * HEAP_PROTECTION is defined, then the magazines of all processors are
+ * checked.
+ *
+ * @param heap is the C Program Heap.
+ *
+ * @param ptr is the begin address of the memory area to free.
+ *
+ * @retval true The object was put into the cache.
+ *
+ * @retval false The object is not covered by a size class.
+ */
+bool _Malloc_Cache_free( Heap_Control *heap, void *ptr );
+
+/**
+ * @brief Puts the object into the malloc cache of the current processor if
+ *   space is available.
+ *
+ * This function does not use the allocator lock, so it may be used in
+ * interrupt context and with thread dispatching disabled.
+ *
+ * @param heap is the C Program Heap.
+ *
+ * @param ptr is the begin address of the memory area to free.
+ *
+ * @retval true The object was put into the cache.
+ *
+ * @retval false The object is not covered by a size class or the magazine is
+ *   full.  The free shall be deferred.
+ */
+bool _Malloc_Cache_free_deferred( Heap_Control *heap, void *ptr );
+
+/**
+ * @brief Checks if the per-processor malloc caches are enabled.
+ *
+ * @retval true The caches are enabled.
+ *
+ * @retval false Otherwise.
+ */
+static inline bool _Malloc_Cache_Is_enabled( void )
+{
+  return _Malloc_Cache_configuration.object_count != 0;
+}
+
+/**
+ * @brief Gets the malloc cache control of the processor.
+ *
+ * @param cpu_index is the index of the processor.
+ *
+ * @return Returns the malloc cache control of the processor.
+ */
+static inline Malloc_Cache_control *_Malloc_Cache_Get_control(
+  uint32_t cpu_index
+)
+{
+  const Malloc_Cache_configuration *config;
+
+  config = &_Malloc_Cache_configuration;
+
+  return (Malloc_Cache_control *)
+    ( (char *) config->controls + cpu_index * config->control_size );
+}
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
@@ -0,0 +1,448 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup MallocSupport
+ *
+ * @brief This source file contains the implementation of the per-processor
+ *   malloc caches.
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#ifdef RTEMS_NEWLIB
+#include "malloc_p.h"
+
+#include <limits.h>
+
+#include <rtems/config.h>
+#include <rtems/score/apimutex.h>
+#include <rtems/score/percpu.h>
+
+#define MALLOC_CACHE_MINIMUM_SIZE \
+  ( (uintptr_t) 1 << MALLOC_CACHE_MINIMUM_SIZE_LOG2 )
+
+#define MALLOC_CACHE_LIMIT_SIZE_LOG2 \
+  ( MALLOC_CACHE_MINIMUM_SIZE_LOG2 + MALLOC_CACHE_CLASS_COUNT )
+
+static uint32_t _Malloc_Cache_Log2( uintptr_t value )
+{
+  return (uint32_t) ( sizeof( unsigned long ) * CHAR_BIT - 1 ) -
+    (uint32_t) __builtin_clzl( (unsigned long) value );
+}
+
+static void **_Malloc_Cache_Magazine(
+  Malloc_Cache_control *control,
+  uint32_t              class_index
+)
+{
+  return &control->Objects[
+    class_index * _Malloc_Cache_configuration.object_count
+  ];
+}
+
+static uint32_t _Malloc_Cache_Batch_size( void )
+{
+  uint32_t batch_size;
+
+  batch_size = _Malloc_Cache_configuration.object_count / 2;
+
+  if ( batch_size == 0 ) {
+    batch_size = 1;
+  } else if ( batch_size > MALLOC_CACHE_BATCH_MAXIMUM ) {
+    batch_size = MALLOC_CACHE_BATCH_MAXIMUM;
+  }
+
+  return batch_size;
+}
+
+static Malloc_Cache_control *_Malloc_Cache_Acquire(
+  ISR_lock_Context *lock_context
+)
+{
+  Malloc_Cache_control *control;
+
+  _ISR_lock_ISR_disable( lock_context );
+  control = _Malloc_Cache_Get_control( _Per_CPU_Get_index( _Per_CPU_Get() ) );
+  _ISR_lock_Acquire( &control->Lock, lock_context );
+
+  return control;
+}
+
+static void _Malloc_Cache_Release(
+  Malloc_Cache_control *control,
+  ISR_lock_Context     *lock_context
+)
+{
+  _ISR_lock_Release_and_ISR_enable( &control->Lock, lock_context );
+}
+
+static RTEMS_NO_RETURN void _Malloc_Cache_Invalid_free( const void *ptr )
+{
+  rtems_fatal(
+    RTEMS_FATAL_SOURCE_INVALID_HEAP_FREE,
+    (rtems_fatal_code) ptr
+  );
+}
+
+static void _Malloc_Cache_Free_batch(
+  Heap_Control *heap,
+  void        **batch,
+  uint32_t      count
+)
+{
+  uint32_t i;
+
+  _RTEMS_Lock_allocator();
+  _Malloc_Process_deferred_frees();
+
+  for ( i = 0; i < count; ++i ) {
+    if ( !_Heap_Free( heap, batch[ i ] ) ) {
+      _Malloc_Cache_Invalid_free( batch[ i ] );
+    }
+  }
+
+  _RTEMS_Unlock_allocator();
+}
+
+void _Malloc_Cache_initialize( void )
+{
+  uint32_t cpu_max;
+  uint32_t cpu_index;
+
+  cpu_max = rtems_configuration_get_maximum_processors();
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    Malloc_Cache_control *control;
+
+    control = _Malloc_Cache_Get_control( cpu_index );
+    _ISR_lock_Initialize( &control->Lock, "Malloc Cache" );
+  }
+}
+
+void *_Malloc_Cache_allocate( Heap_Control *heap, size_t size )
+{
+  Malloc_Cache_control *control;
+  ISR_lock_Context      lock_context;
+  void                **magazine;
+  void                 *batch[ MALLOC_CACHE_BATCH_MAXIMUM ];
+  uint32_t              class_index;
+  uint32_t              object_count;
+  uint32_t              count;
+  uint32_t              batch_size;
+  uint32_t              i;
+  void                 *p;
+
+  if ( size > ( (size_t) 1 << ( MALLOC_CACHE_LIMIT_SIZE_LOG2 - 1 ) ) ) {
+    return NULL;
+  }
+
+  if ( size <= MALLOC_CACHE_MINIMUM_SIZE ) {
+    class_index = 0;
+  } else {
+    class_index = _Malloc_Cache_Log2( size - 1 ) + 1 -
+      MALLOC_CACHE_MINIMUM_SIZE_LOG2;
+  }
+
+  control = _Malloc_Cache_Acquire( &lock_context );
+  count = control->count[ class_index ];
+
+  if ( count > 0 ) {
+    --count;
+    control->count[ class_index ] = count;
+    ++control->Stats.hits;
+    p = _Malloc_Cache_Magazine( control, class_index )[ count ];
+    _Malloc_Cache_Release( control, &lock_context );
+    return p;
+  }
+
+  ++control->Stats.misses;
+  _Malloc_Cache_Release( control, &lock_context );
+
+  /*
+   * Refill with a batch of objects so that the allocator lock is acquired
+   * only once for several allocations.  The thread may migrate to another
+   * processor while the lock is owned, so the batch is put into the cache of
+   * the processor which owns the thread afterwards.
+   */
+  batch_size = _Malloc_Cache_Batch_size();
+  _RTEMS_Lock_allocator();
+  _Malloc_Process_deferred_frees();
+
+  for ( i = 0; i < batch_size; ++i ) {
+    batch[ i ] = _Heap_Allocate(
+      heap,
+      (uintptr_t) 1 << ( class_index + MALLOC_CACHE_MINIMUM_SIZE_LOG2 )
+    );
+
+    if ( batch[ i ] == NULL ) {
+      break;
+    }
+  }
+
+  _RTEMS_Unlock_allocator();
+
+  if ( i == 0 ) {
+    return NULL;
+  }
+
+  --i;
+  p = batch[ i ];
+  object_count = _Malloc_Cache_configuration.object_count;
+
+  control = _Malloc_Cache_Acquire( &lock_context );
+  magazine = _Malloc_Cache_Magazine( control, class_index );
+  count = control->count[ class_index ];
+
+  while ( i > 0 && count < object_count ) {
+    --i;
+    magazine[ count ] = batch[ i ];
+    ++count;
+  }
+
+  control->count[ class_index ] = count;
+  _Malloc_Cache_Release( control, &lock_context );
+
+  if ( i > 0 ) {
+    _Malloc_Cache_Free_batch( heap, batch, i );
+  }
+
+  return p;
+}
+
+static bool _Malloc_Cache_Contains(
+  Malloc_Cache_control *control,
+  uint32_t              class_index,
+  const void           *ptr
+)
+{
+  void   **magazine;
+  uint32_t count;
+  uint32_t i;
+
+  magazine = _Malloc_Cache_Magazine( control, class_index );
+  count = control->count[ class_index ];
+
+  for ( i = 0; i < count; ++i ) {
+    if ( magazine[ i ] == ptr ) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+#if defined(HEAP_PROTECTION)
+/*
+ * With heap protection, check the caches of all processors, so that each
+ * double free is reported as it would be by the heap.
+ */
+static void _Malloc_Cache_Check_all(
+  uint32_t    class_index,
+  const void *ptr
+)
+{
+  uint32_t cpu_max;
+  uint32_t cpu_index;
+
+  cpu_max = rtems_configuration_get_maximum_processors();
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    Malloc_Cache_control *control;
+    ISR_lock_Context      lock_context;
+    bool                  contains;
+
+    control = _Malloc_Cache_Get_control( cpu_index );
+    _ISR_lock_ISR_disable_and_acquire( &control->Lock, &lock_context );
+    contains = _Malloc_Cache_Contains( control, class_index, ptr );
+    _ISR_lock_Release_and_ISR_enable( &control->Lock, &lock_context );
+
+    if ( contains ) {
+      _Malloc_Cache_Invalid_free( ptr );
+    }
+  }
+}
+#endif
+
+static bool _Malloc_Cache_Put(
+  Heap_Control *heap,
+  void         *ptr,
+  bool          may_flush
+)
+{
+  Malloc_Cache_control *control;
+  ISR_lock_Context      lock_context;
+  void                **magazine;
+  void                 *batch[ MALLOC_CACHE_BATCH_MAXIMUM ];
+  uintptr_t             size;
+  uint32_t              class_index;
+  uint32_t              count;
+  uint32_t              batch_size;
+  uint32_t              i;
+
+  /*
+   * The caller owns the memory area, so the heap block of the area cannot
+   * change concurrently and the allocator lock is not necessary.  Invalid
+   * areas are left to the heap which reports them.
+   */
+  if ( !_Heap_Size_of_alloc_area( heap, ptr, &size ) ) {
+    return false;
+  }
+
+  if (
+    size < MALLOC_CACHE_MINIMUM_SIZE ||
+    _Malloc_Cache_Log2( size ) >= MALLOC_CACHE_LIMIT_SIZE_LOG2
+  ) {
+    return false;
+  }
+
+  class_index = _Malloc_Cache_Log2( size ) - MALLOC_CACHE_MINIMUM_SIZE_LOG2;
+  batch_size = 0;
+
+#if defined(HEAP_PROTECTION)
+  _Malloc_Cache_Check_all( class_index, ptr );
+#endif
+
+  control = _Malloc_Cache_Acquire( &lock_context );
+
+  /*
+   * An object in the cache is still allocated from the view of the heap, so
+   * the heap cannot detect a double free of it.
+   */
+  if ( _Malloc_Cache_Contains( control, class_index, ptr ) ) {
+    _Malloc_Cache_Release( control, &lock_context );
+    _Malloc_Cache_Invalid_free( ptr );
+  }
+  magazine = _Malloc_Cache_Magazine( control, class_index );
+  count = control->count[ class_index ];
+
+  if ( count >= _Malloc_Cache_configuration.object_count ) {
+    if ( !may_flush ) {
+      _Malloc_Cache_Release( control, &lock_context );
+      return false;
+    }
+
+    batch_size = _Malloc_Cache_Batch_size();
+    count -= batch_size;
+
+    for ( i = 0; i < batch_size; ++i ) {
+      batch[ i ] = magazine[ count + i ];
+    }
+
+    ++control->Stats.flushes;
+  }
+
+  magazine[ count ] = ptr;
+  control->count[ class_index ] = count + 1;
+  ++control->Stats.frees;
+  _Malloc_Cache_Release( control, &lock_context );
+
+  if ( batch_size > 0 ) {
+    _Malloc_Cache_Free_batch( heap, batch, batch_size );
+  }
+
+  return true;
+}
+
+bool _Malloc_Cache_free( Heap_Control *heap, void *ptr )
+{
+  return _Malloc_Cache_Put( heap, ptr, true );
+}
+
+bool _Malloc_Cache_free_deferred( Heap_Control *heap, void *ptr )
+{
+  return _Malloc_Cache_Put( heap, ptr, false );
+}
+
+void rtems_malloc_cache_flush( void )
+{
+  Heap_Control *heap;
+  uint32_t      cpu_max;
+  uint32_t      cpu_index;
+
+  if ( !_Malloc_Cache_Is_enabled() ) {
+    return;
+  }
+
+  heap = RTEMS_Malloc_Heap;
+  cpu_max = rtems_configuration_get_maximum_processors();
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    Malloc_Cache_control *control;
+    uint32_t              class_index;
+
+    control = _Malloc_Cache_Get_control( cpu_index );
+
+    for (
+      class_index = 0;
+      class_index < MALLOC_CACHE_CLASS_COUNT;
+      ++class_index
+    ) {
+      uint32_t batch_size;
+
+      do {
+        ISR_lock_Context lock_context;
+        void           **magazine;
+        void            *batch[ MALLOC_CACHE_BATCH_MAXIMUM ];
+        uint32_t         count;
+        uint32_t         i;
+
+        _ISR_lock_ISR_disable_and_acquire( &control->Lock, &lock_context );
+        magazine = _Malloc_Cache_Magazine( control, class_index );
+        count = control->count[ class_index ];
+        batch_size = count;
+
+        if ( batch_size > MALLOC_CACHE_BATCH_MAXIMUM ) {
+          batch_size = MALLOC_CACHE_BATCH_MAXIMUM;
+        }
+
+        count -= batch_size;
+
+        for ( i = 0; i < batch_size; ++i ) {
+          batch[ i ] = magazine[ count + i ];
+        }
+
+        control->count[ class_index ] = count;
+
+        if ( batch_size > 0 ) {
+          ++control->Stats.flushes;
+        }
+
+        _ISR_lock_Release_and_ISR_enable( &control->Lock, &lock_context );
+
+        if ( batch_size > 0 ) {
+          _Malloc_Cache_Free_batch( heap, batch, batch_size );
+        }
+      } while ( batch_size > 0 );
+    }
+  }
+}
+#endif
@@ -38,8 +38,11 @@
 #endif
 
 #include <rtems/malloc.h>
+#include <rtems/config.h>
 #include <rtems/score/protectedheap.h>
 
+#include "malloc_p.h"
+
 int malloc_info( Heap_Information_block *the_info )
 {
   if ( !the_info ) {
@@ -49,3 +52,45 @@ int malloc_info( Heap_Information_block *the_info )
   _Protected_heap_Get_information( RTEMS_Malloc_Heap, the_info );
   return 0;
 }
+
+rtems_status_code rtems_malloc_cache_get_information(
+  uint32_t                        cpu_index,
+  rtems_malloc_cache_information *info
+)
+{
+  Malloc_Cache_control *control;
+  ISR_lock_Context      lock_context;
+  uint32_t              cached_objects;
+  size_t                class_index;
+
+  if ( info == NULL ) {
+    return RTEMS_INVALID_ADDRESS;
+  }
+
+  if ( !_Malloc_Cache_Is_enabled() ) {
+    return RTEMS_NOT_CONFIGURED;
+  }
+
+  if ( cpu_index >= rtems_configuration_get_maximum_processors() ) {
+    return RTEMS_INVALID_NUMBER;
+  }
+
+  control = _Malloc_Cache_Get_control( cpu_index );
+  cached_objects = 0;
+
+  _ISR_lock_ISR_disable_and_acquire( &control->Lock, &lock_context );
+  *info = control->Stats;
+
+  for (
+    class_index = 0;
+    class_index < MALLOC_CACHE_CLASS_COUNT;
+    ++class_index
+  ) {
+    cached_objects += control->count[ class_index ];
+  }
+
+  _ISR_lock_Release_and_ISR_enable( &control->Lock, &lock_context );
+
+  info->cached_objects = cached_objects;
+  return RTEMS_SUCCESSFUL;
+}
@@ -27,6 +27,7 @@
 
 #include "fat.h"
 #include "fat_fat_operations.h"
+#include "fat_file.h"
 
 static int
  _fat_block_release(fat_fs_info_t *fs_info);
@@ -150,6 +151,183 @@ fat_buf_release(fat_fs_info_t *fs_info)
     return RC_OK;
 }
 
+/* fat_fat_cache_write_back --
+ *     Write a modified FAT cache entry back.  The FAT copies are updated by
+ *     fat_buf_release().
+ *
+ * PARAMETERS:
+ *     fs_info  - FS info
+ *     entry    - FAT cache entry
+ *
+ * RETURNS:
+ *     RC_OK on success, or -1 if error occurred
+ *     and errno set appropriately
+ */
+static int
+fat_fat_cache_write_back(fat_fs_info_t         *fs_info,
+                         fat_fat_cache_entry_t *entry)
+{
+    ssize_t ret;
+
+    ret = fat_sector_write(fs_info, entry->sec_num, 0, fs_info->vol.bps,
+                           entry->buf);
+    if (ret < 0)
+        return -1;
+
+    entry->modified = false;
+    fs_info->fat_c.write_backs++;
+    return RC_OK;
+}
+
+/* fat_fat_buf_access --
+ *     Get the data of a sector of the active File Allocation Table.  Use
+ *     fat_fat_buf_mark_modified() to indicate a modification of the data.
+ *
+ * PARAMETERS:
+ *     fs_info  - FS info
+ *     sec_num  - sector number of the active FAT
+ *     sec_buf  - the sector data
+ *
+ * RETURNS:
+ *     RC_OK on success, or -1 if error occurred
+ *     and errno set appropriately
+ */
+int
+fat_fat_buf_access(fat_fs_info_t  *fs_info,
+                   const uint32_t  sec_num,
+                   uint8_t       **sec_buf)
+{
+    fat_fat_cache_t       *fat_c = &fs_info->fat_c;
+    fat_fat_cache_entry_t *entry;
+    fat_fat_cache_entry_t *victim;
+    uint32_t               i;
+    ssize_t                ret;
+
+    if (fat_c->count == 0)
+        return fat_buf_access(fs_info, sec_num, FAT_OP_TYPE_READ, sec_buf);
+
+    entry = fat_c->last;
+    if (entry->valid && entry->sec_num == sec_num)
+    {
+        fat_c->hits++;
+        entry->last_use = ++fat_c->stamp;
+        *sec_buf = entry->buf;
+        return RC_OK;
+    }
+
+    victim = &fat_c->entries[0];
+    for (i = 0; i < fat_c->count; i++)
+    {
+        entry = &fat_c->entries[i];
+
+        if (entry->valid && entry->sec_num == sec_num)
+        {
+            fat_c->hits++;
+            fat_c->last = entry;
+            entry->last_use = ++fat_c->stamp;
+            *sec_buf = entry->buf;
+            return RC_OK;
+        }
+
+        if (!entry->valid)
+            victim = entry;
+        else if (victim->valid && entry->last_use < victim->last_use)
+            victim = entry;
+    }
+
+    fat_c->misses++;
+
+    if (victim->valid && victim->modified)
+    {
+        if (fat_fat_cache_write_back(fs_info, victim) != RC_OK)
+            return -1;
+    }
+
+    victim->valid = false;
+    ret = _fat_block_read(fs_info, sec_num, 0, fs_info->vol.bps, victim->buf);
+    if (ret < 0)
+        return -1;
+
+    victim->sec_num = sec_num;
+    victim->valid = true;
+    victim->modified = false;
+    victim->last_use = ++fat_c->stamp;
+    fat_c->last = victim;
+    *sec_buf = victim->buf;
+    return RC_OK;
+}
+
+/* fat_init_fat_cache --
+ *     Allocate the FAT cache.
+ *
+ * PARAMETERS:
+ *     fs_info  - FS info
+ *     count    - count of sectors to cache, zero disables the FAT cache
+ *
+ * RETURNS:
+ *     RC_OK on success, or -1 if error occurred
+ *     and errno set appropriately
+ */
+int
+fat_init_fat_cache(fat_fs_info_t *fs_info, uint32_t count)
+{
+    fat_fat_cache_t *fat_c = &fs_info->fat_c;
+    uint32_t         i;
+
+    if (count == 0)
+        return RC_OK;
+
+    fat_c->entries = calloc(count, sizeof(*fat_c->entries));
+    if (fat_c->entries == NULL)
+        rtems_set_errno_and_return_minus_one(ENOMEM);
+
+    fat_c->bufs = calloc(count, fs_info->vol.bps);
+    if (fat_c->bufs == NULL)
+    {
+        free(fat_c->entries);
+        fat_c->entries = NULL;
+        rtems_set_errno_and_return_minus_one(ENOMEM);
+    }
+
+    for (i = 0; i < count; i++)
+        fat_c->entries[i].buf = fat_c->bufs + i * fs_info->vol.bps;
+
+    fat_c->last = &fat_c->entries[0];
+    fat_c->count = count;
+    return RC_OK;
+}
+
+/* fat_fat_cache_sync --
+ *     Write all modified FAT cache entries back.
+ *
+ * PARAMETERS:
+ *     fs_info  - FS info
+ *
+ * RETURNS:
+ *     RC_OK on success, or -1 if error occurred
+ *     and errno set appropriately
+ */
+int
+fat_fat_cache_sync(fat_fs_info_t *fs_info)
+{
+    fat_fat_cache_t *fat_c = &fs_info->fat_c;
+    int              rc = RC_OK;
+    uint32_t         i;
+
+    for (i = 0; i < fat_c->count; i++)
+    {
+        fat_fat_cache_entry_t *entry = &fat_c->entries[i];
+
+        if (entry->valid && entry->modified)
+        {
+            if (fat_fat_cache_write_back(fs_info, entry) != RC_OK)
+                rc = -1;
+        }
+    }
+
+    return rc;
+}
+
 /* _fat_block_read --
  *     This function reads 'count' bytes from device filesystem is mounted on,
  *     starts at 'start+offset' position where 'start' computed in sectors
@@ -300,6 +478,91 @@ fat_sector_write(
     return cmpltd;
 }
 
+/* fat_cluster_read_direct --
+ *     This function reads 'count' bytes from device filesystem is mounted
+ *     on, starts at 'start_cln+offset' where 'start_cln' is the first of
+ *     clusters which are contiguous on disk and 'offset' may exceed the
+ *     cluster size.  Runs of at least FAT_DIRECT_IO_MIN_BLOCKS whole blocks
+ *     are read directly into the user buffer bypassing the block cache if
+ *     the buffer is aligned to the cache line size.
+ *
+ * PARAMETERS:
+ *     fs_info   - FS info
+ *     start_cln - cluster num to start read from
+ *     offset    - offset inside the clusters starting at 'start_cln'
+ *     count     - count of bytes to read
+ *     buff      - buffer provided by user
+ *
+ * RETURNS:
+ *     bytes read on success, or -1 if error occurred
+ *     and errno set appropriately
+ */
+ssize_t
+fat_cluster_read_direct(
+    fat_fs_info_t                        *fs_info,
+    const uint32_t                        start_cln,
+    const uint32_t                        offset,
+    const uint32_t                        count,
+    void                                 *buff)
+{
+    rtems_status_code   sc = RTEMS_SUCCESSFUL;
+    uint32_t            cur_blk = fat_cluster_num_to_block_num(fs_info, start_cln);
+    uint32_t            ofs_blk = offset & (fs_info->vol.bytes_per_block - 1);
+    uint32_t            bytes_to_read = count;
+    uint32_t            blk_cnt;
+    uint32_t            sec_num;
+    uint8_t            *buffer = buff;
+    ssize_t             cmpltd = 0;
+    ssize_t             ret;
+    uint32_t            c;
+
+    cur_blk += offset >> fs_info->vol.bytes_per_block_log2;
+
+    while (bytes_to_read > 0)
+    {
+        blk_cnt = bytes_to_read >> fs_info->vol.bytes_per_block_log2;
+
+        if ((ofs_blk == 0) && (blk_cnt >= FAT_DIRECT_IO_MIN_BLOCKS) &&
+            fat_is_direct_io_aligned(&buffer[cmpltd],
+                blk_cnt << fs_info->vol.bytes_per_block_log2))
+        {
+            /* the cached block may be accessed and modified */
+            if (fat_buf_release(fs_info) != RC_OK)
+                return -1;
+
+            sc = rtems_bdbuf_read_direct(fs_info->vol.dd, cur_blk, blk_cnt,
+                                         &buffer[cmpltd]);
+            if (sc != RTEMS_SUCCESSFUL)
+                rtems_set_errno_and_return_minus_one(EIO);
+
+            c = blk_cnt << fs_info->vol.bytes_per_block_log2;
+            cur_blk += blk_cnt;
+        }
+        else
+        {
+            c = MIN(bytes_to_read, (fs_info->vol.bytes_per_block - ofs_blk));
+            sec_num = fat_block_num_to_sector_num(fs_info, cur_blk) +
+                      (ofs_blk >> fs_info->vol.sec_log2);
+
+            ret = _fat_block_read(fs_info,
+                                  sec_num,
+                                  ofs_blk & (fs_info->vol.bps - 1),
+                                  c,
+                                  &buffer[cmpltd]);
+            if (ret < 0)
+                return -1;
+
+            ++cur_blk;
+        }
+
+        bytes_to_read -= c;
+        cmpltd += c;
+        ofs_blk = 0;
+    }
+
+    return cmpltd;
+}
+
 static ssize_t
  fat_block_set (
      fat_fs_info_t                        *fs_info,
@@ -460,6 +723,85 @@ fat_cluster_write(
       return bytes_written;
 }
 
+/* fat_cluster_write_direct --
+ *     This function writes 'count' bytes to device filesystem is mounted
+ *     on, starts at 'start_cln+offset' where 'start_cln' is the first of
+ *     clusters which are contiguous on disk and 'offset' may exceed the
+ *     cluster size.  Runs of at least FAT_DIRECT_IO_MIN_BLOCKS whole blocks
+ *     are written directly from the user buffer bypassing the block cache if
+ *     the buffer is aligned to the cache line size.
+ *
+ * PARAMETERS:
+ *     fs_info   - FS info
+ *     start_cln - cluster num to start write to
+ *     offset    - offset inside the clusters starting at 'start_cln'
+ *     count     - count of bytes to write
+ *     buff      - buffer provided by user
+ *
+ * RETURNS:
+ *     bytes written on success, or -1 if error occurred
+ *     and errno set appropriately
+ */
+ssize_t
+fat_cluster_write_direct(
+    fat_fs_info_t                        *fs_info,
+    const uint32_t                        start_cln,
+    const uint32_t                        offset,
+    const uint32_t                        count,
+    const void                           *buff)
+{
+    rtems_status_code   sc = RTEMS_SUCCESSFUL;
+    uint32_t            cur_blk = fat_cluster_num_to_block_num(fs_info, start_cln);
+    uint32_t            ofs_blk = offset & (fs_info->vol.bytes_per_block - 1);
+    uint32_t            bytes_to_write = count;
+    uint32_t            blk_cnt;
+    const uint8_t      *buffer = buff;
+    ssize_t             cmpltd = 0;
+    ssize_t             ret;
+    uint32_t            c;
+
+    cur_blk += offset >> fs_info->vol.bytes_per_block_log2;
+
+    while (bytes_to_write > 0)
+    {
+        blk_cnt = bytes_to_write >> fs_info->vol.bytes_per_block_log2;
+
+        if ((ofs_blk == 0) && (blk_cnt >= FAT_DIRECT_IO_MIN_BLOCKS) &&
+            fat_is_direct_io_aligned(&buffer[cmpltd],
+                blk_cnt << fs_info->vol.bytes_per_block_log2))
+        {
+            /* the cached block may be accessed and modified */
+            if (fat_buf_release(fs_info) != RC_OK)
+                return -1;
+
+            sc = rtems_bdbuf_write_direct(fs_info->vol.dd, cur_blk, blk_cnt,
+                                          &buffer[cmpltd]);
+            if (sc != RTEMS_SUCCESSFUL)
+                rtems_set_errno_and_return_minus_one(EIO);
+
+            c = blk_cnt << fs_info->vol.bytes_per_block_log2;
+            cur_blk += blk_cnt;
+        }
+        else
+        {
+            c = MIN(bytes_to_write, (fs_info->vol.bytes_per_block - ofs_blk));
+
+            ret = fat_block_write(fs_info, cur_blk, ofs_blk, c,
+                                  &buffer[cmpltd]);
+            if ((ssize_t)c != ret)
+                return -1;
+
+            ++cur_blk;
+        }
+
+        bytes_to_write -= c;
+        cmpltd += c;
+        ofs_blk = 0;
+    }
+
+    return cmpltd;
+}
+
 static bool is_cluster_aligned(const fat_vol_t *vol, uint32_t sec_num)
 {
     return (sec_num & (vol->spc - 1)) == 0;
@@ -835,8 +1177,9 @@ fat_sync(fat_fs_info_t *fs_info)
 {
     int rc = RC_OK;
 
-    rc = fat_fat32_update_fsinfo_sector(fs_info);
-    if ( rc != RC_OK )
+    rc = fat_fat_cache_sync(fs_info);
+
+    if (fat_fat32_update_fsinfo_sector(fs_info) != RC_OK)
         rc = -1;
 
     fat_buf_release(fs_info);
@@ -873,7 +1216,12 @@ fat_shutdown_drive(fat_fs_info_t *fs_info)
         rtems_chain_control *the_chain = fs_info->vhash + i;
 
         while ( (node = rtems_chain_get_unprotected(the_chain)) != NULL )
-            free(node);
+        {
+            fat_file_fd_t *fat_fd = (fat_file_fd_t *) node;
+
+            free(fat_fd->extents.ext);
+            free(fat_fd);
+        }
     }
 
     for (i = 0; i < FAT_HASH_SIZE; i++)
@@ -882,7 +1230,12 @@ fat_shutdown_drive(fat_fs_info_t *fs_info)
         rtems_chain_control *the_chain = fs_info->rhash + i;
 
         while ( (node = rtems_chain_get_unprotected(the_chain)) != NULL )
-            free(node);
+        {
+            fat_file_fd_t *fat_fd = (fat_file_fd_t *) node;
+
+            free(fat_fd->extents.ext);
+            free(fat_fd);
+        }
     }
 
     free(fs_info->vhash);
@@ -890,6 +1243,9 @@ fat_shutdown_drive(fat_fs_info_t *fs_info)
 
     free(fs_info->uino);
     free(fs_info->sec_buf);
+    free(fs_info->free_cls_map);
+    free(fs_info->fat_c.entries);
+    free(fs_info->fat_c.bufs);
     close(fs_info->vol.fd);
 
     if (rc)
@@ -346,6 +346,36 @@ typedef struct fat_cache_s
     rtems_bdbuf_buffer *buf;
 } fat_cache_t;
 
+/*
+ * A sector of the active File Allocation Table held in the FAT cache.
+ */
+typedef struct fat_fat_cache_entry_s
+{
+    uint32_t            sec_num;       /* sector number */
+    uint32_t            last_use;      /* stamp of the last access */
+    bool                valid;
+    bool                modified;
+    uint8_t            *buf;           /* sector data */
+} fat_fat_cache_entry_t;
+
+/*
+ * The FAT cache holds copies of File Allocation Table sectors.  Modified
+ * sectors are written back to all FAT copies when they are evicted and
+ * during fat_sync().  If the count of entries is zero, then the FAT sectors
+ * are accessed through the single sector cache.
+ */
+typedef struct fat_fat_cache_s
+{
+    uint32_t               count;       /* count of entries */
+    uint32_t               stamp;       /* access stamp for LRU replacement */
+    fat_fat_cache_entry_t *entries;
+    fat_fat_cache_entry_t *last;        /* last accessed entry */
+    uint8_t               *bufs;        /* sector data of all entries */
+    uint32_t               hits;
+    uint32_t               misses;
+    uint32_t               write_backs; /* count of sectors written back */
+} fat_fat_cache_t;
+
 /*
  * This structure identifies the instance of the filesystem on the FAT
  * ("fat-file") level.
@@ -360,7 +390,11 @@ typedef struct fat_fs_info_s
     uint32_t             uino_pool_size; /* size */
     uint32_t             uino_base;
     fat_cache_t          c;             /* cache */
+    fat_fat_cache_t      fat_c;         /* FAT sectors cache */
     uint8_t             *sec_buf; /* just placeholder for anything */
+    uint32_t            *free_cls_map;  /* bitmap of free data clusters or
+                                           NULL, see
+                                           fat_init_free_clusters_map() */
 } fat_fs_info_t;
 
 /*
@@ -409,6 +443,26 @@ typedef struct fat_dir_pos_s
 #define FAT_OP_TYPE_READ  0x1
 #define FAT_OP_TYPE_GET   0x2
 
+/*
+ * minimum count of whole blocks which are transferred directly between the
+ * device and the user buffer bypassing the block cache
+ */
+#define FAT_DIRECT_IO_MIN_BLOCKS  2
+
+/*
+ * the user buffer is used for the device transfer of a direct transfer, so
+ * the buffer and the length must be aligned to the cache line size,
+ * otherwise the cached path is used
+ */
+static inline bool
+fat_is_direct_io_aligned(
+    const void *buff,
+    uint32_t    count
+    )
+{
+    return (((uintptr_t) buff | count) & (CPU_CACHE_LINE_BYTES - 1)) == 0;
+}
+
 static inline void
 fat_dir_pos_init(
     fat_dir_pos_t *dir_pos
@@ -494,6 +548,26 @@ fat_buf_access(fat_fs_info_t  *fs_info,
 int
 fat_buf_release(fat_fs_info_t *fs_info);
 
+int
+fat_fat_buf_access(fat_fs_info_t  *fs_info,
+                   uint32_t        sec_num,
+                   uint8_t       **sec_buf);
+
+static inline void
+fat_fat_buf_mark_modified(fat_fs_info_t *fs_info)
+{
+    if (fs_info->fat_c.count == 0)
+        fat_buf_mark_modified(fs_info);
+    else
+        fs_info->fat_c.last->modified = true;
+}
+
+int
+fat_init_fat_cache(fat_fs_info_t *fs_info, uint32_t count);
+
+int
+fat_fat_cache_sync(fat_fs_info_t *fs_info);
+
 ssize_t
 _fat_block_read(fat_fs_info_t                        *fs_info,
                 uint32_t                              start,
@@ -520,6 +594,20 @@ fat_sector_write(fat_fs_info_t                        *fs_info,
                  uint32_t                              count,
                  const void                           *buff);
 
+ssize_t
+fat_cluster_read_direct(fat_fs_info_t                  *fs_info,
+                        uint32_t                        start_cln,
+                        uint32_t                        offset,
+                        uint32_t                        count,
+                        void                           *buff);
+
+ssize_t
+fat_cluster_write_direct(fat_fs_info_t                 *fs_info,
+                         uint32_t                       start_cln,
+                         uint32_t                       offset,
+                         uint32_t                       count,
+                         const void                    *buff);
+
 ssize_t
 fat_cluster_set(fat_fs_info_t                        *fs_info,
                   uint32_t                              start,
@@ -27,6 +27,140 @@
 #include "fat.h"
 #include "fat_fat_operations.h"
 
+#define FAT_FREE_CLS_MAP_BITS 32
+
+#define FAT_FREE_CLS_MAP_WORDS(data_cls) \
+    (((data_cls) + FAT_FREE_CLS_MAP_BITS - 1) / FAT_FREE_CLS_MAP_BITS)
+
+/* fat_free_cls_map_update --
+ *     Update the free clusters map for a new FAT entry value.
+ */
+static inline void
+fat_free_cls_map_update(
+    fat_fs_info_t                        *fs_info,
+    uint32_t                              cln,
+    uint32_t                              in_val
+    )
+{
+    uint32_t *map = fs_info->free_cls_map;
+    uint32_t  idx = cln - FAT_RSRVD_CLN;
+    uint32_t  bit = UINT32_C(1) << (idx % FAT_FREE_CLS_MAP_BITS);
+
+    if (map == NULL)
+        return;
+
+    if (in_val == FAT_GENFAT_FREE)
+        map[idx / FAT_FREE_CLS_MAP_BITS] |= bit;
+    else
+        map[idx / FAT_FREE_CLS_MAP_BITS] &= ~bit;
+}
+
+/* fat_free_cls_map_find --
+ *     Find the first free cluster starting at the specified cluster in the
+ *     free clusters map.  The search wraps around at the end of the data
+ *     area.
+ *
+ * PARAMETERS:
+ *     fs_info  - FS info
+ *     cln      - number of the cluster to start the search
+ *
+ * RETURNS:
+ *     the number of the free cluster, or 0 if no free cluster exists
+ */
+static uint32_t
+fat_free_cls_map_find(
+    const fat_fs_info_t                  *fs_info,
+    uint32_t                              cln
+    )
+{
+    const uint32_t *map = fs_info->free_cls_map;
+    uint32_t        words = FAT_FREE_CLS_MAP_WORDS(fs_info->vol.data_cls);
+    uint32_t        idx = cln - FAT_RSRVD_CLN;
+    uint32_t        w = idx / FAT_FREE_CLS_MAP_BITS;
+    uint32_t        word;
+    uint32_t        n;
+
+    /* Ignore the free clusters before the start cluster in the first word */
+    word = map[w] & (~UINT32_C(0) << (idx % FAT_FREE_CLS_MAP_BITS));
+
+    /*
+     * Visit the first word twice, to find the free clusters before the start
+     * cluster after the wrap around.  The bits after the last data cluster are
+     * never set.
+     */
+    for (n = 0; n <= words; n++)
+    {
+        if (word != 0)
+            return w * FAT_FREE_CLS_MAP_BITS + __builtin_ctz(word) +
+                   FAT_RSRVD_CLN;
+
+        w++;
+        if (w == words)
+            w = 0;
+
+        word = map[w];
+    }
+
+    return 0;
+}
+
+/* fat_init_free_clusters_map --
+ *     Allocate the free clusters map and initialize it from the Files
+ *     Allocation Table.  The free clusters count is set to the exact count
+ *     found in the table.
+ *
+ * PARAMETERS:
+ *     fs_info  - FS info
+ *
+ * RETURNS:
+ *     RC_OK on success, or -1 if error occurred (errno set appropriately)
+ */
+int
+fat_init_free_clusters_map(
+    fat_fs_info_t                        *fs_info
+    )
+{
+    int            rc = RC_OK;
+    uint32_t      *map;
+    uint32_t       words = FAT_FREE_CLS_MAP_WORDS(fs_info->vol.data_cls);
+    uint32_t       data_cls_val = fs_info->vol.data_cls + 2;
+    uint32_t       free_cls = 0;
+    uint32_t       cln;
+
+    map = calloc(words, sizeof(*map));
+    if (map == NULL)
+        rtems_set_errno_and_return_minus_one(ENOMEM);
+
+    for (cln = 2; cln < data_cls_val; cln++)
+    {
+        uint32_t next_cln = 0;
+
+        rc = fat_get_fat_cluster(fs_info, cln, &next_cln);
+        if ( rc != RC_OK )
+        {
+            fat_buf_release(fs_info);
+            free(map);
+            return rc;
+        }
+
+        if (next_cln == FAT_GENFAT_FREE)
+        {
+            uint32_t idx = cln - FAT_RSRVD_CLN;
+
+            map[idx / FAT_FREE_CLS_MAP_BITS] |=
+                UINT32_C(1) << (idx % FAT_FREE_CLS_MAP_BITS);
+            free_cls++;
+        }
+    }
+
+    fat_buf_release(fs_info);
+
+    fs_info->free_cls_map = map;
+    fs_info->vol.free_cls = free_cls;
+
+    return RC_OK;
+}
+
 /* fat_scan_fat_for_free_clusters --
  *     Allocate chain of free clusters from Files Allocation Table
  *
@@ -72,12 +206,25 @@ fat_scan_fat_for_free_clusters(
     {
         uint32_t next_cln = 0;
 
-        rc = fat_get_fat_cluster(fs_info, cl4find, &next_cln);
-        if ( rc != RC_OK )
+        if (fs_info->free_cls_map != NULL)
         {
-            if (*cls_added != 0)
-                fat_free_fat_clusters_chain(fs_info, (*chain));
-            return rc;
+            /*
+             * The map is updated by fat_set_fat_cluster(), so there is no
+             * need to read the FAT entry of the free cluster.
+             */
+            cl4find = fat_free_cls_map_find(fs_info, cl4find);
+            if (cl4find == 0)
+                break;
+        }
+        else
+        {
+            rc = fat_get_fat_cluster(fs_info, cl4find, &next_cln);
+            if ( rc != RC_OK )
+            {
+                if (*cls_added != 0)
+                    fat_free_fat_clusters_chain(fs_info, (*chain));
+                return rc;
+            }
         }
 
         if (next_cln == FAT_GENFAT_FREE)
@@ -248,7 +395,7 @@ fat_get_fat_cluster(
           fs_info->vol.afat_loc;
     ofs = FAT_FAT_OFFSET(fs_info->vol.type, cln) & (fs_info->vol.bps - 1);
 
-    rc = fat_buf_access(fs_info, sec, FAT_OP_TYPE_READ, &sec_buf);
+    rc = fat_fat_buf_access(fs_info, sec, &sec_buf);
     if (rc != RC_OK)
         return rc;
 
@@ -262,8 +409,7 @@ fat_get_fat_cluster(
             *ret_val = (*(sec_buf + ofs));
             if ( ofs == (fs_info->vol.bps - 1) )
             {
-                rc = fat_buf_access(fs_info, sec + 1, FAT_OP_TYPE_READ,
-                                    &sec_buf);
+                rc = fat_fat_buf_access(fs_info, sec + 1, &sec_buf);
                 if (rc != RC_OK)
                     return rc;
 
@@ -333,7 +479,7 @@ fat_set_fat_cluster(
           fs_info->vol.afat_loc;
     ofs = FAT_FAT_OFFSET(fs_info->vol.type, cln) & (fs_info->vol.bps - 1);
 
-    rc = fat_buf_access(fs_info, sec, FAT_OP_TYPE_READ, &sec_buf);
+    rc = fat_fat_buf_access(fs_info, sec, &sec_buf);
     if (rc != RC_OK)
         return rc;
 
@@ -347,12 +493,11 @@ fat_set_fat_cluster(
 
                 *(sec_buf + ofs) |= (uint8_t)(fat16_clv & 0x00F0);
 
-                fat_buf_mark_modified(fs_info);
+                fat_fat_buf_mark_modified(fs_info);
 
                 if ( ofs == (fs_info->vol.bps - 1) )
                 {
-                    rc = fat_buf_access(fs_info, sec + 1, FAT_OP_TYPE_READ,
-                                        &sec_buf);
+                    rc = fat_fat_buf_access(fs_info, sec + 1, &sec_buf);
                     if (rc != RC_OK)
                         return rc;
 
@@ -360,7 +505,7 @@ fat_set_fat_cluster(
 
                      *sec_buf |= (uint8_t)((fat16_clv & 0xFF00)>>8);
 
-                     fat_buf_mark_modified(fs_info);
+                     fat_fat_buf_mark_modified(fs_info);
                 }
                 else
                 {
@@ -376,12 +521,11 @@ fat_set_fat_cluster(
 
                 *(sec_buf + ofs) |= (uint8_t)(fat16_clv & 0x00FF);
 
-                fat_buf_mark_modified(fs_info);
+                fat_fat_buf_mark_modified(fs_info);
 
                 if ( ofs == (fs_info->vol.bps - 1) )
                 {
-                    rc = fat_buf_access(fs_info, sec + 1, FAT_OP_TYPE_READ,
-                                        &sec_buf);
+                    rc = fat_fat_buf_access(fs_info, sec + 1, &sec_buf);
                     if (rc != RC_OK)
                         return rc;
 
@@ -389,7 +533,7 @@ fat_set_fat_cluster(
 
                     *sec_buf |= (uint8_t)((fat16_clv & 0xFF00)>>8);
 
-                    fat_buf_mark_modified(fs_info);
+                    fat_fat_buf_mark_modified(fs_info);
                 }
                 else
                 {
@@ -403,7 +547,7 @@ fat_set_fat_cluster(
         case FAT_FAT16:
             *((uint16_t   *)(sec_buf + ofs)) =
                     (uint16_t  )(CT_LE_W(in_val));
-            fat_buf_mark_modified(fs_info);
+            fat_fat_buf_mark_modified(fs_info);
             break;
 
         case FAT_FAT32:
@@ -413,7 +557,7 @@ fat_set_fat_cluster(
 
             *((uint32_t *)(sec_buf + ofs)) |= fat32_clv;
 
-            fat_buf_mark_modified(fs_info);
+            fat_fat_buf_mark_modified(fs_info);
             break;
 
         default:
@@ -422,5 +566,7 @@ fat_set_fat_cluster(
 
     }
 
+    fat_free_cls_map_update(fs_info, cln, in_val);
+
     return RC_OK;
 }
@@ -66,6 +66,9 @@ fat_free_fat_clusters_chain(
     uint32_t                              chain
 );
 
+int
+fat_init_free_clusters_map(fat_fs_info_t *fs_info);
+
 #ifdef __cplusplus
 }
 #endif
@@ -59,6 +59,20 @@ fat_file_lseek(
     uint32_t                              *disk_cln
 );
 
+static void
+fat_file_extents_add(
+    const fat_fs_info_t                   *fs_info,
+    fat_file_fd_t                         *fat_fd,
+    uint32_t                               file_cln,
+    uint32_t                               disk_cln
+);
+
+static void
+fat_file_extents_trim(
+    fat_file_fd_t                         *fat_fd,
+    uint32_t                               file_cls
+);
+
 /* fat_file_open --
  *     Open fat-file. Two hash tables are accessed by key
  *     constructed from cluster num and offset of the node (i.e.
@@ -324,6 +338,7 @@ fat_file_close(
                 if (fat_ino_is_unique(fs_info, fat_fd->ino))
                     fat_free_unique_ino(fs_info, fat_fd->ino);
 
+                free(fat_fd->extents.ext);
                 free(fat_fd);
             }
         }
@@ -336,6 +351,7 @@ fat_file_close(
             else
             {
                 _hash_delete(fs_info->vhash, key, fat_fd->ino, fat_fd);
+                free(fat_fd->extents.ext);
                 free(fat_fd);
             }
         }
@@ -379,7 +395,9 @@ fat_file_read(
     uint32_t       cmpltd = 0;
     uint32_t       cur_cln = 0;
     uint32_t       cl_start = 0;
+    uint32_t       file_cln;
     uint32_t       save_cln = 0;
+    uint32_t       run_cln;
     uint32_t       ofs = 0;
     uint32_t       save_ofs;
     uint32_t       sec = 0;
@@ -425,27 +443,51 @@ fat_file_read(
     if (rc != RC_OK)
         return rc;
 
+    file_cln = cl_start;
+
     while (count > 0)
     {
         c = MIN(count, (fs_info->vol.bpc - ofs));
 
-        sec = fat_cluster_num_to_sector_num(fs_info, cur_cln);
-
+        run_cln = cur_cln;
         save_cln = cur_cln;
         rc = fat_get_fat_cluster(fs_info, cur_cln, &cur_cln);
         if ( rc != RC_OK )
             return rc;
 
-        sec_peek = fat_cluster_num_to_sector_num(fs_info, cur_cln);
-        blk = fat_sector_num_to_block_num (fs_info, sec_peek);
-        blk_cnt = fs_info->vol.bpc >> fs_info->vol.bytes_per_block_log2;
-        if (blk_cnt == 0)
-            blk_cnt = 1;
-        fat_block_peek(fs_info, blk, blk_cnt);
+        ++file_cln;
+        fat_file_extents_add(fs_info, fat_fd, file_cln, cur_cln);
+
+        /* read the clusters which are contiguous on disk at once */
+        while ((c < count) && (cur_cln == save_cln + 1))
+        {
+            c += MIN(count - c, fs_info->vol.bpc);
+
+            save_cln = cur_cln;
+            rc = fat_get_fat_cluster(fs_info, cur_cln, &cur_cln);
+            if ( rc != RC_OK )
+                return rc;
+
+            ++file_cln;
+            fat_file_extents_add(fs_info, fat_fd, file_cln, cur_cln);
+        }
+
+        /*
+         * a large remainder is read directly, so read ahead only for a small
+         * one
+         */
+        if (count - c < (FAT_DIRECT_IO_MIN_BLOCKS <<
+                         fs_info->vol.bytes_per_block_log2))
+        {
+            sec_peek = fat_cluster_num_to_sector_num(fs_info, cur_cln);
+            blk = fat_sector_num_to_block_num (fs_info, sec_peek);
+            blk_cnt = fs_info->vol.bpc >> fs_info->vol.bytes_per_block_log2;
+            if (blk_cnt == 0)
+                blk_cnt = 1;
+            fat_block_peek(fs_info, blk, blk_cnt);
+        }
 
-        sec += (ofs >> fs_info->vol.sec_log2);
-        byte = ofs & (fs_info->vol.bps - 1);
-        ret = _fat_block_read(fs_info, sec, byte, c, buf + cmpltd);
+        ret = fat_cluster_read_direct(fs_info, run_cln, ofs, c, buf + cmpltd);
         if ( ret < 0 )
             return -1;
 
@@ -511,9 +553,11 @@ fat_file_write_fat32_or_non_root_dir(
     uint32_t       cur_cln = 0;
     uint32_t       save_cln = 0;
     uint32_t       start_cln = start >> fs_info->vol.bpc_log2;
+    uint32_t       file_cln = start_cln;
     uint32_t       ofs_cln = start - (start_cln << fs_info->vol.bpc_log2);
     uint32_t       ofs_cln_save = ofs_cln;
     uint32_t       bytes_to_write = count;
+    uint32_t       next_cln = 0;
     ssize_t        ret;
     uint32_t       c;
 
@@ -525,22 +569,40 @@ fat_file_write_fat32_or_non_root_dir(
         {
             c = MIN(bytes_to_write, (fs_info->vol.bpc - ofs_cln));
 
-            ret = fat_cluster_write(fs_info,
-                                      cur_cln,
-                                      ofs_cln,
-                                      c,
-                                      &buf[cmpltd]);
-            if (0 > ret)
-              rc = -1;
+            /* write the clusters which are contiguous on disk at once */
+            save_cln = cur_cln;
+            while (   (RC_OK == rc)
+                   && (c < bytes_to_write))
+            {
+                rc = fat_get_fat_cluster(fs_info, save_cln, &next_cln);
+                ++file_cln;
+                if (RC_OK == rc)
+                {
+                    fat_file_extents_add(fs_info, fat_fd, file_cln, next_cln);
+                    if (next_cln != save_cln + 1)
+                        break;
+
+                    c += MIN(bytes_to_write - c, fs_info->vol.bpc);
+                    save_cln = next_cln;
+                }
+            }
+
+            if (RC_OK == rc)
+            {
+                ret = fat_cluster_write_direct(fs_info,
+                                               cur_cln,
+                                               ofs_cln,
+                                               c,
+                                               &buf[cmpltd]);
+                if (0 > ret)
+                  rc = -1;
+            }
 
             if (RC_OK == rc)
             {
                 bytes_to_write -= ret;
                 cmpltd += ret;
-                save_cln = cur_cln;
-                if (0 < bytes_to_write)
-                  rc = fat_get_fat_cluster(fs_info, cur_cln, &cur_cln);
-
+                cur_cln = next_cln;
                 ofs_cln = 0;
             }
         }
@@ -678,6 +740,7 @@ fat_file_extend(
     uint32_t       bytes2add = 0;
     uint32_t       cls2add = 0;
     uint32_t       old_last_cl;
+    uint32_t       old_cls;
     uint32_t       last_cl = 0;
     uint32_t       bytes_remain = 0;
     uint32_t       cls_added;
@@ -755,6 +818,8 @@ fat_file_extend(
             fat_fd->map.disk_cln = chain;
             fat_fd->map.file_cln = 0;
             fat_file_set_first_cluster_num(fat_fd, chain);
+            fat_file_extents_trim(fat_fd, 0);
+            fat_file_extents_add(fs_info, fat_fd, 0, chain);
         }
         else
         {
@@ -780,6 +845,14 @@ fat_file_extend(
                 return rc;
             }
             fat_buf_release(fs_info);
+
+            /*
+             * the new chain continues the extent map only in case the map
+             * covers all clusters of the file
+             */
+            old_cls = fat_fd->fat_file_size - 1;
+            old_cls = (old_cls >> fs_info->vol.bpc_log2) + 1;
+            fat_file_extents_add(fs_info, fat_fd, old_cls, chain);
         }
 
         /* update number of the last cluster of the file */
@@ -850,6 +923,9 @@ fat_file_truncate(
     if (rc != RC_OK)
         return rc;
 
+    /* forget the extents of the clusters to free */
+    fat_file_extents_trim(fat_fd, cl_start);
+
     rc = fat_free_fat_clusters_chain(fs_info, cur_cln);
     if (rc != RC_OK)
         return rc;
@@ -995,6 +1071,7 @@ fat_file_size(
     int            rc = RC_OK;
     uint32_t       cur_cln = fat_fd->cln;
     uint32_t       save_cln = 0;
+    uint32_t       file_cln = 0;
 
     /* Have we requested root dir size for FAT12/16? */
     if ((FAT_FD_OF_ROOT_DIR(fat_fd)) &&
@@ -1008,6 +1085,9 @@ fat_file_size(
 
     while ((cur_cln & fs_info->vol.mask) < fs_info->vol.eoc_val)
     {
+        fat_file_extents_add(fs_info, fat_fd, file_cln, cur_cln);
+        ++file_cln;
+
         save_cln = cur_cln;
         rc = fat_get_fat_cluster(fs_info, cur_cln, &cur_cln);
         if ( rc != RC_OK )
@@ -1110,6 +1190,182 @@ _hash_search(
     return -1;
 }
 
+/* fat_file_extents_end --
+ *     Returns the count of clusters of the fat-file covered by its extent
+ *     map.
+ *
+ * PARAMETERS:
+ *     fat_fd   - fat-file descriptor
+ *
+ * RETURNS:
+ *     count of clusters covered by the extent map
+ */
+static uint32_t
+fat_file_extents_end(
+    const fat_file_fd_t                   *fat_fd
+    )
+{
+    const fat_file_extents_t *extents = &fat_fd->extents;
+    const fat_file_extent_t  *last;
+
+    if (extents->count == 0)
+        return 0;
+
+    last = &extents->ext[extents->count - 1];
+    return last->file_cln + last->count;
+}
+
+/* fat_file_extents_add --
+ *     Record that cluster 'file_cln' of the fat-file is located at cluster
+ *     'disk_cln' of the volume.  The mapping is recorded only if it directly
+ *     follows the clusters already covered by the extent map, so the map
+ *     stays free of gaps.  The mapping is either merged into the last extent
+ *     or starts a new one.  If no memory is available for a new extent, the
+ *     mapping is silently dropped.
+ *
+ * PARAMETERS:
+ *     fs_info  - FS info
+ *     fat_fd   - fat-file descriptor
+ *     file_cln - cluster number in the fat-file
+ *     disk_cln - cluster number on the volume
+ *
+ * RETURNS:
+ *     None
+ */
+static void
+fat_file_extents_add(
+    const fat_fs_info_t                   *fs_info,
+    fat_file_fd_t                         *fat_fd,
+    uint32_t                               file_cln,
+    uint32_t                               disk_cln
+    )
+{
+    fat_file_extents_t *extents = &fat_fd->extents;
+    fat_file_extent_t  *ext;
+
+    if ((disk_cln < FAT_RSRVD_CLN) ||
+        (disk_cln - FAT_RSRVD_CLN >= fs_info->vol.data_cls))
+        return;
+
+    if (file_cln != fat_file_extents_end(fat_fd))
+        return;
+
+    if (extents->count > 0)
+    {
+        ext = &extents->ext[extents->count - 1];
+        if (ext->disk_cln + ext->count == disk_cln)
+        {
+            ext->count++;
+            return;
+        }
+    }
+    else if (disk_cln != fat_fd->cln)
+        return;
+
+    if (extents->count == extents->size)
+    {
+        uint32_t size;
+
+        if (extents->size >= FAT_FILE_EXTENTS_MAX)
+            return;
+
+        size = extents->size == 0 ? 4 : 2 * extents->size;
+        size = MIN(size, FAT_FILE_EXTENTS_MAX);
+
+        ext = realloc(extents->ext, size * sizeof(*ext));
+        if (ext == NULL)
+            return;
+
+        extents->ext = ext;
+        extents->size = size;
+    }
+
+    ext = &extents->ext[extents->count];
+    ext->file_cln = file_cln;
+    ext->disk_cln = disk_cln;
+    ext->count = 1;
+    extents->count++;
+}
+
+/* fat_file_extents_trim --
+ *     Remove all clusters starting with 'file_cls' from the extent map of
+ *     the fat-file.  This must be done before the corresponding part of the
+ *     clusters chain is freed or replaced.
+ *
+ * PARAMETERS:
+ *     fat_fd   - fat-file descriptor
+ *     file_cls - count of clusters to keep
+ *
+ * RETURNS:
+ *     None
+ */
+static void
+fat_file_extents_trim(
+    fat_file_fd_t                         *fat_fd,
+    uint32_t                               file_cls
+    )
+{
+    fat_file_extents_t *extents = &fat_fd->extents;
+
+    while (extents->count > 0)
+    {
+        fat_file_extent_t *ext = &extents->ext[extents->count - 1];
+
+        if (ext->file_cln < file_cls)
+        {
+            ext->count = MIN(ext->count, file_cls - ext->file_cln);
+            break;
+        }
+
+        extents->count--;
+    }
+}
+
+/* fat_file_extents_lookup --
+ *     Binary search for cluster 'file_cln' of the fat-file in its extent map.
+ *     The extent map is dropped, if it does not start with the first
+ *     cluster of the fat-file.
+ *
+ * PARAMETERS:
+ *     fat_fd   - fat-file descriptor
+ *     file_cln - cluster number in the fat-file
+ *     disk_cln - placeholder for the cluster number on the volume
+ *
+ * RETURNS:
+ *     true if the extent map covers 'file_cln', false otherwise
+ */
+static bool
+fat_file_extents_lookup(
+    fat_file_fd_t                         *fat_fd,
+    uint32_t                               file_cln,
+    uint32_t                              *disk_cln
+    )
+{
+    fat_file_extents_t *extents = &fat_fd->extents;
+    const fat_file_extent_t *ext = extents->ext;
+    uint32_t            lo = 0;
+    uint32_t            hi = extents->count;
+
+    if ((extents->count > 0) && (ext[0].disk_cln != fat_fd->cln))
+        extents->count = 0;
+
+    if (file_cln >= fat_file_extents_end(fat_fd))
+        return false;
+
+    while (hi - lo > 1)
+    {
+        uint32_t mid = lo + (hi - lo) / 2;
+
+        if (ext[mid].file_cln <= file_cln)
+            lo = mid;
+        else
+            hi = mid;
+    }
+
+    *disk_cln = ext[lo].disk_cln + (file_cln - ext[lo].file_cln);
+    return true;
+}
+
 static off_t
 fat_file_lseek(
     fat_fs_info_t                         *fs_info,
@@ -1121,30 +1377,57 @@ fat_file_lseek(
     int rc = RC_OK;
 
     if (file_cln == fat_fd->map.file_cln)
+    {
         *disk_cln = fat_fd->map.disk_cln;
+        fat_file_extents_add(fs_info, fat_fd, file_cln, *disk_cln);
+    }
     else
     {
         uint32_t   cur_cln;
-        uint32_t   count;
         uint32_t   i;
 
-        if (file_cln > fat_fd->map.file_cln)
+        if (!fat_file_extents_lookup(fat_fd, file_cln, &cur_cln))
         {
-            cur_cln = fat_fd->map.disk_cln;
-            count = file_cln - fat_fd->map.file_cln;
-        }
-        else
-        {
-            cur_cln = fat_fd->cln;
-            count = file_cln;
-        }
+            const fat_file_extents_t *extents = &fat_fd->extents;
+            uint32_t                  end = fat_file_extents_end(fat_fd);
 
-        /* skip over the clusters */
-        for (i = 0; i < count; i++)
-        {
-            rc = fat_get_fat_cluster(fs_info, cur_cln, &cur_cln);
-            if ( rc != RC_OK )
-                return rc;
+            /*
+             * Continue the walk at the end of the extent map to cover the
+             * clusters in the map.  Use the cached position only if it is
+             * ahead and the map is full.
+             */
+            if ((file_cln > fat_fd->map.file_cln) &&
+                (fat_fd->map.file_cln >= end) &&
+                (extents->count >= FAT_FILE_EXTENTS_MAX))
+            {
+                cur_cln = fat_fd->map.disk_cln;
+                i = fat_fd->map.file_cln;
+            }
+            else if (end > 0)
+            {
+                const fat_file_extent_t *ext =
+                    &extents->ext[extents->count - 1];
+
+                cur_cln = ext->disk_cln + ext->count - 1;
+                i = end - 1;
+            }
+            else
+            {
+                cur_cln = fat_fd->cln;
+                i = 0;
+                fat_file_extents_add(fs_info, fat_fd, i, cur_cln);
+            }
+
+            /* skip over the clusters */
+            while (i < file_cln)
+            {
+                rc = fat_get_fat_cluster(fs_info, cur_cln, &cur_cln);
+                if ( rc != RC_OK )
+                    return rc;
+
+                ++i;
+                fat_file_extents_add(fs_info, fat_fd, i, cur_cln);
+            }
         }
 
         /* update cache */
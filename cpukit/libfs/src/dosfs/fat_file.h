@@ -67,6 +67,36 @@ typedef struct fat_file_map_s
     uint32_t   last_cln;
 } fat_file_map_t;
 
+/*
+ * Maximum count of extents recorded for one fat-file.  Lookups beyond the
+ * range covered by the extent map walk the clusters chain.
+ */
+#define FAT_FILE_EXTENTS_MAX 1024
+
+/*
+ * Run of 'count' consecutive clusters on the volume starting at 'disk_cln'
+ * which hold the clusters 'file_cln' ... 'file_cln + count - 1' of a
+ * fat-file.
+ */
+typedef struct fat_file_extent_s
+{
+    uint32_t   file_cln;
+    uint32_t   disk_cln;
+    uint32_t   count;
+} fat_file_extent_t;
+
+/*
+ * Extent map of a fat-file.  The extents are sorted by 'file_cln' and cover
+ * the clusters chain of the fat-file without gaps from its first cluster up
+ * to the last cluster discovered so far.
+ */
+typedef struct fat_file_extents_s
+{
+    fat_file_extent_t *ext;
+    uint32_t           count;
+    uint32_t           size;
+} fat_file_extents_t;
+
 /**
  * @brief Descriptor of a fat-file.
  *
@@ -91,6 +121,7 @@ typedef struct fat_file_fd_s
     fat_dir_pos_t    dir_pos;
     uint8_t          flags;
     fat_file_map_t   map;
+    fat_file_extents_t extents;
     time_t           ctime;
     time_t           mtime;
 
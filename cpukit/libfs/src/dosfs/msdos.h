@@ -47,6 +47,41 @@ extern "C" {
  * This structure identifies the instance of the filesystem on the MSDOS
  * level.
  */
+/*
+ * Count of directories for which the directory lookup cache remembers that
+ * it was filled by a scan of the whole directory.
+ */
+#define MSDOS_NAME_CACHE_DIRS 8
+
+/*
+ * Entry of the directory lookup cache.  It maps the hash of a normalized
+ * name in a directory to the index of the directory cluster which contains
+ * the first directory entry of the name.  The entries are hints, the
+ * directory entries are always checked by a scan which starts at the hinted
+ * cluster.
+ */
+typedef struct msdos_name_cache_entry_s
+{
+    uint32_t   dir_cln;    /* first cluster of the directory */
+    uint32_t   hash;       /* hash of the normalized name */
+    uint32_t   dir_offset; /* index of the directory cluster */
+} msdos_name_cache_entry_t;
+
+/*
+ * Directory lookup cache.  It is a direct mapped table indexed by the hash
+ * of the directory and the normalized name.
+ */
+typedef struct msdos_name_cache_s
+{
+    msdos_name_cache_entry_t *entries;
+    uint32_t                  mask;    /* count of entries minus one */
+    uint32_t                  dirs[MSDOS_NAME_CACHE_DIRS];
+    uint32_t                  next_dir;
+    uint32_t                  hits;
+    uint32_t                  misses;
+    uint32_t                  fills;
+} msdos_name_cache_t;
+
 typedef struct msdos_fs_info_s
 {
     fat_fs_info_t                     fat;                /*
@@ -72,6 +107,8 @@ typedef struct msdos_fs_info_s
                                                             */
 
     rtems_dosfs_convert_control      *converter;
+
+    msdos_name_cache_t                name_cache;
 } msdos_fs_info_t;
 
 static inline void msdos_fs_lock(msdos_fs_info_t *fs_info)
@@ -306,6 +343,12 @@ int msdos_statvfs(
   const rtems_filesystem_location_info_t *root_loc,
   struct statvfs *sb);
 
+int msdos_ioctl(
+  rtems_libio_t   *iop,
+  ioctl_command_t  request,
+  void            *buffer
+);
+
 void msdos_lock(const rtems_filesystem_mount_table_entry_t *mt_entry);
 
 void msdos_unlock(const rtems_filesystem_mount_table_entry_t *mt_entry);
@@ -320,7 +363,8 @@ int msdos_initialize_support(
   const rtems_filesystem_operations_table *op_table,
   const rtems_filesystem_file_handlers_r  *file_handlers,
   const rtems_filesystem_file_handlers_r  *directory_handlers,
-  rtems_dosfs_convert_control             *converter
+  rtems_dosfs_convert_control             *converter,
+  const rtems_dosfs_mount_options         *mount_options
 );
 
 ssize_t msdos_file_read(
@@ -487,6 +531,19 @@ int msdos_get_dotdot_dir_info_cluster_num_and_offset(
 
 int msdos_sync(rtems_libio_t *iop);
 
+int msdos_init_name_cache(msdos_fs_info_t *fs_info, uint32_t count);
+
+void msdos_name_cache_forget(
+    rtems_filesystem_mount_table_entry_t *mt_entry,
+    fat_file_fd_t                        *parent_fat_fd,
+    const fat_dir_pos_t                  *dir_pos
+);
+
+void msdos_name_cache_forget_dir(
+    msdos_fs_info_t                      *fs_info,
+    fat_file_fd_t                        *fat_fd
+);
+
 uint8_t msdos_lfn_checksum(const void *entry);
 
 /** @} */
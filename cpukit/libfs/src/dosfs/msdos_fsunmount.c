@@ -60,5 +60,6 @@ msdos_shut_down(rtems_filesystem_mount_table_entry_t *temp_mt_entry)
     rtems_recursive_mutex_destroy(&fs_info->vol_mutex);
     (*converter->handler->destroy)( converter );
     free(fs_info->cl_buf);
+    free(fs_info->name_cache.entries);
     free(temp_mt_entry->fs_info);
 }
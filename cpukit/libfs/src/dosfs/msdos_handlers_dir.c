@@ -29,7 +29,7 @@ const rtems_filesystem_file_handlers_r msdos_dir_handlers = {
   .close_h = rtems_filesystem_default_close,
   .read_h = msdos_dir_read,
   .write_h = rtems_filesystem_default_write,
-  .ioctl_h = rtems_filesystem_default_ioctl,
+  .ioctl_h = msdos_ioctl,
   .lseek_h = rtems_filesystem_default_lseek_directory,
   .fstat_h = msdos_dir_stat,
   .ftruncate_h = rtems_filesystem_default_ftruncate_directory,
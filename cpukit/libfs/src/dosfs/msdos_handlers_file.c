@@ -29,7 +29,7 @@ const rtems_filesystem_file_handlers_r msdos_file_handlers = {
   .close_h = rtems_filesystem_default_close,
   .read_h = msdos_file_read,
   .write_h = msdos_file_write,
-  .ioctl_h = rtems_filesystem_default_ioctl,
+  .ioctl_h = msdos_ioctl,
   .lseek_h = rtems_filesystem_default_lseek_file,
   .fstat_h = msdos_file_stat,
   .ftruncate_h = msdos_file_ftruncate,
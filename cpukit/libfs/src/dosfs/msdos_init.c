@@ -119,7 +119,8 @@ int rtems_dosfs_initialize(
                                       &msdos_ops,
                                       &msdos_file_handlers,
                                       &msdos_dir_handlers,
-                                      converter);
+                                      converter,
+                                      mount_options);
         if (rc != 0 && converter_created) {
             (*converter->handler->destroy)(converter);
         }
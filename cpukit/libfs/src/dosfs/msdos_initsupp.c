@@ -44,6 +44,8 @@
  *     op_table           - filesystem operations table
  *     file_handlers      - file operations table
  *     directory_handlers - directory operations table
+ *     converter          - file name converter
+ *     mount_options      - mount options, may be NULL
  *
  * RETURNS:
  *     RC_OK and filled temp_mt_entry on success, or -1 if error occurred
@@ -56,7 +58,8 @@ msdos_initialize_support(
     const rtems_filesystem_operations_table *op_table,
     const rtems_filesystem_file_handlers_r  *file_handlers,
     const rtems_filesystem_file_handlers_r  *directory_handlers,
-    rtems_dosfs_convert_control             *converter
+    rtems_dosfs_convert_control             *converter,
+    const rtems_dosfs_mount_options         *mount_options
     )
 {
     int                rc = RC_OK;
@@ -78,6 +81,22 @@ msdos_initialize_support(
         return rc;
     }
 
+    if (mount_options != NULL)
+    {
+        rc = fat_init_fat_cache(&fs_info->fat,
+                                mount_options->fat_cache_sectors);
+
+        if (rc == RC_OK && mount_options->free_cluster_bitmap)
+            rc = fat_init_free_clusters_map(&fs_info->fat);
+
+        if (rc != RC_OK)
+        {
+            fat_shutdown_drive(&fs_info->fat);
+            free(fs_info);
+            return rc;
+        }
+    }
+
     fs_info->file_handlers      = file_handlers;
     fs_info->directory_handlers = directory_handlers;
 
@@ -133,6 +152,19 @@ msdos_initialize_support(
         rtems_set_errno_and_return_minus_one(ENOMEM);
     }
 
+    if (mount_options != NULL)
+    {
+        rc = msdos_init_name_cache(fs_info, mount_options->name_cache_entries);
+        if (rc != RC_OK)
+        {
+            free(fs_info->cl_buf);
+            fat_file_close(&fs_info->fat, fat_fd);
+            fat_shutdown_drive(&fs_info->fat);
+            free(fs_info);
+            return rc;
+        }
+    }
+
     rtems_recursive_mutex_init(&fs_info->vol_mutex,
                                RTEMS_FILESYSTEM_TYPE_DOSFS);
 
@@ -0,0 +1,82 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup libfs_msdos MSDOS FileSystem
+ *
+ * @brief MSDOS IO Control Handler
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "fat.h"
+#include "msdos.h"
+
+int msdos_ioctl(
+  rtems_libio_t   *iop,
+  ioctl_command_t  request,
+  void            *buffer
+)
+{
+  msdos_fs_info_t              *fs_info = iop->pathinfo.mt_entry->fs_info;
+  const fat_fat_cache_t        *fat_c = &fs_info->fat.fat_c;
+  const msdos_name_cache_t     *name_cache = &fs_info->name_cache;
+  rtems_dosfs_fat_cache_stats  *stats;
+  rtems_dosfs_name_cache_stats *name_stats;
+
+  switch (request) {
+    case RTEMS_DOSFS_GET_FAT_CACHE_STATS:
+      stats = buffer;
+
+      msdos_fs_lock(fs_info);
+      stats->sectors = fat_c->count;
+      stats->hits = fat_c->hits;
+      stats->misses = fat_c->misses;
+      stats->write_backs = fat_c->write_backs;
+      msdos_fs_unlock(fs_info);
+
+      return 0;
+    case RTEMS_DOSFS_GET_NAME_CACHE_STATS:
+      name_stats = buffer;
+
+      msdos_fs_lock(fs_info);
+      name_stats->entries =
+        name_cache->entries != NULL ? name_cache->mask + 1 : 0;
+      name_stats->hits = name_cache->hits;
+      name_stats->misses = name_cache->misses;
+      name_stats->fills = name_cache->fills;
+      msdos_fs_unlock(fs_info);
+
+      return 0;
+    default:
+      return rtems_filesystem_default_ioctl(iop, request, buffer);
+  }
+}
@@ -1301,6 +1301,486 @@ msdos_prepare_for_next_entry(
     *name_len_remaining = name_len_for_compare;
 }
 
+#define MSDOS_NAME_HASH_INIT 2166136261U
+
+/*
+ * State to compute the hashes of the names of consecutive directory
+ * entries.
+ */
+typedef struct msdos_name_hash_state_s
+{
+    bool       in_lfn;       /* inside a series of long name entries */
+    int        lfn_entry;    /* remaining count of long name entries */
+    uint8_t    lfn_checksum;
+    uint32_t   lfn_hash;
+    bool       lfn_valid;
+    uint32_t   sfn_hash;
+    bool       sfn_valid;
+} msdos_name_hash_state_t;
+
+/* msdos_name_hash --
+ *     Update the hash of a normalized name with a part of the name.  The
+ *     name is hashed backwards, since the long name entries of a name start
+ *     with the end of the name.
+ *
+ * PARAMETERS:
+ *     hash - hash of the following part of the name
+ *     name - part of the name
+ *     len  - length of the part of the name
+ *
+ * RETURNS:
+ *     hash of the name starting with the part
+ */
+static uint32_t
+msdos_name_hash(uint32_t hash, const uint8_t *name, size_t len)
+{
+    while (len > 0)
+    {
+        --len;
+        hash = (hash ^ name[len]) * 16777619U;
+    }
+
+    return hash;
+}
+
+static void
+msdos_name_hash_reset(msdos_name_hash_state_t *state)
+{
+    state->in_lfn = false;
+    state->lfn_entry = 0;
+}
+
+/* msdos_name_hash_entry --
+ *     Feed a used directory entry into the name hash state.  The long and
+ *     short names are decoded and normalized in the same way as
+ *     msdos_find_file_in_directory() does it to compare the names.
+ *
+ * PARAMETERS:
+ *     converter - converter of the file system instance
+ *     state     - name hash state
+ *     entry     - directory entry
+ *
+ * RETURNS:
+ *     true for a short name entry, then 'lfn_valid' and 'sfn_valid' of the
+ *     state tell if 'lfn_hash' and 'sfn_hash' are the hashes of the long and
+ *     short name, false for a long name entry
+ */
+static bool
+msdos_name_hash_entry(
+    rtems_dosfs_convert_control *converter,
+    msdos_name_hash_state_t     *state,
+    const char                  *entry)
+{
+    uint8_t  name_utf8[MSDOS_LFN_ENTRY_SIZE_UTF8];
+    uint8_t  name_normalized[MSDOS_LFN_ENTRY_SIZE_UTF8];
+    size_t   size = sizeof(name_normalized);
+    ssize_t  len;
+    int      eno;
+
+    if ((*MSDOS_DIR_ATTR(entry) & MSDOS_ATTR_LFN_MASK) == MSDOS_ATTR_LFN)
+    {
+        bool is_first_lfn_entry = !state->in_lfn;
+
+        if (is_first_lfn_entry)
+        {
+            if ((*MSDOS_DIR_ENTRY_TYPE(entry) & MSDOS_LAST_LONG_ENTRY) == 0)
+                return false;
+
+            state->in_lfn = true;
+            state->lfn_entry = (*MSDOS_DIR_ENTRY_TYPE(entry) &
+                                MSDOS_LAST_LONG_ENTRY_MASK);
+            state->lfn_checksum = *MSDOS_DIR_LFN_CHECKSUM(entry);
+            state->lfn_hash = MSDOS_NAME_HASH_INIT;
+        }
+
+        if ((state->lfn_entry != (*MSDOS_DIR_ENTRY_TYPE(entry) &
+                                  MSDOS_LAST_LONG_ENTRY_MASK)) ||
+            (state->lfn_checksum != *MSDOS_DIR_LFN_CHECKSUM(entry)))
+        {
+            msdos_name_hash_reset(state);
+            return false;
+        }
+
+        state->lfn_entry--;
+
+        len = msdos_long_entry_to_utf8_name(converter, entry,
+                                            is_first_lfn_entry,
+                                            &name_utf8[0],
+                                            sizeof(name_utf8));
+        eno = -1;
+        if (len > 0)
+            eno = (*converter->handler->utf8_normalize_and_fold)(
+                converter, &name_utf8[0], len, &name_normalized[0], &size);
+
+        if (eno == 0)
+            state->lfn_hash = msdos_name_hash(state->lfn_hash,
+                                              &name_normalized[0], size);
+        else
+            msdos_name_hash_reset(state);
+
+        return false;
+    }
+
+    state->lfn_valid = state->in_lfn && state->lfn_entry == 0 &&
+                       state->lfn_checksum == msdos_lfn_checksum(entry);
+    state->sfn_valid = false;
+    msdos_name_hash_reset(state);
+
+    if ((*MSDOS_DIR_ATTR(entry) & MSDOS_ATTR_VOLUME_ID) == 0)
+    {
+        len = msdos_short_entry_to_utf8_name(converter,
+                                             MSDOS_DIR_NAME(entry),
+                                             &name_utf8[0],
+                                             MSDOS_SHORT_NAME_LEN + 1);
+        if (len > 0)
+        {
+            eno = (*converter->handler->utf8_normalize_and_fold)(
+                converter, &name_utf8[0], len, &name_normalized[0], &size);
+            if (eno == 0)
+            {
+                state->sfn_hash = msdos_name_hash(MSDOS_NAME_HASH_INIT,
+                                                  &name_normalized[0], size);
+                state->sfn_valid = true;
+            }
+        }
+    }
+
+    return true;
+}
+
+static bool
+msdos_name_cache_is_used(
+    const msdos_fs_info_t *fs_info,
+    const fat_file_fd_t   *fat_fd)
+{
+    return fs_info->name_cache.entries != NULL &&
+           !(FAT_FD_OF_ROOT_DIR(fat_fd) &&
+             (fs_info->fat.vol.type & (FAT_FAT12 | FAT_FAT16)));
+}
+
+static msdos_name_cache_entry_t *
+msdos_name_cache_slot(
+    const msdos_name_cache_t *cache,
+    uint32_t                  dir_cln,
+    uint32_t                  hash)
+{
+    return &cache->entries[(hash ^ (dir_cln * 2654435761U)) & cache->mask];
+}
+
+static void
+msdos_name_cache_insert(
+    msdos_name_cache_t *cache,
+    uint32_t            dir_cln,
+    uint32_t            hash,
+    uint32_t            dir_offset)
+{
+    msdos_name_cache_entry_t *slot =
+        msdos_name_cache_slot(cache, dir_cln, hash);
+
+    slot->dir_cln = dir_cln;
+    slot->hash = hash;
+    slot->dir_offset = dir_offset;
+}
+
+static void
+msdos_name_cache_remove(
+    msdos_name_cache_t *cache,
+    uint32_t            dir_cln,
+    uint32_t            hash)
+{
+    msdos_name_cache_entry_t *slot =
+        msdos_name_cache_slot(cache, dir_cln, hash);
+
+    if (slot->dir_cln == dir_cln && slot->hash == hash)
+        slot->dir_cln = FAT_UNDEFINED_VALUE;
+}
+
+static bool
+msdos_name_cache_get(
+    const msdos_name_cache_t *cache,
+    uint32_t                  dir_cln,
+    uint32_t                  hash,
+    uint32_t                 *dir_offset)
+{
+    const msdos_name_cache_entry_t *slot =
+        msdos_name_cache_slot(cache, dir_cln, hash);
+
+    if (slot->dir_cln != dir_cln || slot->hash != hash)
+        return false;
+
+    *dir_offset = slot->dir_offset;
+    return true;
+}
+
+static bool
+msdos_name_cache_is_filled(const msdos_name_cache_t *cache, uint32_t dir_cln)
+{
+    int i;
+
+    for (i = 0; i < MSDOS_NAME_CACHE_DIRS; ++i)
+    {
+        if (cache->dirs[i] == dir_cln)
+            return true;
+    }
+
+    return false;
+}
+
+/* msdos_name_cache_fill --
+ *     Scan the whole directory and add the names of all directory entries
+ *     to the directory lookup cache.
+ *
+ * PARAMETERS:
+ *     fs_info  - file system info
+ *     fat_fd   - fat-file descriptor of the directory
+ *     bts2rd   - size of a directory cluster
+ *
+ * RETURNS:
+ *     RC_OK on success, or -1 if error occurred (errno set apropriately)
+ */
+static int
+msdos_name_cache_fill(
+    msdos_fs_info_t *fs_info,
+    fat_file_fd_t   *fat_fd,
+    uint32_t         bts2rd)
+{
+    msdos_name_cache_t      *cache = &fs_info->name_cache;
+    msdos_name_hash_state_t  state;
+    uint32_t                 dir_offset = 0;
+    uint32_t                 first_offset = 0;
+    uint32_t                 dir_entry;
+    ssize_t                  bytes_read;
+    bool                     remainder_empty = false;
+
+    cache->fills++;
+    msdos_name_hash_reset(&state);
+
+    while (!remainder_empty &&
+           (bytes_read = fat_file_read(&fs_info->fat, fat_fd,
+                                       dir_offset * bts2rd, bts2rd,
+                                       fs_info->cl_buf)) != FAT_EOF)
+    {
+        if (bytes_read < (ssize_t) bts2rd)
+            rtems_set_errno_and_return_minus_one(EIO);
+
+        for (dir_entry = 0;
+             dir_entry < bts2rd;
+             dir_entry += MSDOS_DIRECTORY_ENTRY_STRUCT_SIZE)
+        {
+            const char *entry = (char *) fs_info->cl_buf + dir_entry;
+
+            if (*MSDOS_DIR_ENTRY_TYPE(entry) ==
+                MSDOS_THIS_DIR_ENTRY_AND_REST_EMPTY)
+            {
+                remainder_empty = true;
+                break;
+            }
+
+            if (*MSDOS_DIR_ENTRY_TYPE(entry) == MSDOS_THIS_DIR_ENTRY_EMPTY)
+            {
+                msdos_name_hash_reset(&state);
+                continue;
+            }
+
+            if (!state.in_lfn)
+                first_offset = dir_offset;
+
+            if (msdos_name_hash_entry(fs_info->converter, &state, entry))
+            {
+                if (state.lfn_valid)
+                    msdos_name_cache_insert(cache, fat_fd->cln,
+                                            state.lfn_hash, first_offset);
+
+                if (state.sfn_valid)
+                    msdos_name_cache_insert(cache, fat_fd->cln,
+                                            state.sfn_hash, first_offset);
+            }
+        }
+
+        dir_offset++;
+    }
+
+    cache->dirs[cache->next_dir] = fat_fd->cln;
+    cache->next_dir = (cache->next_dir + 1) % MSDOS_NAME_CACHE_DIRS;
+
+    return RC_OK;
+}
+
+/* msdos_name_cache_lookup --
+ *     Get the directory cluster index at which the scan for a name should
+ *     start.  If the name is not in the directory lookup cache and the
+ *     cache was not filled for the directory, then the cache is filled
+ *     first.
+ *
+ * PARAMETERS:
+ *     fs_info    - file system info
+ *     fat_fd     - fat-file descriptor of the directory
+ *     bts2rd     - size of a directory cluster
+ *     hash       - hash of the normalized name
+ *     dir_offset - placeholder for the directory cluster index
+ *
+ * RETURNS:
+ *     true if the name is in the cache, false otherwise
+ */
+static bool
+msdos_name_cache_lookup(
+    msdos_fs_info_t *fs_info,
+    fat_file_fd_t   *fat_fd,
+    uint32_t         bts2rd,
+    uint32_t         hash,
+    uint32_t        *dir_offset)
+{
+    msdos_name_cache_t *cache = &fs_info->name_cache;
+
+    if (msdos_name_cache_get(cache, fat_fd->cln, hash, dir_offset))
+        return true;
+
+    if (msdos_name_cache_is_filled(cache, fat_fd->cln))
+        return false;
+
+    if (msdos_name_cache_fill(fs_info, fat_fd, bts2rd) != RC_OK)
+        return false;
+
+    return msdos_name_cache_get(cache, fat_fd->cln, hash, dir_offset);
+}
+
+/* msdos_init_name_cache --
+ *     Allocate the directory lookup cache.
+ *
+ * PARAMETERS:
+ *     fs_info  - file system info
+ *     count    - count of cache entries, rounded down to a power of two,
+ *                zero disables the cache
+ *
+ * RETURNS:
+ *     RC_OK on success, or -1 if error occurred (errno set apropriately)
+ */
+int
+msdos_init_name_cache(msdos_fs_info_t *fs_info, uint32_t count)
+{
+    msdos_name_cache_t *cache = &fs_info->name_cache;
+    uint32_t            i;
+
+    if (count == 0)
+        return RC_OK;
+
+    while ((count & (count - 1)) != 0)
+        count &= count - 1;
+
+    cache->entries = calloc(count, sizeof(*cache->entries));
+    if (cache->entries == NULL)
+        rtems_set_errno_and_return_minus_one(ENOMEM);
+
+    cache->mask = count - 1;
+
+    for (i = 0; i < count; ++i)
+        cache->entries[i].dir_cln = FAT_UNDEFINED_VALUE;
+
+    for (i = 0; i < MSDOS_NAME_CACHE_DIRS; ++i)
+        cache->dirs[i] = FAT_UNDEFINED_VALUE;
+
+    return RC_OK;
+}
+
+/* msdos_name_cache_forget --
+ *     Remove the name of a node from the directory lookup cache.  This must
+ *     be done before the directory entries of the node are marked empty.
+ *
+ * PARAMETERS:
+ *     mt_entry      - mount table entry
+ *     parent_fat_fd - fat-file descriptor of the directory of the node
+ *     dir_pos       - position of the directory entries of the node
+ *
+ * RETURNS:
+ *     None
+ */
+void
+msdos_name_cache_forget(
+    rtems_filesystem_mount_table_entry_t *mt_entry,
+    fat_file_fd_t                        *parent_fat_fd,
+    const fat_dir_pos_t                  *dir_pos
+    )
+{
+    msdos_fs_info_t         *fs_info = mt_entry->fs_info;
+    msdos_name_hash_state_t  state;
+    fat_pos_t                start = dir_pos->lname;
+    fat_pos_t                end = dir_pos->sname;
+    char                     entry[MSDOS_DIRECTORY_ENTRY_STRUCT_SIZE];
+
+    if (!msdos_name_cache_is_used(fs_info, parent_fat_fd))
+        return;
+
+    if (dir_pos->lname.cln == FAT_FILE_SHORT_NAME)
+        start = dir_pos->sname;
+
+    msdos_name_hash_reset(&state);
+
+    while (true)
+    {
+      uint32_t sec = (fat_cluster_num_to_sector_num(&fs_info->fat, start.cln) +
+                      (start.ofs >> fs_info->fat.vol.sec_log2));
+      uint32_t byte = (start.ofs & (fs_info->fat.vol.bps - 1));
+      ssize_t  ret;
+
+      ret = _fat_block_read(&fs_info->fat, sec, byte, sizeof(entry), entry);
+      if (ret < 0)
+        return;
+
+      if (msdos_name_hash_entry(fs_info->converter, &state, entry))
+        break;
+
+      if ((start.cln == end.cln) && (start.ofs == end.ofs))
+        return;
+
+      start.ofs += MSDOS_DIRECTORY_ENTRY_STRUCT_SIZE;
+      if (start.ofs >= fs_info->fat.vol.bpc)
+      {
+        if (fat_get_fat_cluster(&fs_info->fat, start.cln, &start.cln) != RC_OK)
+          return;
+        start.ofs = 0;
+      }
+    }
+
+    if (state.lfn_valid)
+        msdos_name_cache_remove(&fs_info->name_cache, parent_fat_fd->cln,
+                                state.lfn_hash);
+
+    if (state.sfn_valid)
+        msdos_name_cache_remove(&fs_info->name_cache, parent_fat_fd->cln,
+                                state.sfn_hash);
+}
+
+/* msdos_name_cache_forget_dir --
+ *     Forget that the directory lookup cache was filled for a directory
+ *     which is removed.  The first cluster of the directory may be used by
+ *     a new directory afterwards.
+ *
+ * PARAMETERS:
+ *     fs_info  - file system info
+ *     fat_fd   - fat-file descriptor of the directory
+ *
+ * RETURNS:
+ *     None
+ */
+void
+msdos_name_cache_forget_dir(
+    msdos_fs_info_t                      *fs_info,
+    fat_file_fd_t                        *fat_fd
+    )
+{
+    msdos_name_cache_t *cache = &fs_info->name_cache;
+    int                 i;
+
+    if (cache->entries == NULL)
+        return;
+
+    for (i = 0; i < MSDOS_NAME_CACHE_DIRS; ++i)
+    {
+        if (cache->dirs[i] == fat_fd->cln)
+            cache->dirs[i] = FAT_UNDEFINED_VALUE;
+    }
+}
+
 static int
 msdos_find_file_in_directory (
     const uint8_t                        *filename_converted,
@@ -1314,7 +1794,9 @@ msdos_find_file_in_directory (
     char                                 *name_dir_entry,
     fat_dir_pos_t                        *dir_pos,
     uint32_t                             *empty_file_offset,
-    uint32_t                             *empty_entry_count)
+    uint32_t                             *empty_entry_count,
+    const uint32_t                        start_offset,
+    uint32_t                             *found_offset)
 {
     (void) name_type;
 
@@ -1332,7 +1814,7 @@ msdos_find_file_in_directory (
     bool              filename_matched  = false;
     ssize_t           name_len_remaining;
     rtems_dosfs_convert_control *converter = fs_info->converter;
-    uint32_t          dir_offset = 0;
+    uint32_t          dir_offset = start_offset;
 
     /*
      * Scan the directory seeing if the file is present. While
@@ -1575,6 +2057,7 @@ msdos_find_file_in_directory (
                                                          name_len_for_compare);
                         } else if (name_len_remaining == 0) {
                             filename_matched = true;
+                            *found_offset = lfn_start.cln;
                             rc = msdos_on_entry_found (
                                 fs_info,
                                 fat_fd,
@@ -1610,6 +2093,9 @@ msdos_find_file_in_directory (
                                 &entry_matched);
                             if (entry_matched && name_len_remaining == 0) {
                                 filename_matched = true;
+                                *found_offset =
+                                    lfn_start.cln != FAT_FILE_SHORT_NAME ?
+                                    lfn_start.cln : dir_offset;
                                 rc = msdos_on_entry_found (
                                     fs_info,
                                     fat_fd,
@@ -1685,7 +2171,8 @@ msdos_add_file (
     const char                           *name_dir_entry,
     fat_dir_pos_t                        *dir_pos,
     uint32_t                              empty_file_offset,
-    const uint32_t                        empty_entry_count
+    const uint32_t                        empty_entry_count,
+    const uint32_t                        name_hash
 )
 {
     int              ret;
@@ -1833,7 +2320,13 @@ msdos_add_file (
                                    empty_file_offset,
                                    length, fs_info->cl_buf);
     if (bytes_written == (ssize_t) length)
+    {
+        if (msdos_name_cache_is_used(fs_info, fat_fd))
+            msdos_name_cache_insert(&fs_info->name_cache, fat_fd->cln,
+                                    name_hash, empty_file_offset / bts2rd);
+
         return 0;
+    }
     else if (bytes_written == -1)
         return -1;
     else
@@ -1862,6 +2355,11 @@ msdos_find_name_in_fat_file (
     rtems_dosfs_convert_control       *converter = fs_info->converter;
     void                              *buffer = converter->buffer.data;
     size_t                             buffer_size = converter->buffer.size;
+    bool                               use_name_cache;
+    bool                               name_cached                = false;
+    uint32_t                           name_hash                  = 0;
+    uint32_t                           start_offset               = 0;
+    uint32_t                           found_offset               = 0;
 
     assert(name_utf8_len > 0);
 
@@ -1917,6 +2415,19 @@ msdos_find_name_in_fat_file (
             retval = -1;
         break;
     }
+    use_name_cache = msdos_name_cache_is_used(fs_info, fat_fd);
+    if (retval == RC_OK && use_name_cache) {
+      name_hash = msdos_name_hash(MSDOS_NAME_HASH_INIT, buffer,
+                                  name_len_for_compare);
+
+      /*
+       * The scan for a new node must start at the beginning of the directory
+       * to find free directory entries.
+       */
+      if (!create_node)
+        name_cached = msdos_name_cache_lookup(fs_info, fat_fd, bts2rd,
+                                              name_hash, &start_offset);
+    }
     if (retval == RC_OK) {
       /* See if the file/directory does already exist */
       retval = msdos_find_file_in_directory (
@@ -1931,7 +2442,43 @@ msdos_find_name_in_fat_file (
           name_dir_entry,
           dir_pos,
           &empty_file_offset,
-          &empty_entry_count);
+          &empty_entry_count,
+          start_offset,
+          &found_offset);
+
+      /* The name was removed or moved, scan from the start */
+      if (retval == MSDOS_NAME_NOT_FOUND_ERR && name_cached) {
+        msdos_name_cache_remove(&fs_info->name_cache, fat_fd->cln, name_hash);
+        name_cached = false;
+      }
+      if (retval == MSDOS_NAME_NOT_FOUND_ERR && start_offset != 0) {
+        retval = msdos_find_file_in_directory (
+            buffer,
+            name_len_for_compare,
+            name_type,
+            fs_info,
+            fat_fd,
+            bts2rd,
+            create_node,
+            lfn_entries,
+            name_dir_entry,
+            dir_pos,
+            &empty_file_offset,
+            &empty_entry_count,
+            0,
+            &found_offset);
+      }
+
+      if (use_name_cache && !create_node) {
+        if (name_cached && retval == RC_OK)
+          fs_info->name_cache.hits++;
+        else
+          fs_info->name_cache.misses++;
+
+        if (retval == RC_OK)
+          msdos_name_cache_insert(&fs_info->name_cache, fat_fd->cln,
+                                  name_hash, found_offset);
+      }
     }
     /* Create a non-existing file/directory if requested */
     if (   retval == RC_OK
@@ -1981,7 +2528,8 @@ msdos_find_name_in_fat_file (
                 name_dir_entry,
                 dir_pos,
                 empty_file_offset,
-                empty_entry_count
+                empty_entry_count,
+                name_hash
             );
     }
 
@@ -63,8 +63,6 @@ msdos_rename(
     size_t new_namelen
 )
 {
-    (void) old_parent_loc;
-
     int                rc = RC_OK;
     fat_file_fd_t     *old_fat_fd  = old_loc->node_access;
     fat_dir_pos_t      old_pos = old_fat_fd->dir_pos;
@@ -81,6 +79,9 @@ msdos_rename(
         return rc;
     }
 
+    msdos_name_cache_forget(old_loc->mt_entry, old_parent_loc->node_access,
+                            &old_pos);
+
     /*
      * mark file removed
      */
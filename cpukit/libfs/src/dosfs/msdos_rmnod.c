@@ -27,8 +27,6 @@ int
 msdos_rmnod(const rtems_filesystem_location_info_t *parent_pathloc,
             const rtems_filesystem_location_info_t *pathloc)
 {
-    (void) parent_pathloc;
-
     int                rc = RC_OK;
     msdos_fs_info_t   *fs_info = pathloc->mt_entry->fs_info;
     fat_file_fd_t     *fat_fd = pathloc->node_access;
@@ -66,6 +64,9 @@ msdos_rmnod(const rtems_filesystem_location_info_t *parent_pathloc,
          */
     }
 
+    msdos_name_cache_forget(pathloc->mt_entry, parent_pathloc->node_access,
+                            &fat_fd->dir_pos);
+
     /* mark file removed */
     rc = msdos_set_first_char4file_name(pathloc->mt_entry, &fat_fd->dir_pos,
                                         MSDOS_THIS_DIR_ENTRY_EMPTY);
@@ -74,6 +75,9 @@ msdos_rmnod(const rtems_filesystem_location_info_t *parent_pathloc,
         return rc;
     }
 
+    if (fat_fd->fat_file_type == FAT_DIRECTORY)
+        msdos_name_cache_forget_dir(fs_info, fat_fd);
+
     fat_file_mark_removed(&fs_info->fat, fat_fd);
 
     return rc;
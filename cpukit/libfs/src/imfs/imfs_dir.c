@@ -45,6 +45,8 @@ IMFS_jnode_t *IMFS_node_initialize_directory( IMFS_jnode_t *node, void *arg )
   IMFS_directory_t *dir = (IMFS_directory_t *) node;
 
   rtems_chain_initialize_empty( &dir->Entries );
+  dir->entry_count = 0;
+  dir->index = NULL;
 
   return node;
 }
@@ -0,0 +1,291 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup IMFS
+ *
+ * @brief IMFS Directory Name Hash Index
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/imfs.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * The index is an open addressing hash table with linear probing.  The load
+ * factor is kept at or below one half, so that unsuccessful searches
+ * terminate quickly.  The name hash of each entry is cached in its slot to
+ * avoid name comparisons for most probe collisions and to move entries
+ * during deletions without rehashing the names.
+ */
+
+typedef struct {
+  uint32_t      hash;
+  IMFS_jnode_t *node;
+} IMFS_directory_index_slot;
+
+struct IMFS_directory_index {
+  size_t                    mask;
+  IMFS_directory_index_slot slots[ RTEMS_ZERO_LENGTH_ARRAY ];
+};
+
+#define IMFS_DIRECTORY_INDEX_MIN_SLOTS 64
+
+static uint32_t IMFS_directory_index_hash( const char *name, size_t namelen )
+{
+  uint32_t hash;
+  size_t   i;
+
+  /* FNV-1a */
+  hash = 2166136261U;
+
+  for ( i = 0; i < namelen; ++i ) {
+    hash ^= (unsigned char) name[ i ];
+    hash *= 16777619U;
+  }
+
+  return hash;
+}
+
+static void IMFS_directory_index_insert(
+  IMFS_directory_index *index,
+  IMFS_jnode_t         *node
+)
+{
+  uint32_t hash;
+  size_t   i;
+
+  hash = IMFS_directory_index_hash( node->name, node->namelen );
+  i = hash & index->mask;
+
+  while ( index->slots[ i ].node != NULL ) {
+    i = ( i + 1 ) & index->mask;
+  }
+
+  index->slots[ i ].hash = hash;
+  index->slots[ i ].node = node;
+}
+
+static size_t IMFS_directory_index_slot_count( size_t entry_count )
+{
+  size_t slot_count;
+
+  slot_count = IMFS_DIRECTORY_INDEX_MIN_SLOTS;
+
+  while ( slot_count < 2 * entry_count ) {
+    slot_count *= 2;
+  }
+
+  return slot_count;
+}
+
+static IMFS_directory_index *IMFS_directory_index_build(
+  IMFS_directory_t *dir,
+  size_t            slot_count
+)
+{
+  IMFS_directory_index *index;
+  rtems_chain_node     *current;
+  rtems_chain_node     *tail;
+
+  index = calloc(
+    1,
+    sizeof( *index ) + slot_count * sizeof( index->slots[ 0 ] )
+  );
+
+  if ( index == NULL ) {
+    return NULL;
+  }
+
+  index->mask = slot_count - 1;
+  current = rtems_chain_first( &dir->Entries );
+  tail = rtems_chain_tail( &dir->Entries );
+
+  while ( current != tail ) {
+    IMFS_directory_index_insert( index, (IMFS_jnode_t *) current );
+    current = rtems_chain_next( current );
+  }
+
+  return index;
+}
+
+static void IMFS_directory_index_rebuild(
+  IMFS_directory_t *dir,
+  size_t            slot_count
+)
+{
+  IMFS_directory_index *index;
+
+  index = IMFS_directory_index_build( dir, slot_count );
+  free( dir->index );
+
+  /*
+   * Without memory for the index, fall back to the linear search in the
+   * directory entries.
+   */
+  dir->index = index;
+}
+
+void IMFS_directory_index_add(
+  IMFS_directory_t *dir,
+  IMFS_jnode_t     *entry_node
+)
+{
+  IMFS_directory_index *index;
+  size_t                threshold;
+
+  index = dir->index;
+
+  if ( index == NULL ) {
+    threshold = imfs_directory_index_threshold;
+
+    /*
+     * Try to build the index only at multiples of the threshold to keep the
+     * overhead bounded if a previous attempt failed due to a lack of memory.
+     */
+    if ( ( dir->entry_count - threshold ) % threshold == 0 ) {
+      IMFS_directory_index_rebuild(
+        dir,
+        IMFS_directory_index_slot_count( dir->entry_count )
+      );
+    }
+  } else if ( 2 * dir->entry_count > index->mask + 1 ) {
+    IMFS_directory_index_rebuild( dir, 2 * ( index->mask + 1 ) );
+  } else {
+    IMFS_directory_index_insert( index, entry_node );
+  }
+}
+
+void IMFS_directory_index_remove(
+  IMFS_directory_t *dir,
+  IMFS_jnode_t     *entry_node
+)
+{
+  IMFS_directory_index *index;
+  size_t                mask;
+  size_t                i;
+  size_t                j;
+
+  index = dir->index;
+
+  if ( 2 * dir->entry_count < imfs_directory_index_threshold ) {
+    free( index );
+    dir->index = NULL;
+    return;
+  }
+
+  mask = index->mask;
+  i = IMFS_directory_index_hash( entry_node->name, entry_node->namelen )
+    & mask;
+
+  while ( index->slots[ i ].node != entry_node ) {
+    IMFS_assert( index->slots[ i ].node != NULL );
+    i = ( i + 1 ) & mask;
+  }
+
+  /*
+   * Use a backward shift deletion so that no tombstones are necessary.  Move
+   * each following entry of the probe sequence into the hole unless its home
+   * slot lies cyclically in between the hole and its current slot.
+   */
+  j = i;
+
+  while ( true ) {
+    size_t home;
+
+    j = ( j + 1 ) & mask;
+
+    if ( index->slots[ j ].node == NULL ) {
+      break;
+    }
+
+    home = index->slots[ j ].hash & mask;
+
+    if ( ( ( j - home ) & mask ) >= ( ( j - i ) & mask ) ) {
+      index->slots[ i ] = index->slots[ j ];
+      i = j;
+    }
+  }
+
+  index->slots[ i ].node = NULL;
+
+  if (
+    mask + 1 > IMFS_DIRECTORY_INDEX_MIN_SLOTS
+      && 8 * dir->entry_count < mask + 1
+  ) {
+    IMFS_directory_index *smaller;
+
+    smaller = IMFS_directory_index_build( dir, ( mask + 1 ) / 2 );
+
+    if ( smaller != NULL ) {
+      free( index );
+      dir->index = smaller;
+    }
+  }
+}
+
+IMFS_jnode_t *IMFS_directory_index_search(
+  const IMFS_directory_t *dir,
+  const char             *name,
+  size_t                  namelen
+)
+{
+  const IMFS_directory_index *index;
+  uint32_t                    hash;
+  size_t                      i;
+
+  index = dir->index;
+  hash = IMFS_directory_index_hash( name, namelen );
+  i = hash & index->mask;
+
+  while ( true ) {
+    IMFS_jnode_t *node;
+
+    node = index->slots[ i ].node;
+
+    if ( node == NULL ) {
+      return NULL;
+    }
+
+    if (
+      index->slots[ i ].hash == hash
+        && node->namelen == namelen
+        && memcmp( node->name, name, namelen ) == 0
+    ) {
+      return node;
+    }
+
+    i = ( i + 1 ) & index->mask;
+  }
+}
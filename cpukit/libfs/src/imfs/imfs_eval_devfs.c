@@ -98,6 +98,11 @@ static IMFS_jnode_t *IMFS_devfs_search(
 
   path = rtems_filesystem_eval_path_get_path( ctx );
   pathlen = rtems_filesystem_eval_path_get_pathlen( ctx );
+
+  if ( dir->index != NULL ) {
+    return IMFS_directory_index_search( dir, path, pathlen );
+  }
+
   entries = &dir->Entries;
   current = rtems_chain_first( entries );
   tail = rtems_chain_tail( entries );
@@ -0,0 +1,531 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup IMFS
+ *
+ * @brief IMFS Extent File Support
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/imfsimpl.h>
+
+#include <sys/param.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define IMFS_EXTFILE_MINIMUM_EXTENT_SIZE 512
+
+#define IMFS_EXTFILE_INITIAL_EXTENT_CAPACITY 4
+
+static size_t IMFS_extfile_capacity( const IMFS_extfile_t *extfile )
+{
+  const IMFS_extfile_extent *last;
+
+  if ( extfile->extent_count == 0 ) {
+    return 0;
+  }
+
+  last = &extfile->extents[ extfile->extent_count - 1 ];
+  return last->start + last->size;
+}
+
+static size_t IMFS_extfile_round_up( size_t size )
+{
+  return RTEMS_ALIGN_UP( size, IMFS_EXTFILE_MINIMUM_EXTENT_SIZE );
+}
+
+/*
+ * Returns the index of the extent which contains the offset.  The offset
+ * must be less than the capacity of the file.
+ */
+static size_t IMFS_extfile_find_extent(
+  const IMFS_extfile_t *extfile,
+  size_t                offset
+)
+{
+  size_t low;
+  size_t high;
+
+  low = 0;
+  high = extfile->extent_count - 1;
+
+  while ( low < high ) {
+    size_t mid;
+
+    mid = low + ( high - low + 1 ) / 2;
+
+    if ( extfile->extents[ mid ].start <= offset ) {
+      low = mid;
+    } else {
+      high = mid - 1;
+    }
+  }
+
+  return low;
+}
+
+static bool IMFS_extfile_add_extent(
+  IMFS_extfile_t *extfile,
+  size_t          capacity,
+  size_t          needed
+)
+{
+  IMFS_extfile_extent *extent;
+  unsigned char       *data;
+  size_t               size;
+
+  if ( extfile->extent_count == extfile->extent_capacity ) {
+    IMFS_extfile_extent *extents;
+    size_t               extent_capacity;
+
+    extent_capacity = extfile->extent_capacity;
+
+    if ( extent_capacity == 0 ) {
+      extent_capacity = IMFS_EXTFILE_INITIAL_EXTENT_CAPACITY;
+    } else {
+      extent_capacity *= 2;
+    }
+
+    extents = realloc(
+      extfile->extents,
+      extent_capacity * sizeof( *extents )
+    );
+
+    if ( extents == NULL ) {
+      return false;
+    }
+
+    extfile->extents = extents;
+    extfile->extent_capacity = extent_capacity;
+  }
+
+  /*
+   * Grow geometrically, so that the extent count is logarithmic in the file
+   * size.  If the geometric size is not available, then try to allocate
+   * only what is needed.
+   */
+  size = IMFS_extfile_round_up( needed );
+
+  if ( size < capacity ) {
+    data = malloc( capacity );
+
+    if ( data != NULL ) {
+      size = capacity;
+    }
+  } else {
+    data = NULL;
+  }
+
+  if ( data == NULL ) {
+    data = malloc( size );
+
+    if ( data == NULL ) {
+      return false;
+    }
+  }
+
+  extent = &extfile->extents[ extfile->extent_count ];
+  extent->start = capacity;
+  extent->size = size;
+  extent->data = data;
+  extent->mapped = false;
+  ++extfile->extent_count;
+
+  return true;
+}
+
+static int IMFS_extfile_reserve( IMFS_extfile_t *extfile, off_t length )
+{
+  size_t capacity;
+
+  if ( length < 0 || (uintmax_t) length > SIZE_MAX / 2 ) {
+    rtems_set_errno_and_return_minus_one( EFBIG );
+  }
+
+  capacity = IMFS_extfile_capacity( extfile );
+
+  while ( capacity < (size_t) length ) {
+    if ( !IMFS_extfile_add_extent(
+      extfile,
+      capacity,
+      (size_t) length - capacity
+    ) ) {
+      rtems_set_errno_and_return_minus_one( ENOSPC );
+    }
+
+    capacity = IMFS_extfile_capacity( extfile );
+  }
+
+  return 0;
+}
+
+static void IMFS_extfile_zero(
+  IMFS_extfile_t *extfile,
+  size_t          begin,
+  size_t          end
+)
+{
+  size_t i;
+
+  if ( begin >= end ) {
+    return;
+  }
+
+  i = IMFS_extfile_find_extent( extfile, begin );
+
+  while ( begin < end ) {
+    const IMFS_extfile_extent *extent;
+    size_t                     offset;
+    size_t                     count;
+
+    extent = &extfile->extents[ i ];
+    offset = begin - extent->start;
+    count = MIN( extent->size - offset, end - begin );
+    memset( &extent->data[ offset ], 0, count );
+    begin += count;
+    ++i;
+  }
+}
+
+static void IMFS_extfile_release_extents(
+  IMFS_extfile_t *extfile,
+  size_t          length
+)
+{
+  while ( extfile->extent_count > 0 ) {
+    IMFS_extfile_extent *last;
+
+    last = &extfile->extents[ extfile->extent_count - 1 ];
+
+    if ( last->start < length || last->mapped ) {
+      break;
+    }
+
+    free( last->data );
+    --extfile->extent_count;
+  }
+
+  if ( extfile->extent_count == 0 ) {
+    free( extfile->extents );
+    extfile->extents = NULL;
+    extfile->extent_capacity = 0;
+  }
+}
+
+static ssize_t IMFS_extfile_read(
+  rtems_libio_t *iop,
+  void          *buffer,
+  size_t         count
+)
+{
+  IMFS_extfile_t *extfile;
+  unsigned char  *out;
+  size_t          size;
+  size_t          begin;
+  size_t          remaining;
+  size_t          i;
+
+  extfile = IMFS_iop_to_extfile( iop );
+  size = extfile->File.size;
+
+  if ( iop->offset >= (off_t) size ) {
+    return 0;
+  }
+
+  begin = (size_t) iop->offset;
+  count = MIN( count, size - begin );
+  remaining = count;
+  out = buffer;
+  i = IMFS_extfile_find_extent( extfile, begin );
+
+  while ( remaining > 0 ) {
+    const IMFS_extfile_extent *extent;
+    size_t                     offset;
+    size_t                     n;
+
+    extent = &extfile->extents[ i ];
+    offset = begin - extent->start;
+    n = MIN( extent->size - offset, remaining );
+    memcpy( out, &extent->data[ offset ], n );
+    out += n;
+    begin += n;
+    remaining -= n;
+    ++i;
+  }
+
+  IMFS_update_atime( &extfile->File.Node );
+  iop->offset += (off_t) count;
+
+  return (ssize_t) count;
+}
+
+static ssize_t IMFS_extfile_write(
+  rtems_libio_t *iop,
+  const void    *buffer,
+  size_t         count
+)
+{
+  IMFS_extfile_t      *extfile;
+  const unsigned char *in;
+  size_t               begin;
+  size_t               remaining;
+  size_t               i;
+  int                  rv;
+
+  extfile = IMFS_iop_to_extfile( iop );
+
+  if ( rtems_libio_iop_is_append( iop ) ) {
+    iop->offset = extfile->File.size;
+  }
+
+  if ( count == 0 ) {
+    return 0;
+  }
+
+  if ( (uintmax_t) iop->offset + count > SIZE_MAX / 2 ) {
+    rtems_set_errno_and_return_minus_one( EFBIG );
+  }
+
+  rv = IMFS_extfile_reserve( extfile, iop->offset + (off_t) count );
+  if ( rv != 0 ) {
+    return rv;
+  }
+
+  begin = (size_t) iop->offset;
+  IMFS_extfile_zero( extfile, extfile->File.size, begin );
+  remaining = count;
+  in = buffer;
+  i = IMFS_extfile_find_extent( extfile, begin );
+
+  while ( remaining > 0 ) {
+    const IMFS_extfile_extent *extent;
+    size_t                     offset;
+    size_t                     n;
+
+    extent = &extfile->extents[ i ];
+    offset = begin - extent->start;
+    n = MIN( extent->size - offset, remaining );
+    memcpy( &extent->data[ offset ], in, n );
+    in += n;
+    begin += n;
+    remaining -= n;
+    ++i;
+  }
+
+  if ( begin > extfile->File.size ) {
+    extfile->File.size = begin;
+  }
+
+  IMFS_mtime_ctime_update( &extfile->File.Node );
+  iop->offset += (off_t) count;
+
+  return (ssize_t) count;
+}
+
+static int IMFS_extfile_ftruncate( rtems_libio_t *iop, off_t length )
+{
+  IMFS_extfile_t *extfile;
+
+  extfile = IMFS_iop_to_extfile( iop );
+
+  if ( length > (off_t) extfile->File.size ) {
+    int rv;
+
+    rv = IMFS_extfile_reserve( extfile, length );
+    if ( rv != 0 ) {
+      return rv;
+    }
+
+    IMFS_extfile_zero( extfile, extfile->File.size, (size_t) length );
+  } else {
+    /*
+     * In contrast to the block based memory files, release the extents which
+     * are no longer used by the file.
+     */
+    IMFS_extfile_release_extents( extfile, (size_t) length );
+  }
+
+  extfile->File.size = (size_t) length;
+  IMFS_mtime_ctime_update( &extfile->File.Node );
+
+  return 0;
+}
+
+/*
+ * Replaces the extents first up to and including last by one extent with the
+ * same data.  This keeps the geometric growth of the extent sizes.
+ */
+static bool IMFS_extfile_coalesce(
+  IMFS_extfile_t *extfile,
+  size_t          first,
+  size_t          last
+)
+{
+  IMFS_extfile_extent *extents;
+  unsigned char       *data;
+  size_t               size;
+  size_t               offset;
+  size_t               i;
+
+  extents = extfile->extents;
+  size = 0;
+
+  for ( i = first; i <= last; ++i ) {
+    if ( extents[ i ].mapped ) {
+      return false;
+    }
+
+    size += extents[ i ].size;
+  }
+
+  data = malloc( size );
+  if ( data == NULL ) {
+    return false;
+  }
+
+  offset = 0;
+
+  for ( i = first; i <= last; ++i ) {
+    memcpy( &data[ offset ], extents[ i ].data, extents[ i ].size );
+    offset += extents[ i ].size;
+    free( extents[ i ].data );
+  }
+
+  extents[ first ].size = size;
+  extents[ first ].data = data;
+  memmove(
+    &extents[ first + 1 ],
+    &extents[ last + 1 ],
+    ( extfile->extent_count - last - 1 ) * sizeof( extents[ 0 ] )
+  );
+  extfile->extent_count -= last - first;
+
+  return true;
+}
+
+static int IMFS_extfile_mmap(
+  rtems_libio_t *iop,
+  void         **addr,
+  size_t         len,
+  int            prot,
+  off_t          off
+)
+{
+  (void) prot;
+
+  IMFS_extfile_t      *extfile;
+  IMFS_extfile_extent *extent;
+  size_t               begin;
+  size_t               first;
+  size_t               last;
+
+  extfile = IMFS_iop_to_extfile( iop );
+
+  /*
+   * The mapping refers directly to the file data, so it cannot be placed at a
+   * fixed address.  The range was already checked against the file size by
+   * mmap().
+   */
+  if ( *addr != NULL ) {
+    rtems_set_errno_and_return_minus_one( ENOTSUP );
+  }
+
+  begin = (size_t) off;
+  first = IMFS_extfile_find_extent( extfile, begin );
+  last = IMFS_extfile_find_extent( extfile, begin + len - 1 );
+
+  /*
+   * A range which spans several extents is made contiguous once.  This is
+   * not possible if one of the extents is already mapped.
+   */
+  if (
+    first != last
+      && !IMFS_extfile_coalesce( extfile, first, last )
+  ) {
+    rtems_set_errno_and_return_minus_one( ENOTSUP );
+  }
+
+  extent = &extfile->extents[ first ];
+  extent->mapped = true;
+  IMFS_update_atime( &extfile->File.Node );
+  *addr = &extent->data[ begin - extent->start ];
+
+  return 0;
+}
+
+/*
+ * A shared mapping holds a reference to the file, so the file is destroyed
+ * after the unmap of all mappings of the file.
+ */
+static void IMFS_extfile_destroy( IMFS_jnode_t *node )
+{
+  IMFS_extfile_t *extfile;
+  size_t          i;
+
+  extfile = (IMFS_extfile_t *) node;
+
+  for ( i = 0; i < extfile->extent_count; ++i ) {
+    free( extfile->extents[ i ].data );
+  }
+
+  free( extfile->extents );
+  IMFS_node_destroy_default( node );
+}
+
+static const rtems_filesystem_file_handlers_r IMFS_extfile_handlers = {
+  .open_h = rtems_filesystem_default_open,
+  .close_h = rtems_filesystem_default_close,
+  .read_h = IMFS_extfile_read,
+  .write_h = IMFS_extfile_write,
+  .ioctl_h = rtems_filesystem_default_ioctl,
+  .lseek_h = rtems_filesystem_default_lseek_file,
+  .fstat_h = IMFS_stat_file,
+  .ftruncate_h = IMFS_extfile_ftruncate,
+  .fsync_h = rtems_filesystem_default_fsync_or_fdatasync_success,
+  .fdatasync_h = rtems_filesystem_default_fsync_or_fdatasync_success,
+  .fcntl_h = rtems_filesystem_default_fcntl,
+  .kqfilter_h = rtems_filesystem_default_kqfilter,
+  .mmap_h = IMFS_extfile_mmap,
+  .poll_h = rtems_filesystem_default_poll,
+  .readv_h = rtems_filesystem_default_readv,
+  .writev_h = rtems_filesystem_default_writev
+};
+
+const IMFS_mknod_control IMFS_mknod_control_extfile = {
+  { .handlers = &IMFS_extfile_handlers,
+    .node_initialize = IMFS_node_initialize_default,
+    .node_remove = IMFS_node_remove_default,
+    .node_destroy = IMFS_extfile_destroy },
+  .node_size = sizeof( IMFS_extfile_t )
+};
@@ -36,6 +36,7 @@
 #include "config.h"
 #endif
 
+#include <sys/mman.h>
 #include <string.h>
 
 #include <rtems/imfsimpl.h>
@@ -103,6 +104,39 @@ static int IMFS_linfile_open(
   return 0;
 }
 
+static int IMFS_linfile_mmap(
+  rtems_libio_t *iop,
+  void         **addr,
+  size_t         len,
+  int            prot,
+  off_t          off
+)
+{
+  (void) len;
+
+  IMFS_file_t *file = IMFS_iop_to_file( iop );
+
+  /*
+   * The mapping refers directly to the file image, so it cannot be placed at
+   * a fixed address.  The range was already checked against the file size by
+   * mmap().  A linear file opened for writing is a memory file due to the copy
+   * on write, so the image is only mapped through read-only descriptors.  The
+   * image may be in read-only memory, so it cannot be mapped for writing.
+   */
+  if ( ( prot & PROT_WRITE ) != 0 ) {
+    rtems_set_errno_and_return_minus_one( EACCES );
+  }
+
+  if ( *addr != NULL ) {
+    rtems_set_errno_and_return_minus_one( ENOTSUP );
+  }
+
+  IMFS_update_atime( &file->Node );
+  *addr = &file->Linearfile.direct[ off ];
+
+  return 0;
+}
+
 static const rtems_filesystem_file_handlers_r IMFS_linfile_handlers = {
   .open_h = IMFS_linfile_open,
   .close_h = rtems_filesystem_default_close,
@@ -116,7 +150,7 @@ static const rtems_filesystem_file_handlers_r IMFS_linfile_handlers = {
   .fdatasync_h = rtems_filesystem_default_fsync_or_fdatasync_success,
   .fcntl_h = rtems_filesystem_default_fcntl,
   .kqfilter_h = rtems_filesystem_default_kqfilter,
-  .mmap_h = rtems_filesystem_default_mmap,
+  .mmap_h = IMFS_linfile_mmap,
   .poll_h = rtems_filesystem_default_poll,
   .readv_h = rtems_filesystem_default_readv,
   .writev_h = rtems_filesystem_default_writev
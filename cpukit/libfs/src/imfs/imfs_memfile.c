@@ -116,6 +116,46 @@ static ssize_t memfile_write(
   return status;
 }
 
+/*
+ *  memfile_mmap
+ *
+ *  The blocks of a memory file are not contiguous, so only ranges within
+ *  one block of IMFS_MEMFILE_BYTES_PER_BLOCK bytes can be mapped without a
+ *  copy.  A range which spans several blocks or contains a hole fails with
+ *  ENOTSUP.  Use extent files for larger shared mappings.  The blocks are not
+ *  reclaimed until the file is destroyed.  The mapping holds a reference to
+ *  the file, so this is after the unmap.
+ */
+static int memfile_mmap(
+  rtems_libio_t *iop,
+  void         **addr,
+  size_t         len,
+  int            prot,
+  off_t          off
+)
+{
+  (void) prot;
+
+  IMFS_memfile_t *memfile = IMFS_iop_to_memfile( iop );
+  unsigned int    block = off / IMFS_MEMFILE_BYTES_PER_BLOCK;
+  unsigned int    offset = off % IMFS_MEMFILE_BYTES_PER_BLOCK;
+  block_p        *block_ptr;
+
+  if ( *addr != NULL || len > IMFS_MEMFILE_BYTES_PER_BLOCK - offset ) {
+    rtems_set_errno_and_return_minus_one( ENOTSUP );
+  }
+
+  block_ptr = IMFS_memfile_get_block_pointer( memfile, block, 0 );
+  if ( block_ptr == NULL || *block_ptr == NULL ) {
+    rtems_set_errno_and_return_minus_one( ENOTSUP );
+  }
+
+  IMFS_update_atime( &memfile->File.Node );
+  *addr = &( *block_ptr )[ offset ];
+
+  return 0;
+}
+
 /*
  *  memfile_stat
  *
@@ -900,7 +940,7 @@ static const rtems_filesystem_file_handlers_r IMFS_memfile_handlers = {
   .fdatasync_h = rtems_filesystem_default_fsync_or_fdatasync_success,
   .fcntl_h = rtems_filesystem_default_fcntl,
   .kqfilter_h = rtems_filesystem_default_kqfilter,
-  .mmap_h = rtems_filesystem_default_mmap,
+  .mmap_h = memfile_mmap,
   .poll_h = rtems_filesystem_default_poll,
   .readv_h = rtems_filesystem_default_readv,
   .writev_h = rtems_filesystem_default_writev
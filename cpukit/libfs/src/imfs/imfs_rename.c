@@ -103,6 +103,13 @@ int IMFS_rename(
 
   memcpy( control->name, name, namelen );
 
+  /*
+   * Remove the node before the name change, the directory index uses the
+   * name to locate the node.  The name of a renamed node is stored in the
+   * control which is freed by IMFS_restore_replaced_control().
+   */
+  IMFS_remove_from_directory( node );
+
   if ( node->control->node_destroy == IMFS_renamed_destroy ) {
     IMFS_restore_replaced_control( node );
   }
@@ -114,7 +121,6 @@ int IMFS_rename(
   node->name = control->name;
   node->namelen = namelen;
 
-  IMFS_remove_from_directory( node );
   IMFS_add_to_directory( new_parent, node );
   IMFS_update_ctime( node );
 
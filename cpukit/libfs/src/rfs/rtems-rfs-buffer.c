@@ -292,6 +292,42 @@ int rtems_rfs_buffer_handle_release(rtems_rfs_file_system* fs,
   return rc;
 }
 
+int rtems_rfs_buffer_transfer(rtems_rfs_file_system* fs,
+                              rtems_rfs_buffer_block block, size_t count,
+                              void* data, bool read) {
+#if RTEMS_RFS_USE_LIBBLOCK
+  rtems_status_code sc;
+
+  if (rtems_rfs_trace(RTEMS_RFS_TRACE_BUFFER_HANDLE_REQUEST)) {
+    printf("rtems-rfs: buffer-transfer: %s block=%" PRIu32 " count=%zu\n",
+           read ? "read" : "write", block, count);
+  }
+
+  if (read) {
+    sc = rtems_bdbuf_read_direct(rtems_rfs_fs_device(fs), block, count, data);
+  } else {
+    sc = rtems_bdbuf_write_direct(rtems_rfs_fs_device(fs), block, count, data);
+  }
+
+  if (sc != RTEMS_SUCCESSFUL) {
+    if (rtems_rfs_trace(RTEMS_RFS_TRACE_BUFFER_HANDLE_REQUEST)) {
+      printf("rtems-rfs: buffer-transfer: failed: %s\n",
+             rtems_status_text(sc));
+    }
+    return EIO;
+  }
+
+  return 0;
+#else
+  (void)fs;
+  (void)block;
+  (void)count;
+  (void)data;
+  (void)read;
+  return ENOTSUP;
+#endif
+}
+
 int rtems_rfs_buffer_open(const char* name, rtems_rfs_file_system* fs) {
   struct stat st;
 #if RTEMS_RFS_USE_LIBBLOCK
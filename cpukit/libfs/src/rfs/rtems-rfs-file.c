@@ -235,6 +235,69 @@ int rtems_rfs_file_close(rtems_rfs_file_system* fs,
   return rrc;
 }
 
+/**
+ * Update the position of the file handle by the amount of data read or
+ * written. If the position is past the current size update the size with the
+ * new length and update the times.
+ */
+static void rtems_rfs_file_io_update(rtems_rfs_file_handle* handle, size_t size,
+                                     bool read) {
+  size_t block_size = rtems_rfs_fs_block_size(rtems_rfs_file_fs(handle));
+  bool atime;
+  bool mtime;
+  bool length;
+
+  /*
+   * Update the handle's position. If the offset is bigger than the block size
+   * increase the block number and adjust the offset.
+   *
+   * If we are the last block and the position is past the current size update
+   * the size with the new length. The map holds the block count.
+   */
+  handle->bpos.boff += size;
+
+  if (handle->bpos.boff >= block_size) {
+    handle->bpos.bno += handle->bpos.boff / block_size;
+    handle->bpos.boff %= block_size;
+  }
+
+  length = false;
+  mtime = !read;
+
+  if (!read && rtems_rfs_block_map_past_end(rtems_rfs_file_map(handle),
+                                            rtems_rfs_file_bpos(handle))) {
+    rtems_rfs_block_map_set_size_offset(rtems_rfs_file_map(handle),
+                                        handle->bpos.boff);
+    length = true;
+  }
+
+  atime = rtems_rfs_file_update_atime(handle);
+  mtime = rtems_rfs_file_update_mtime(handle) && mtime;
+  length = rtems_rfs_file_update_length(handle) && length;
+
+  if (rtems_rfs_trace(RTEMS_RFS_TRACE_FILE_IO)) {
+    printf("rtems-rfs: file-io: update: pos=%" PRIu32 ":%" PRIu32 " %c %c %c\n",
+           handle->bpos.bno, handle->bpos.boff, atime ? 'A' : '-',
+           mtime ? 'M' : '-', length ? 'L' : '-');
+  }
+
+  if (atime || mtime) {
+    time_t now = time(NULL);
+    if (read && atime) {
+      handle->shared->atime = now;
+    }
+    if (!read && mtime) {
+      handle->shared->mtime = now;
+    }
+  }
+  if (length) {
+    handle->shared->size.count =
+        rtems_rfs_block_map_count(rtems_rfs_file_map(handle));
+    handle->shared->size.offset =
+        rtems_rfs_block_map_size_offset(rtems_rfs_file_map(handle));
+  }
+}
+
 int rtems_rfs_file_io_start(rtems_rfs_file_handle* handle, size_t* available,
                             bool read) {
   size_t size;
@@ -323,9 +386,6 @@ int rtems_rfs_file_io_start(rtems_rfs_file_handle* handle, size_t* available,
 
 int rtems_rfs_file_io_end(rtems_rfs_file_handle* handle, size_t size,
                           bool read) {
-  bool atime;
-  bool mtime;
-  bool length;
   int rc = 0;
 
   if (rtems_rfs_trace(RTEMS_RFS_TRACE_FILE_IO)) {
@@ -348,55 +408,164 @@ int rtems_rfs_file_io_end(rtems_rfs_file_handle* handle, size_t size,
     }
   }
 
+  rtems_rfs_file_io_update(handle, size, read);
+
+  return rc;
+}
+
+int rtems_rfs_file_io_direct(rtems_rfs_file_handle* handle, void* data,
+                             size_t* size, bool read) {
+  rtems_rfs_file_system* fs = rtems_rfs_file_fs(handle);
+  rtems_rfs_block_map* map = rtems_rfs_file_map(handle);
+  size_t block_size = rtems_rfs_fs_block_size(fs);
+  uint8_t* buffer = data;
+  rtems_rfs_block_no bno;
+  rtems_rfs_block_no count;
+  rtems_rfs_block_off offset;
+  size_t blocks;
+  size_t done;
+  int rc;
+
+  blocks = *size / block_size;
+  *size = 0;
+
+  if (rtems_rfs_buffer_handle_has_block(&handle->buffer) ||
+      (rtems_rfs_file_block_offset(handle) != 0)) {
+    return 0;
+  }
+
+  bno = rtems_rfs_file_block(handle);
+
+  if (read) {
+    count = rtems_rfs_block_map_count(map);
+
+    /*
+     * Only read whole blocks. A partial last block is left for the buffered
+     * path.
+     */
+    if ((count > 0) && (rtems_rfs_block_map_size_offset(map) != 0)) {
+      --count;
+    }
+
+    if (bno >= count) {
+      return 0;
+    }
+
+    if (blocks > (count - bno)) {
+      blocks = count - bno;
+    }
+  }
+
+  if (blocks < RTEMS_RFS_FILE_IO_DIRECT_MIN_BLOCKS) {
+    return 0;
+  }
+
   /*
-   * Update the handle's position. Only a block size can be handled at a time
-   * so no special maths is needed. If the offset is bigger than the block size
-   * increase the block number and adjust the offset.
-   *
-   * If we are the last block and the position is past the current size update
-   * the size with the new length. The map holds the block count.
+   * The user buffer is used for the media transfer. Leave a buffer which is
+   * not aligned to the cache line size to the buffered path.
    */
-  handle->bpos.boff += size;
+  if ((((uintptr_t) buffer) | (blocks * block_size)) &
+      (CPU_CACHE_LINE_BYTES - 1)) {
+    return 0;
+  }
 
-  if (handle->bpos.boff >= rtems_rfs_fs_block_size(rtems_rfs_file_fs(handle))) {
-    handle->bpos.bno++;
-    handle->bpos.boff -= rtems_rfs_fs_block_size(rtems_rfs_file_fs(handle));
+  if (rtems_rfs_trace(RTEMS_RFS_TRACE_FILE_IO)) {
+    printf("rtems-rfs: file-io: direct: %s pos=%" PRIu32 " blocks=%zu\n",
+           read ? "read" : "write", bno, blocks);
   }
 
-  length = false;
-  mtime = !read;
+  /*
+   * Buffers held on the release lists are not visible to the direct transfer
+   * so hand them back to the cache first.
+   */
+  rc = rtems_rfs_buffers_release(fs);
+  if (rc > 0) {
+    return rc;
+  }
 
-  if (!read && rtems_rfs_block_map_past_end(rtems_rfs_file_map(handle),
-                                            rtems_rfs_file_bpos(handle))) {
-    rtems_rfs_block_map_set_size_offset(rtems_rfs_file_map(handle),
-                                        handle->bpos.boff);
-    length = true;
+  count = rtems_rfs_block_map_count(map);
+  offset = rtems_rfs_block_map_size_offset(map);
+
+  if (!read && ((bno + blocks) > count)) {
+    rtems_rfs_block_no block;
+
+    rc = rtems_rfs_block_map_grow(fs, map, (bno + blocks) - count, &block);
+    if (rc > 0) {
+      /*
+       * Undo any partial growth and let the buffered path write what fits.
+       */
+      rtems_rfs_block_map_shrink(fs, map,
+                                 rtems_rfs_block_map_count(map) - count);
+      rtems_rfs_block_map_set_size_offset(map, offset);
+      return 0;
+    }
   }
 
-  atime = rtems_rfs_file_update_atime(handle);
-  mtime = rtems_rfs_file_update_mtime(handle) && mtime;
-  length = rtems_rfs_file_update_length(handle) && length;
+  done = 0;
 
-  if (rtems_rfs_trace(RTEMS_RFS_TRACE_FILE_IO)) {
-    printf("rtems-rfs: file-io:   end: pos=%" PRIu32 ":%" PRIu32 " %c %c %c\n",
-           handle->bpos.bno, handle->bpos.boff, atime ? 'A' : '-',
-           mtime ? 'M' : '-', length ? 'L' : '-');
+  while (done < blocks) {
+    rtems_rfs_block_pos bpos;
+    rtems_rfs_buffer_block first;
+    rtems_rfs_buffer_block block;
+    size_t run;
+
+    rtems_rfs_block_set_bpos_zero(&bpos);
+    bpos.bno = bno + done;
+    rc = rtems_rfs_block_map_find(fs, map, &bpos, &first);
+    if (rc > 0) {
+      break;
+    }
+
+    /*
+     * Collect the blocks that follow on the media in to one transfer.
+     */
+    for (run = 1; (done + run) < blocks; ++run) {
+      bpos.bno = bno + done + run;
+      rc = rtems_rfs_block_map_find(fs, map, &bpos, &block);
+      if ((rc > 0) || (block != (first + run))) {
+        break;
+      }
+    }
+
+    rc = rtems_rfs_buffer_transfer(fs, first, run,
+                                   buffer + (done * block_size), read);
+    if (rc > 0) {
+      break;
+    }
+
+    done += run;
   }
 
-  if (atime || mtime) {
-    time_t now = time(NULL);
-    if (read && atime) {
-      handle->shared->atime = now;
+  /*
+   * Do not keep blocks the write grew the map by but failed to fill.
+   */
+  if (!read && (rc > 0)) {
+    rtems_rfs_block_no end = bno + done;
+
+    if (end < count) {
+      end = count;
     }
-    if (!read && mtime) {
-      handle->shared->mtime = now;
+
+    if (rtems_rfs_block_map_count(map) > end) {
+      rtems_rfs_block_map_shrink(fs, map, rtems_rfs_block_map_count(map) - end);
+      if (end == count) {
+        rtems_rfs_block_map_set_size_offset(map, offset);
+      }
     }
   }
-  if (length) {
-    handle->shared->size.count =
-        rtems_rfs_block_map_count(rtems_rfs_file_map(handle));
-    handle->shared->size.offset =
-        rtems_rfs_block_map_size_offset(rtems_rfs_file_map(handle));
+
+  /*
+   * A buffer backend without direct transfers leaves the I/O to the buffered
+   * path.
+   */
+  if (rc == ENOTSUP) {
+    rc = 0;
+  }
+
+  if (done > 0) {
+    *size = done * block_size;
+    rtems_rfs_file_io_update(handle, *size, read);
+    rc = 0;
   }
 
   return rc;
@@ -143,7 +143,20 @@ static ssize_t rtems_rfs_rtems_file_read(rtems_libio_t* iop, void* buffer,
 
   if (pos < rtems_rfs_file_size(file)) {
     while (count) {
-      size_t size;
+      size_t size = count;
+
+      rc = rtems_rfs_file_io_direct(file, data, &size, true);
+      if (rc > 0) {
+        read = rtems_rfs_rtems_error("file-read: read: io-direct", rc);
+        break;
+      }
+
+      if (size > 0) {
+        data += size;
+        count -= size;
+        read += size;
+        continue;
+      }
 
       rc = rtems_rfs_file_io_start(file, &size, true);
       if (rc > 0) {
@@ -232,6 +245,23 @@ static ssize_t rtems_rfs_rtems_file_write(rtems_libio_t* iop,
   while (count) {
     size_t size = count;
 
+    rc = rtems_rfs_file_io_direct(file, (void*)data, &size, false);
+    if (rc) {
+      if (!write) {
+        write = rtems_rfs_rtems_error("file-write: write direct", rc);
+      }
+      break;
+    }
+
+    if (size > 0) {
+      data += size;
+      count -= size;
+      write += size;
+      continue;
+    }
+
+    size = count;
+
     rc = rtems_rfs_file_io_start(file, &size, false);
     if (rc) {
       /*
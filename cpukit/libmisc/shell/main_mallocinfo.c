@@ -36,6 +36,7 @@
 #endif
 
 #include <inttypes.h>
+#include <stdio.h>
 #include <string.h>
 
 #include <rtems.h>
@@ -45,6 +46,34 @@
 
 #include "internal.h"
 
+static void rtems_shell_print_malloc_caches( void )
+{
+  rtems_malloc_cache_information info;
+  uint32_t                       cpu_index;
+
+  cpu_index = 0;
+
+  while (
+    rtems_malloc_cache_get_information( cpu_index, &info ) == RTEMS_SUCCESSFUL
+  ) {
+    printf(
+      "Malloc cache of processor %" PRIu32 ":\n"
+      "Number of cache hits:                     %12" PRIu32 "\n"
+      "Number of cache misses:                   %12" PRIu32 "\n"
+      "Number of frees to the cache:             %12" PRIu32 "\n"
+      "Number of batches flushed to the heap:    %12" PRIu32 "\n"
+      "Number of cached objects:                 %12" PRIu32 "\n",
+      cpu_index,
+      info.hits,
+      info.misses,
+      info.frees,
+      info.flushes,
+      info.cached_objects
+    );
+    ++cpu_index;
+  }
+}
+
 static int rtems_shell_main_malloc_info(
   int   argc,
   char *argv[]
@@ -60,6 +89,7 @@ static int rtems_shell_main_malloc_info(
     rtems_shell_print_heap_info( "free", &info.Free );
     rtems_shell_print_heap_info( "used", &info.Used );
     rtems_shell_print_heap_stats( &info.Stats );
+    rtems_shell_print_malloc_caches();
   }
 
   return 0;
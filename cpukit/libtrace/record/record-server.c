@@ -31,10 +31,8 @@
 
 #include <rtems/recordserver.h>
 #include <rtems/record.h>
-#include <rtems/score/threadimpl.h>
 
 #include <sys/socket.h>
-#include <sys/uio.h>
 
 #include <stdlib.h>
 #include <string.h>
@@ -70,109 +68,12 @@ static void wakeup_timer( rtems_id timer, void *arg )
   (void) rtems_timer_reset( timer );
 }
 
-static void send_header( int fd )
+static void drain( int fd, rtems_record_item *items, size_t count )
 {
-  Record_Stream_header header;
-  size_t               size;
-
-  size = _Record_Stream_header_initialize( &header );
-  (void) write( fd, &header, size );
-}
-
-typedef struct {
-  int               fd;
-  size_t            index;
-  rtems_record_item items[ 128 ];
-} thread_names_context;
-
-static void thread_names_produce(
-  thread_names_context *ctx,
-  rtems_record_event    event,
-  rtems_record_data     data
-)
-{
-  size_t i;
-
-  i = ctx->index;
-  ctx->items[ i ].event = RTEMS_RECORD_TIME_EVENT( 0, event );
-  ctx->items[ i ].data = data;
-
-  if ( i == RTEMS_ARRAY_SIZE( ctx->items ) - 1 ) {
-    ctx->index = 0;
-    (void) write( ctx->fd, ctx->items, sizeof( ctx->items ) );
-  } else {
-    ctx->index = i + 1;
-  }
-}
-
-static bool thread_names_visitor( rtems_tcb *tcb, void *arg )
-{
-  thread_names_context *ctx;
-  char                  name[ 2 * THREAD_DEFAULT_MAXIMUM_NAME_SIZE ];
-  size_t                n;
-  size_t                i;
-  rtems_record_data     data;
-
-  ctx = arg;
-  thread_names_produce( ctx, RTEMS_RECORD_THREAD_ID, tcb->Object.id );
-  n = _Thread_Get_name( tcb, name, sizeof( name ) );
-  i = 0;
-
-  while ( i < n ) {
-    size_t j;
-
-    data = 0;
-
-    for ( j = 0; i < n && j < sizeof( data ); ++j ) {
-      rtems_record_data c;
-
-      c = (unsigned char) name[ i ];
-      data |= c << ( j * 8 );
-      ++i;
-    }
-
-    thread_names_produce( ctx, RTEMS_RECORD_THREAD_NAME, data );
-  }
-
-  return false;
-}
-
-static void send_thread_names( int fd )
-{
-  thread_names_context ctx;
-
-  ctx.fd = fd;
-  ctx.index = 0;
-  rtems_task_iterate( thread_names_visitor, &ctx );
-
-  if ( ctx.index > 0 ) {
-    (void) write( ctx.fd, ctx.items, ctx.index * sizeof( ctx.items[ 0 ] ) );
-  }
-}
-
-static void fetch_and_write( int fd, rtems_record_item *items, size_t count )
-{
-  rtems_record_fetch_control control;
-
-  rtems_record_fetch_initialize( &control, items, count );
-
   while ( true ) {
-    rtems_record_fetch_status status;
-
-    do {
-      ssize_t n;
-
-      status = rtems_record_fetch( &control );
-      n = write(
-        fd,
-        control.fetched_items,
-        control.fetched_count * sizeof( *control.fetched_items )
-      );
-
-      if ( n <= 0 ) {
-        return;
-      }
-    } while ( status == RTEMS_RECORD_FETCH_CONTINUE );
+    if ( rtems_record_sink_drain( fd, items, count ) < 0 ) {
+      return;
+    }
 
     wait( RTEMS_WAIT );
   }
@@ -233,9 +134,11 @@ void rtems_record_server( uint16_t port, rtems_interval period )
 
     wait( RTEMS_NO_WAIT );
     (void) rtems_timer_fire_after( timer, period, wakeup_timer, &self );
-    send_header( cd );
-    send_thread_names( cd );
-    fetch_and_write( cd, items, count );
+
+    if ( rtems_record_sink_write_header( cd ) == 0 ) {
+      drain( cd, items, count );
+    }
+
     (void) rtems_timer_cancel( timer );
     (void) close( cd );
   }
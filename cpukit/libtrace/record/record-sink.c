@@ -0,0 +1,230 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSRecord
+ *
+ * @brief This source file contains the implementation of the record file
+ *   sink.
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/recordserver.h>
+#include <rtems/record.h>
+#include <rtems/score/threadimpl.h>
+
+#include <errno.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+typedef struct {
+  int               fd;
+  int               error;
+  size_t            index;
+  rtems_record_item items[ 128 ];
+} thread_names_context;
+
+static int write_all( int fd, const void *buf, size_t size )
+{
+  const char *p;
+
+  p = buf;
+
+  while ( size > 0 ) {
+    ssize_t n;
+
+    n = write( fd, p, size );
+
+    if ( n <= 0 ) {
+      if ( n == 0 ) {
+        errno = EIO;
+      }
+
+      return -1;
+    }
+
+    p += n;
+    size -= (size_t) n;
+  }
+
+  return 0;
+}
+
+static void thread_names_produce(
+  thread_names_context *ctx,
+  rtems_record_event    event,
+  rtems_record_data     data
+)
+{
+  size_t i;
+
+  i = ctx->index;
+  ctx->items[ i ].event = RTEMS_RECORD_TIME_EVENT( 0, event );
+  ctx->items[ i ].data = data;
+
+  if ( i == RTEMS_ARRAY_SIZE( ctx->items ) - 1 ) {
+    ctx->index = 0;
+
+    if ( ctx->error == 0 ) {
+      ctx->error = write_all( ctx->fd, ctx->items, sizeof( ctx->items ) );
+    }
+  } else {
+    ctx->index = i + 1;
+  }
+}
+
+static bool thread_names_visitor( rtems_tcb *tcb, void *arg )
+{
+  thread_names_context *ctx;
+  char                  name[ 2 * THREAD_DEFAULT_MAXIMUM_NAME_SIZE ];
+  size_t                n;
+  size_t                i;
+  rtems_record_data     data;
+
+  ctx = arg;
+  thread_names_produce( ctx, RTEMS_RECORD_THREAD_ID, tcb->Object.id );
+  n = _Thread_Get_name( tcb, name, sizeof( name ) );
+  i = 0;
+
+  while ( i < n ) {
+    size_t j;
+
+    data = 0;
+
+    for ( j = 0; i < n && j < sizeof( data ); ++j ) {
+      rtems_record_data c;
+
+      c = (unsigned char) name[ i ];
+      data |= c << ( j * 8 );
+      ++i;
+    }
+
+    thread_names_produce( ctx, RTEMS_RECORD_THREAD_NAME, data );
+  }
+
+  return false;
+}
+
+int rtems_record_sink_write_header( int fd )
+{
+  Record_Stream_header header;
+  size_t               size;
+  thread_names_context ctx;
+
+  size = _Record_Stream_header_initialize( &header );
+
+  if ( write_all( fd, &header, size ) != 0 ) {
+    return -1;
+  }
+
+  ctx.fd = fd;
+  ctx.error = 0;
+  ctx.index = 0;
+  rtems_task_iterate( thread_names_visitor, &ctx );
+
+  if ( ctx.error != 0 ) {
+    return -1;
+  }
+
+  if ( ctx.index > 0 ) {
+    return write_all(
+      ctx.fd,
+      ctx.items,
+      ctx.index * sizeof( ctx.items[ 0 ] )
+    );
+  }
+
+  return 0;
+}
+
+ssize_t rtems_record_sink_drain(
+  int                fd,
+  rtems_record_item *items,
+  size_t             count
+)
+{
+  rtems_record_fetch_control control;
+  rtems_record_fetch_status  status;
+  ssize_t                    total;
+
+  /*
+   * The items are copied to the storage array by rtems_record_fetch() before
+   * they are written to the file.  Items overwritten by the producers during
+   * the copy are dropped and reported through an
+   * RTEMS_RECORD_PER_CPU_OVERFLOW event, so that only valid items are written.
+   * Writing the record buffer directly is not possible, since a write may
+   * block and the producers do not wait for the consumer.
+   */
+  rtems_record_fetch_initialize( &control, items, count );
+  total = 0;
+
+  do {
+    size_t size;
+
+    status = rtems_record_fetch( &control );
+
+    if ( status == RTEMS_RECORD_FETCH_INVALID_ITEM_COUNT ) {
+      errno = EINVAL;
+      return -1;
+    }
+
+    size = control.fetched_count * sizeof( *control.fetched_items );
+
+    if ( write_all( fd, control.fetched_items, size ) != 0 ) {
+      return -1;
+    }
+
+    total += (ssize_t) size;
+  } while ( status == RTEMS_RECORD_FETCH_CONTINUE );
+
+  return total;
+}
+
+void rtems_record_sink( int fd, rtems_interval period )
+{
+  size_t             count;
+  rtems_record_item *items;
+
+  count = rtems_record_get_item_count_for_fetch();
+  items = calloc( count, sizeof( *items ) );
+  if ( items == NULL ) {
+    return;
+  }
+
+  if ( rtems_record_sink_write_header( fd ) == 0 ) {
+    while ( rtems_record_sink_drain( fd, items, count ) >= 0 ) {
+      (void) rtems_task_wake_after( period );
+    }
+  }
+
+  free( items );
+}
@@ -100,9 +100,10 @@ void *mmap(
   /*
    * We can not normally provide restriction of write access. Reject any
    * attempt to map without write permission, since we are not able to
-   * prevent a write from succeeding.
+   * prevent a write from succeeding.  Shared mappings of regular files are
+   * checked below, since the file system may map read-only storage.
    */
-  if ( PROT_WRITE != ( prot & PROT_WRITE ) ) {
+  if ( PROT_WRITE != ( prot & PROT_WRITE ) && !map_shared ) {
     errno = ENOTSUP;
     return MAP_FAILED;
   }
@@ -182,6 +183,25 @@ void *mmap(
       return MAP_FAILED;
     }
 
+    /* Only regular files may provide shared mappings without write access. */
+    if ( PROT_WRITE != ( prot & PROT_WRITE ) && !S_ISREG( sb.st_mode ) ) {
+      errno = ENOTSUP;
+      return MAP_FAILED;
+    }
+
+    /*
+     * The file must be open for reading.  A writable shared mapping also
+     * requires that the file is open for writing.
+     */
+    if (
+      !rtems_libio_iop_is_readable( iop )
+      || ( map_shared && PROT_WRITE == ( prot & PROT_WRITE )
+        && !rtems_libio_iop_is_writeable( iop ) )
+    ) {
+      errno = EACCES;
+      return MAP_FAILED;
+    }
+
     /* Check to see if the mapping is valid for a regular file. */
     if (
       S_ISREG( sb.st_mode )
@@ -325,6 +345,17 @@ void *mmap(
       free( mapping );
       return MAP_FAILED;
     }
+
+    /*
+     * The file may be removed while the mapping exists.  Keep a reference to
+     * the file, so that the file system does not release the storage of the
+     * mapping before the unmap.
+     */
+    if ( S_ISREG( sb.st_mode ) ) {
+      rtems_filesystem_instance_lock( &iop->pathinfo );
+      rtems_filesystem_location_clone( &mapping->location, &iop->pathinfo );
+      rtems_filesystem_instance_unlock( &iop->pathinfo );
+    }
   }
 
   rtems_chain_append_unprotected( &mmap_mappings, &mapping->node );
@@ -0,0 +1,116 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup POSIXAPI
+ *
+ * @brief This source file contains the implementation of
+ *   mq_send_multiple_np().
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/posix/mqueueimpl.h>
+
+#include <fcntl.h>
+#include <sys/param.h>
+
+ssize_t mq_send_multiple_np(
+  mqd_t                  mqdes,
+  const char            *msg_ptr,
+  const size_t          *msg_lens,
+  size_t                 count,
+  unsigned int           msg_prio,
+  const struct timespec *abstime
+)
+{
+  POSIX_Message_queue_Control *the_mq;
+  Thread_queue_Context         queue_context;
+  Status_Control               status;
+  uint32_t                     sent;
+
+  if ( msg_prio > MQ_PRIO_MAX ) {
+    rtems_set_errno_and_return_minus_one( EINVAL );
+  }
+
+  if ( count == 0 ) {
+    rtems_set_errno_and_return_minus_one( EINVAL );
+  }
+
+  the_mq = _POSIX_Message_queue_Get( mqdes, &queue_context );
+
+  if ( the_mq == NULL ) {
+    rtems_set_errno_and_return_minus_one( EBADF );
+  }
+
+  if ( ( the_mq->oflag & O_ACCMODE ) == O_RDONLY ) {
+    _ISR_lock_ISR_enable( &queue_context.Lock_context.Lock_context );
+    rtems_set_errno_and_return_minus_one( EBADF );
+  }
+
+  if ( abstime != NULL ) {
+    _Thread_queue_Context_set_enqueue_timeout_realtime_timespec(
+      &queue_context,
+      abstime,
+      true
+    );
+  } else {
+    _Thread_queue_Context_set_enqueue_do_nothing_extra( &queue_context );
+  }
+
+  _CORE_message_queue_Acquire_critical(
+    &the_mq->Message_queue,
+    &queue_context
+  );
+
+  if ( the_mq->open_count == 0 ) {
+    _CORE_message_queue_Release( &the_mq->Message_queue, &queue_context );
+    rtems_set_errno_and_return_minus_one( EBADF );
+  }
+
+  sent = (uint32_t) MIN( count, UINT32_MAX );
+  status = _CORE_message_queue_Submit_multiple(
+    &the_mq->Message_queue,
+    _Thread_Executing,
+    msg_ptr,
+    msg_lens,
+    &sent,
+    _POSIX_Message_queue_Priority_to_core( msg_prio ),
+    ( the_mq->oflag & O_NONBLOCK ) == 0,
+    &queue_context
+  );
+
+  if ( status != STATUS_SUCCESSFUL ) {
+    rtems_set_errno_and_return_minus_one( _POSIX_Get_error( status ) );
+  }
+
+  return (ssize_t) sent;
+}
@@ -41,6 +41,7 @@
 int munmap( void *addr, size_t len )
 {
   mmap_mapping     *mapping;
+  mmap_mapping     *unmapped;
   rtems_chain_node *node;
 
   /*
@@ -62,6 +63,7 @@ int munmap( void *addr, size_t len )
     return -1;
   }
 
+  unmapped = NULL;
   mmap_mappings_lock_obtain();
 
   node = rtems_chain_first( &mmap_mappings );
@@ -87,12 +89,19 @@ int munmap( void *addr, size_t len )
           free( mapping->addr );
         }
       }
-      free( mapping );
+      unmapped = mapping;
       break;
     }
     node = rtems_chain_next( node );
   }
 
   mmap_mappings_lock_release();
+
+  if ( unmapped != NULL ) {
+    /* This may release the file of a shared mapping */
+    rtems_filesystem_location_free( &unmapped->location );
+    free( unmapped );
+  }
+
   return 0;
 }
@@ -0,0 +1,94 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSImplClassicMessage
+ *
+ * @brief This source file contains the implementation of
+ *   rtems_message_queue_receive_buffer().
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/rtems/messageimpl.h>
+#include <rtems/rtems/optionsimpl.h>
+#include <rtems/rtems/statusimpl.h>
+
+rtems_status_code rtems_message_queue_receive_buffer(
+  rtems_id       id,
+  void         **buffer,
+  size_t        *size,
+  rtems_option   option_set,
+  rtems_interval timeout
+)
+{
+  Message_queue_Control *the_message_queue;
+  Thread_queue_Context   queue_context;
+  Thread_Control        *executing;
+  Status_Control         status;
+
+  if ( buffer == NULL ) {
+    return RTEMS_INVALID_ADDRESS;
+  }
+
+  if ( size == NULL ) {
+    return RTEMS_INVALID_ADDRESS;
+  }
+
+  the_message_queue = _Message_queue_Get( id, &queue_context );
+
+  if ( the_message_queue == NULL ) {
+#if defined( RTEMS_MULTIPROCESSING )
+    if ( _Message_queue_MP_Is_remote( id ) ) {
+      return RTEMS_ILLEGAL_ON_REMOTE_OBJECT;
+    }
+#endif
+
+    return RTEMS_INVALID_ID;
+  }
+
+  _CORE_message_queue_Acquire_critical(
+    &the_message_queue->message_queue,
+    &queue_context
+  );
+
+  executing = _Thread_Executing;
+  _Thread_queue_Context_set_enqueue_timeout_ticks( &queue_context, timeout );
+  status = _CORE_message_queue_Seize_buffer(
+    &the_message_queue->message_queue,
+    executing,
+    buffer,
+    size,
+    !_Options_Is_no_wait( option_set ),
+    &queue_context
+  );
+  return _Status_Get( status );
+}
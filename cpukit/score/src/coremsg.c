@@ -94,6 +94,9 @@ Status_Control _CORE_message_queue_Initialize(
 
   _CORE_message_queue_Set_notify( the_message_queue, NULL );
   _Chain_Initialize_empty( &the_message_queue->Pending_messages );
+#if defined( RTEMS_SCORE_COREMSG_ENABLE_PRIORITY_INDEX )
+  the_message_queue->priority_level_map = 0;
+#endif
   _Thread_queue_Object_initialize( &the_message_queue->Wait_queue );
 
   if ( discipline == CORE_MESSAGE_QUEUE_DISCIPLINES_PRIORITY ) {
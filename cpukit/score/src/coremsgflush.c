@@ -96,6 +96,9 @@ uint32_t _CORE_message_queue_Flush(
     message_queue_first->previous = inactive_head;
 
     _Chain_Initialize_empty( &the_message_queue->Pending_messages );
+#if defined( RTEMS_SCORE_COREMSG_ENABLE_PRIORITY_INDEX )
+    the_message_queue->priority_level_map = 0;
+#endif
   }
 
   _CORE_message_queue_Release( the_message_queue, queue_context );
@@ -6,7 +6,8 @@
  * @ingroup RTEMSScoreMessageQueue
  *
  * @brief This source file contains the implementation of
- *   _CORE_message_queue_Insert_message().
+ *   _CORE_message_queue_Insert_message() and
+ *   _CORE_message_queue_Insert_pending_message().
  */
 
 /*
@@ -60,6 +61,58 @@ static bool _CORE_message_queue_Order(
 }
 #endif
 
+#if defined( RTEMS_SCORE_COREMSG_ENABLE_PRIORITY_INDEX )
+static void _CORE_message_queue_Insert_indexed(
+  CORE_message_queue_Control *the_message_queue,
+  CORE_message_queue_Buffer  *the_message,
+  int                         priority
+)
+{
+  unsigned int   level;
+  uint32_t       bit;
+  uint32_t       map;
+  Chain_Control *pending_messages;
+
+  level = (unsigned int) -priority;
+  bit = UINT32_C( 1 ) << level;
+  map = the_message_queue->priority_level_map & ~( bit - 1 );
+  pending_messages = &the_message_queue->Pending_messages;
+
+  if ( map != 0 ) {
+    /*
+     * Insert the message after the last message of its level or of the
+     * nearest level with a higher priority.  All messages after this message
+     * have a lower priority.
+     */
+    _Chain_Insert_unprotected(
+      &the_message_queue->priority_level_last[ __builtin_ctz( map ) ]->Node,
+      &the_message->Node
+    );
+  } else if (
+    _Chain_Is_empty( pending_messages )
+      || _CORE_message_queue_Get_message_priority(
+        (const CORE_message_queue_Buffer *) _Chain_First( pending_messages )
+      ) > priority
+  ) {
+    _Chain_Prepend_unprotected( pending_messages, &the_message->Node );
+  } else {
+    /*
+     * There are messages with a priority beyond the index range at the front
+     * of the pending messages.
+     */
+    _Chain_Insert_ordered_unprotected(
+      pending_messages,
+      &the_message->Node,
+      &priority,
+      _CORE_message_queue_Order
+    );
+  }
+
+  the_message_queue->priority_level_map |= bit;
+  the_message_queue->priority_level_last[ level ] = the_message;
+}
+#endif
+
 void _CORE_message_queue_Insert_message(
   CORE_message_queue_Control     *the_message_queue,
   CORE_message_queue_Buffer      *the_message,
@@ -68,8 +121,6 @@ void _CORE_message_queue_Insert_message(
   CORE_message_queue_Submit_types submit_type
 )
 {
-  Chain_Control *pending_messages;
-
   the_message->size = content_size;
 
   _CORE_message_queue_Copy_buffer(
@@ -78,6 +129,21 @@ void _CORE_message_queue_Insert_message(
     content_size
   );
 
+  _CORE_message_queue_Insert_pending_message(
+    the_message_queue,
+    the_message,
+    submit_type
+  );
+}
+
+void _CORE_message_queue_Insert_pending_message(
+  CORE_message_queue_Control     *the_message_queue,
+  CORE_message_queue_Buffer      *the_message,
+  CORE_message_queue_Submit_types submit_type
+)
+{
+  Chain_Control *pending_messages;
+
 #if defined( RTEMS_SCORE_COREMSG_ENABLE_MESSAGE_PRIORITY )
   the_message->priority = submit_type;
 #endif
@@ -92,6 +158,19 @@ void _CORE_message_queue_Insert_message(
     int priority;
 
     priority = _CORE_message_queue_Get_message_priority( the_message );
+#if defined( RTEMS_SCORE_COREMSG_ENABLE_PRIORITY_INDEX )
+    if (
+      priority <= 0
+        && priority > -CORE_MESSAGE_QUEUE_PRIORITY_LEVELS
+    ) {
+      _CORE_message_queue_Insert_indexed(
+        the_message_queue,
+        the_message,
+        priority
+      );
+      return;
+    }
+#endif
     _Chain_Insert_ordered_unprotected(
       pending_messages,
       &the_message->Node,
@@ -0,0 +1,231 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreMessageQueue
+ *
+ * @brief This source file contains the implementation of
+ *   _CORE_message_queue_Submit_buffer(), _CORE_message_queue_Seize_buffer(),
+ *   and _CORE_message_queue_Get_loaned_buffer().
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/coremsgimpl.h>
+#include <rtems/score/threadimpl.h>
+#include <rtems/score/statesimpl.h>
+
+static CORE_message_queue_Buffer *_CORE_message_queue_Buffer_of(
+  void *buffer
+)
+{
+  return RTEMS_CONTAINER_OF( buffer, CORE_message_queue_Buffer, buffer );
+}
+
+Status_Control _CORE_message_queue_Submit_buffer(
+  CORE_message_queue_Control     *the_message_queue,
+  void                           *buffer,
+  size_t                          size,
+  CORE_message_queue_Submit_types submit_type,
+  Thread_queue_Context           *queue_context
+)
+{
+  CORE_message_queue_Buffer *the_message;
+  Thread_queue_Heads        *heads;
+
+  if ( size > the_message_queue->maximum_message_size ) {
+    _CORE_message_queue_Release( the_message_queue, queue_context );
+    return STATUS_MESSAGE_INVALID_SIZE;
+  }
+
+  the_message = _CORE_message_queue_Buffer_of( buffer );
+  heads = the_message_queue->Wait_queue.Queue.heads;
+
+  /*
+   *  If there are pending messages, then there can't be threads waiting to
+   *  receive a message.  Senders never wait on message queues used with
+   *  loaned buffers.
+   */
+  if ( the_message_queue->number_of_pending_messages == 0 && heads != NULL ) {
+    Thread_Control *the_thread;
+
+    the_thread = ( *the_message_queue->operations->surrender )(
+      &the_message_queue->Wait_queue.Queue,
+      heads,
+      NULL,
+      queue_context
+    );
+
+    *(size_t *) the_thread->Wait.return_argument = size;
+    the_thread->Wait.count = (uint32_t) submit_type;
+
+    if ( the_thread->Wait.option == CORE_MESSAGE_QUEUE_RECEIVE_BUFFER ) {
+      /* Hand over the loan */
+      the_thread->Wait.return_argument_second.mutable_object = buffer;
+    } else {
+      _CORE_message_queue_Copy_buffer(
+        buffer,
+        the_thread->Wait.return_argument_second.mutable_object,
+        size
+      );
+      _CORE_message_queue_Release_buffer( the_message_queue, the_message );
+    }
+
+    _Thread_queue_Resume(
+      &the_message_queue->Wait_queue.Queue,
+      the_thread,
+      queue_context
+    );
+    return STATUS_SUCCESSFUL;
+  }
+
+  the_message->size = size;
+  _CORE_message_queue_Insert_pending_message(
+    the_message_queue,
+    the_message,
+    submit_type
+  );
+
+#if defined( RTEMS_SCORE_COREMSG_ENABLE_NOTIFICATION )
+  if (
+    the_message_queue->number_of_pending_messages == 1 &&
+    the_message_queue->notify_handler != NULL
+  ) {
+    ( *the_message_queue->notify_handler )( the_message_queue, queue_context );
+  } else {
+    _CORE_message_queue_Release( the_message_queue, queue_context );
+  }
+#else
+  _CORE_message_queue_Release( the_message_queue, queue_context );
+#endif
+
+  return STATUS_SUCCESSFUL;
+}
+
+Status_Control _CORE_message_queue_Seize_buffer(
+  CORE_message_queue_Control *the_message_queue,
+  Thread_Control             *executing,
+  void                      **buffer_p,
+  size_t                     *size_p,
+  bool                        wait,
+  Thread_queue_Context       *queue_context
+)
+{
+  CORE_message_queue_Buffer *the_message;
+  Status_Control             status;
+
+  the_message = _CORE_message_queue_Get_pending_message( the_message_queue );
+  if ( the_message != NULL ) {
+    the_message_queue->number_of_pending_messages -= 1;
+
+    *size_p = the_message->size;
+    executing->Wait.count = _CORE_message_queue_Get_message_priority(
+      the_message
+    );
+
+    /* The off chain state marks the loaned buffers */
+    _Chain_Set_off_chain( &the_message->Node );
+    *buffer_p = the_message->buffer;
+
+    _CORE_message_queue_Release( the_message_queue, queue_context );
+    return STATUS_SUCCESSFUL;
+  }
+
+  if ( !wait ) {
+    _CORE_message_queue_Release( the_message_queue, queue_context );
+    return STATUS_UNSATISFIED;
+  }
+
+  /*
+   *  The sender provides the buffer, see _CORE_message_queue_Submit_buffer()
+   *  and _CORE_message_queue_Dequeue_receiver().
+   */
+  executing->Wait.return_argument_second.mutable_object = NULL;
+  executing->Wait.return_argument = size_p;
+  executing->Wait.option = CORE_MESSAGE_QUEUE_RECEIVE_BUFFER;
+  /* Wait.count will be filled in with the message priority */
+
+  _Thread_queue_Context_set_thread_state(
+    queue_context,
+    STATES_WAITING_FOR_MESSAGE
+  );
+  _Thread_queue_Enqueue(
+    &the_message_queue->Wait_queue.Queue,
+    the_message_queue->operations,
+    executing,
+    queue_context
+  );
+
+  status = _Thread_Wait_get_status( executing );
+
+  if ( status == STATUS_SUCCESSFUL ) {
+    *buffer_p = executing->Wait.return_argument_second.mutable_object;
+  }
+
+  return status;
+}
+
+CORE_message_queue_Buffer *_CORE_message_queue_Get_loaned_buffer(
+  const CORE_message_queue_Control *the_message_queue,
+  const void                       *buffer
+)
+{
+  size_t                     buffer_size;
+  uintptr_t                  offset;
+  CORE_message_queue_Buffer *the_message;
+
+  buffer_size = RTEMS_ALIGN_UP(
+    the_message_queue->maximum_message_size,
+    sizeof( uintptr_t )
+  );
+  buffer_size += sizeof( CORE_message_queue_Buffer );
+
+  offset = (uintptr_t) buffer -
+           (uintptr_t) the_message_queue->message_buffers -
+           sizeof( CORE_message_queue_Buffer );
+
+  if (
+    offset / buffer_size >= the_message_queue->maximum_pending_messages ||
+    offset % buffer_size != 0
+  ) {
+    return NULL;
+  }
+
+  the_message = (CORE_message_queue_Buffer *) (
+    (uintptr_t) the_message_queue->message_buffers + offset
+  );
+
+  if ( !_Chain_Is_node_off_chain( &the_message->Node ) ) {
+    return NULL;
+  }
+
+  return the_message;
+}
@@ -0,0 +1,277 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreMessageQueue
+ *
+ * @brief This source file contains the implementation of
+ *   _CORE_message_queue_Submit_multiple() and
+ *   _CORE_message_queue_Seize_multiple().
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/coremsgimpl.h>
+#include <rtems/score/threadimpl.h>
+
+Status_Control _CORE_message_queue_Submit_multiple(
+  CORE_message_queue_Control     *the_message_queue,
+  Thread_Control                 *executing,
+  const void                     *buffer,
+  const size_t                   *sizes,
+  uint32_t                       *count_p,
+  CORE_message_queue_Submit_types submit_type,
+  bool                            wait,
+  Thread_queue_Context           *queue_context
+)
+{
+  const char *source;
+  uint32_t    count;
+  uint32_t    sent;
+#if defined( RTEMS_SCORE_COREMSG_ENABLE_NOTIFICATION )
+  bool        was_empty;
+#endif
+
+  source = buffer;
+  count = *count_p;
+  sent = 0;
+#if defined( RTEMS_SCORE_COREMSG_ENABLE_NOTIFICATION )
+  was_empty = ( the_message_queue->number_of_pending_messages == 0 );
+#endif
+
+  while ( sent < count ) {
+    CORE_message_queue_Buffer *the_message;
+    size_t                     size;
+
+    size = sizes[ sent ];
+
+    /*
+     *  A message which is too large ends the batch.  It is an error only if
+     *  no message was sent.
+     */
+    if ( size > the_message_queue->maximum_message_size ) {
+      if ( sent == 0 ) {
+        _CORE_message_queue_Release( the_message_queue, queue_context );
+        *count_p = 0;
+        return STATUS_MESSAGE_INVALID_SIZE;
+      }
+
+      break;
+    }
+
+    /*
+     *  Each waiting receiver gets one message, like in
+     *  _CORE_message_queue_Broadcast().  The lock is released while the
+     *  receiver is unblocked.
+     */
+    if (
+      _CORE_message_queue_Dequeue_receiver(
+        the_message_queue,
+        source,
+        size,
+        submit_type,
+        queue_context
+      ) != NULL
+    ) {
+      source += size;
+      ++sent;
+      _CORE_message_queue_Acquire( the_message_queue, queue_context );
+      continue;
+    }
+
+    the_message = _CORE_message_queue_Allocate_message_buffer(
+      the_message_queue
+    );
+    if ( the_message == NULL ) {
+      break;
+    }
+
+    _CORE_message_queue_Insert_message(
+      the_message_queue,
+      the_message,
+      source,
+      size,
+      submit_type
+    );
+    source += size;
+    ++sent;
+  }
+
+  if ( sent == 0 ) {
+    /*
+     *  Let _CORE_message_queue_Submit() report the error or block the
+     *  calling thread for the first message.
+     */
+    Status_Control status;
+
+    status = _CORE_message_queue_Submit(
+      the_message_queue,
+      executing,
+      source,
+      sizes[ 0 ],
+      submit_type,
+      wait,
+      queue_context
+    );
+
+    *count_p = ( status == STATUS_SUCCESSFUL ) ? 1 : 0;
+    return status;
+  }
+
+  *count_p = sent;
+
+#if defined( RTEMS_SCORE_COREMSG_ENABLE_NOTIFICATION )
+  if (
+    was_empty &&
+    the_message_queue->number_of_pending_messages != 0 &&
+    the_message_queue->notify_handler != NULL
+  ) {
+    ( *the_message_queue->notify_handler )( the_message_queue, queue_context );
+  } else {
+    _CORE_message_queue_Release( the_message_queue, queue_context );
+  }
+#else
+  _CORE_message_queue_Release( the_message_queue, queue_context );
+#endif
+
+  return STATUS_SUCCESSFUL;
+}
+
+Status_Control _CORE_message_queue_Seize_multiple(
+  CORE_message_queue_Control *the_message_queue,
+  Thread_Control             *executing,
+  void                       *buffer,
+  size_t                     *sizes,
+  int                        *priorities,
+  uint32_t                   *count_p,
+  bool                        wait,
+  Thread_queue_Context       *queue_context
+)
+{
+  char          *destination;
+  uint32_t       count;
+  uint32_t       received;
+  Status_Control status;
+
+  destination = buffer;
+  count = *count_p;
+  received = 0;
+
+  while ( received < count ) {
+    CORE_message_queue_Buffer *the_message;
+    size_t                     size;
+
+    the_message = _CORE_message_queue_Get_pending_message( the_message_queue );
+    if ( the_message == NULL ) {
+      break;
+    }
+
+    the_message_queue->number_of_pending_messages -= 1;
+
+    size = the_message->size;
+    sizes[ received ] = size;
+
+    if ( priorities != NULL ) {
+      priorities[ received ] = _CORE_message_queue_Get_message_priority(
+        the_message
+      );
+    }
+
+    _CORE_message_queue_Copy_buffer( the_message->buffer, destination, size );
+    destination += size;
+    ++received;
+
+#if defined( RTEMS_SCORE_COREMSG_ENABLE_BLOCKING_SEND )
+    {
+      Thread_queue_Heads *heads;
+
+      /*
+       *  There could be a thread waiting to send a message, see
+       *  _CORE_message_queue_Seize().
+       */
+      heads = the_message_queue->Wait_queue.Queue.heads;
+      if ( heads != NULL ) {
+        Thread_Control *the_thread;
+
+        the_thread = ( *the_message_queue->operations->surrender )(
+          &the_message_queue->Wait_queue.Queue,
+          heads,
+          NULL,
+          queue_context
+        );
+        _CORE_message_queue_Insert_message(
+          the_message_queue,
+          the_message,
+          the_thread->Wait.return_argument_second.immutable_object,
+          (size_t) the_thread->Wait.option,
+          (CORE_message_queue_Submit_types) the_thread->Wait.count
+        );
+        _Thread_queue_Resume(
+          &the_message_queue->Wait_queue.Queue,
+          the_thread,
+          queue_context
+        );
+        _CORE_message_queue_Acquire( the_message_queue, queue_context );
+        continue;
+      }
+    }
+#endif
+
+    _CORE_message_queue_Free_message_buffer( the_message_queue, the_message );
+  }
+
+  if ( received > 0 ) {
+    _CORE_message_queue_Release( the_message_queue, queue_context );
+    *count_p = received;
+    return STATUS_SUCCESSFUL;
+  }
+
+  status = _CORE_message_queue_Seize(
+    the_message_queue,
+    executing,
+    buffer,
+    &sizes[ 0 ],
+    wait,
+    queue_context
+  );
+
+  if ( status == STATUS_SUCCESSFUL ) {
+    if ( priorities != NULL ) {
+      priorities[ 0 ] = (int) executing->Wait.count;
+    }
+
+    *count_p = 1;
+  } else {
+    *count_p = 0;
+  }
+
+  return status;
+}
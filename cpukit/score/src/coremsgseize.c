@@ -132,6 +132,7 @@ Status_Control _CORE_message_queue_Seize(
 
   executing->Wait.return_argument_second.mutable_object = buffer;
   executing->Wait.return_argument = size_p;
+  executing->Wait.option = CORE_MESSAGE_QUEUE_RECEIVE_COPY;
   /* Wait.count will be filled in with the message priority */
 
   _Thread_queue_Context_set_thread_state(
@@ -0,0 +1,240 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreHeap
+ *
+ * @brief This source file contains the implementation of
+ *   _Heap_Set_segregated_fit(), _Heap_Segregated_fit_insert(),
+ *   _Heap_Segregated_fit_remove(), and _Heap_Segregated_fit_search().
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/heapfirstfitimpl.h>
+
+#include <string.h>
+
+static uintptr_t _Heap_Segregated_fit_class_begin( uint32_t fl, uint32_t sl )
+{
+  if ( fl == 0 ) {
+    return sl;
+  }
+
+  return (uintptr_t) ( HEAP_SEGREGATED_FIT_SECOND_LEVEL_COUNT + sl )
+    << ( fl - 1 );
+}
+
+/*
+ * Searches for the smallest non-empty size class greater than or equal to the
+ * size class ( *fl, *sl ).
+ */
+static bool _Heap_Segregated_fit_find(
+  const Heap_Segregated_fit *segregated_fit,
+  uint32_t                  *fl,
+  uint32_t                  *sl
+)
+{
+  uint32_t map;
+
+  map = segregated_fit->second_level_map[ *fl ] & ( ~UINT32_C( 0 ) << *sl );
+
+  if ( map == 0 ) {
+    if ( *fl + 1 >= HEAP_SEGREGATED_FIT_FIRST_LEVEL_COUNT ) {
+      return false;
+    }
+
+    map = segregated_fit->first_level_map & ( ~UINT32_C( 0 ) << ( *fl + 1 ) );
+
+    if ( map == 0 ) {
+      return false;
+    }
+
+    *fl = (uint32_t) __builtin_ctz( map );
+    map = segregated_fit->second_level_map[ *fl ];
+  }
+
+  *sl = (uint32_t) __builtin_ctz( map );
+  return true;
+}
+
+void _Heap_Segregated_fit_insert( Heap_Control *heap, Heap_Block *block )
+{
+  Heap_Segregated_fit *segregated_fit;
+  Heap_Block          *first;
+  uint32_t             fl;
+  uint32_t             sl;
+
+  segregated_fit = heap->segregated_fit;
+  _Heap_Segregated_fit_mapping( _Heap_Block_size( block ), &fl, &sl );
+  first = segregated_fit->first[ fl ][ sl ];
+
+  if ( first == NULL ) {
+    uint32_t next_fl;
+    uint32_t next_sl;
+
+    /*
+     * The size class is empty, so the block is inserted before the first
+     * block of the next non-empty size class to keep the free list sorted.
+     */
+    next_fl = fl;
+    next_sl = sl;
+
+    if ( _Heap_Segregated_fit_find( segregated_fit, &next_fl, &next_sl ) ) {
+      first = segregated_fit->first[ next_fl ][ next_sl ];
+    } else {
+      first = _Heap_Free_list_tail( heap );
+    }
+
+    segregated_fit->first_level_map |= UINT32_C( 1 ) << fl;
+    segregated_fit->second_level_map[ fl ] |= UINT32_C( 1 ) << sl;
+  }
+
+  _Heap_Free_list_insert_before( first, block );
+  segregated_fit->first[ fl ][ sl ] = block;
+}
+
+void _Heap_Segregated_fit_remove( Heap_Control *heap, Heap_Block *block )
+{
+  Heap_Segregated_fit *segregated_fit;
+  uint32_t             fl;
+  uint32_t             sl;
+
+  segregated_fit = heap->segregated_fit;
+  _Heap_Segregated_fit_mapping( _Heap_Block_size( block ), &fl, &sl );
+
+  if ( segregated_fit->first[ fl ][ sl ] == block ) {
+    Heap_Block *next;
+    uint32_t    next_fl;
+    uint32_t    next_sl;
+
+    next = block->next;
+
+    if ( next != _Heap_Free_list_tail( heap ) ) {
+      _Heap_Segregated_fit_mapping(
+        _Heap_Block_size( next ),
+        &next_fl,
+        &next_sl
+      );
+    } else {
+      next_fl = HEAP_SEGREGATED_FIT_FIRST_LEVEL_COUNT;
+      next_sl = 0;
+    }
+
+    if ( next_fl == fl && next_sl == sl ) {
+      segregated_fit->first[ fl ][ sl ] = next;
+    } else {
+      segregated_fit->first[ fl ][ sl ] = NULL;
+      segregated_fit->second_level_map[ fl ] &= ~( UINT32_C( 1 ) << sl );
+
+      if ( segregated_fit->second_level_map[ fl ] == 0 ) {
+        segregated_fit->first_level_map &= ~( UINT32_C( 1 ) << fl );
+      }
+    }
+  }
+
+  _Heap_Free_list_remove( block );
+}
+
+Heap_Block *_Heap_Segregated_fit_search( Heap_Control *heap, uintptr_t size )
+{
+  Heap_Segregated_fit *segregated_fit;
+  uint32_t             fl;
+  uint32_t             sl;
+  uint32_t             good_fl;
+  uint32_t             good_sl;
+
+  segregated_fit = heap->segregated_fit;
+  _Heap_Segregated_fit_mapping( size, &fl, &sl );
+  good_fl = fl;
+  good_sl = sl;
+
+  /*
+   * Round up to the next size class, if the size class may contain blocks
+   * smaller than the requested size.  All blocks of the resulting size class
+   * satisfy the request.
+   */
+  if ( _Heap_Segregated_fit_class_begin( fl, sl ) < size ) {
+    if ( good_sl + 1 < HEAP_SEGREGATED_FIT_SECOND_LEVEL_COUNT ) {
+      ++good_sl;
+    } else {
+      ++good_fl;
+      good_sl = 0;
+    }
+  }
+
+  if (
+    good_fl < HEAP_SEGREGATED_FIT_FIRST_LEVEL_COUNT &&
+    _Heap_Segregated_fit_find( segregated_fit, &good_fl, &good_sl )
+  ) {
+    return segregated_fit->first[ good_fl ][ good_sl ];
+  }
+
+  /*
+   * There is no size class with blocks which satisfy the request for sure.
+   * Some blocks of the size class containing the requested size may be large
+   * enough.
+   */
+  if ( _Heap_Segregated_fit_find( segregated_fit, &fl, &sl ) ) {
+    return segregated_fit->first[ fl ][ sl ];
+  }
+
+  return _Heap_Free_list_tail( heap );
+}
+
+void _Heap_Set_segregated_fit(
+  Heap_Control        *heap,
+  Heap_Segregated_fit *segregated_fit
+)
+{
+  Heap_Block *const free_list_tail = _Heap_Free_list_tail( heap );
+  Heap_Block       *block;
+
+  heap->segregated_fit = segregated_fit;
+
+  if ( segregated_fit == NULL ) {
+    /* The free list is a valid first fit free list */
+    return;
+  }
+
+  memset( segregated_fit, 0, sizeof( *segregated_fit ) );
+
+  block = _Heap_Free_list_first( heap );
+  _Heap_Free_list_head( heap )->next = free_list_tail;
+  _Heap_Free_list_tail( heap )->prev = _Heap_Free_list_head( heap );
+
+  while ( block != free_list_tail ) {
+    Heap_Block *next = block->next;
+
+    _Heap_Segregated_fit_insert( heap, block );
+    block = next;
+  }
+}
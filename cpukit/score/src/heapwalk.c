@@ -139,6 +139,107 @@ static bool _Heap_Walk_check_free_list(
   return true;
 }
 
+static bool _Heap_Walk_check_segregated_fit(
+  int               source,
+  Heap_Walk_printer printer,
+  Heap_Control     *heap
+)
+{
+  const Heap_Segregated_fit *const segregated_fit = heap->segregated_fit;
+  const Heap_Block *const free_list_tail = _Heap_Free_list_tail( heap );
+  const Heap_Block       *free_block = _Heap_Free_list_first( heap );
+  uint32_t                class_count = 0;
+  uint32_t                prev_class = 0;
+  uint32_t                fl;
+  uint32_t                sl;
+
+  while ( free_block != free_list_tail ) {
+    uint32_t class;
+
+    _Heap_Segregated_fit_mapping( _Heap_Block_size( free_block ), &fl, &sl );
+    class = fl * HEAP_SEGREGATED_FIT_SECOND_LEVEL_COUNT + sl;
+
+    if ( class_count == 0 || class != prev_class ) {
+      if ( class_count != 0 && class < prev_class ) {
+        ( *printer )(
+          source,
+          true,
+          "free block 0x%08x: free list not sorted by size class\n",
+          free_block
+        );
+
+        return false;
+      }
+
+      if ( segregated_fit->first[ fl ][ sl ] != free_block ) {
+        ( *printer )(
+          source,
+          true,
+          "free block 0x%08x: not the first block of size class %u\n",
+          free_block,
+          class
+        );
+
+        return false;
+      }
+
+      ++class_count;
+      prev_class = class;
+    }
+
+    free_block = free_block->next;
+  }
+
+  for ( fl = 0; fl < HEAP_SEGREGATED_FIT_FIRST_LEVEL_COUNT; ++fl ) {
+    uint32_t const second_level_map = segregated_fit->second_level_map[ fl ];
+    bool const     fl_bit = ( segregated_fit->first_level_map >> fl ) & 1;
+
+    if ( fl_bit != ( second_level_map != 0 ) ) {
+      ( *printer )(
+        source,
+        true,
+        "segregated fit: invalid first level map bit %u\n",
+        fl
+      );
+
+      return false;
+    }
+
+    for ( sl = 0; sl < HEAP_SEGREGATED_FIT_SECOND_LEVEL_COUNT; ++sl ) {
+      bool const sl_bit = ( second_level_map >> sl ) & 1;
+      bool const not_empty = segregated_fit->first[ fl ][ sl ] != NULL;
+
+      if ( sl_bit != not_empty ) {
+        ( *printer )(
+          source,
+          true,
+          "segregated fit: invalid second level map bit %u of %u\n",
+          sl,
+          fl
+        );
+
+        return false;
+      }
+
+      if ( not_empty ) {
+        --class_count;
+      }
+    }
+  }
+
+  if ( class_count != 0 ) {
+    ( *printer )(
+      source,
+      true,
+      "segregated fit: index references blocks not in the free list\n"
+    );
+
+    return false;
+  }
+
+  return true;
+}
+
 static bool _Heap_Walk_is_in_free_list( Heap_Control *heap, Heap_Block *block )
 {
   const Heap_Block *const free_list_tail = _Heap_Free_list_tail( heap );
@@ -249,7 +350,15 @@ static bool _Heap_Walk_check_control(
     return false;
   }
 
-  return _Heap_Walk_check_free_list( source, printer, heap );
+  if ( !_Heap_Walk_check_free_list( source, printer, heap ) ) {
+    return false;
+  }
+
+  if ( _Heap_Is_segregated_fit( heap ) ) {
+    return _Heap_Walk_check_segregated_fit( source, printer, heap );
+  }
+
+  return true;
 }
 
 static bool _Heap_Walk_check_free_block(
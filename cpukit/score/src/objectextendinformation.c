@@ -124,7 +124,6 @@ Objects_Maximum _Objects_Extend_information( Objects_Information *information )
    *  Do we need to grow the tables?
    */
   if ( do_extend ) {
-    ISR_lock_Context  lock_context;
     Objects_Control **object_blocks;
     Objects_Control **local_table;
     Objects_Maximum  *inactive_per_block;
@@ -168,6 +167,15 @@ Objects_Maximum _Objects_Extend_information( Objects_Information *information )
       return 0;
     }
 
+    if (
+      information->name_index != NULL &&
+      !_Objects_Name_index_extend( information, (Objects_Maximum) new_maximum )
+    ) {
+      _Workspace_Free( object_blocks );
+      _Workspace_Free( new_object_block );
+      return 0;
+    }
+
     /*
      *  Break the block into the various sections.
      */
@@ -227,19 +235,23 @@ Objects_Maximum _Objects_Extend_information( Objects_Information *information )
       local_table[ index ] = NULL;
     }
 
-    /* FIXME: https://gitlab.rtems.org/rtems/rtos/rtems/-/issues/2280 */
-    _ISR_lock_ISR_disable( &lock_context );
-
     old_tables = information->object_blocks;
 
     information->object_blocks = object_blocks;
     information->inactive_per_block = inactive_per_block;
     information->local_table = local_table;
+
+    /*
+     * The readers of _Objects_Get() use the maximum identifier to check the
+     * bounds of the local table without a lock.  Make sure that all readers
+     * use the new local table before the maximum identifier is increased and
+     * that no reader uses the old local table before it is freed.
+     */
+    _Objects_Wait_for_readers();
+
     information->maximum_id = api_class_and_node |
                               ( new_maximum << OBJECTS_INDEX_START_BIT );
 
-    _ISR_lock_ISR_enable( &lock_context );
-
     _Workspace_Free( old_tables );
 
     block_count++;
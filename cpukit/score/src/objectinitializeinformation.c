@@ -73,6 +73,10 @@ void _Objects_Initialize_information( Objects_Information *information )
   _Objects_Information_table[ _Objects_Get_API( maximum_id ) ]
                             [ _Objects_Get_class( maximum_id ) ] = information;
 
+  if ( information->name_index != NULL ) {
+    _ISR_lock_Initialize( &information->name_index->Lock, "Object Name Index" );
+  }
+
   head = _Chain_Head( &information->Inactive );
   tail = _Chain_Tail( &information->Inactive );
   current = head;
@@ -0,0 +1,406 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreObject
+ *
+ * @brief This source file contains the implementation of
+ *   _Objects_Name_index_insert(), _Objects_Name_index_remove(),
+ *   _Objects_Name_index_find_u32(), _Objects_Name_index_find_string(), and
+ *   _Objects_Name_index_extend().
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/objectimpl.h>
+#include <rtems/score/wkspace.h>
+
+#include <string.h>
+
+static size_t _Objects_Name_index_hash_u32( uint32_t name )
+{
+  name ^= name >> 16;
+  name *= 0x45d9f3bU;
+  name ^= name >> 16;
+
+  return name;
+}
+
+static size_t _Objects_Name_index_hash_string(
+  const char *name,
+  size_t      name_length
+)
+{
+  uint32_t hash;
+  size_t   i;
+
+  hash = 2166136261U;
+
+  for ( i = 0; i < name_length; ++i ) {
+    hash ^= (unsigned char) name[ i ];
+    hash *= 16777619U;
+  }
+
+  return hash;
+}
+
+static bool _Objects_Name_index_has_name(
+  const Objects_Information *information,
+  const Objects_Control     *the_object
+)
+{
+  if ( _Objects_Has_string_name( information ) ) {
+    return the_object->name.name_p != NULL;
+  }
+
+  return the_object->name.name_u32 != 0;
+}
+
+static size_t _Objects_Name_index_hash(
+  const Objects_Information *information,
+  const Objects_Control     *the_object
+)
+{
+  if ( _Objects_Has_string_name( information ) ) {
+    const char *name;
+
+    name = the_object->name.name_p;
+
+    return _Objects_Name_index_hash_string(
+      name,
+      strnlen( name, information->name_length )
+    );
+  }
+
+  return _Objects_Name_index_hash_u32( the_object->name.name_u32 );
+}
+
+static size_t _Objects_Name_index_next( size_t i, size_t size )
+{
+  ++i;
+
+  if ( i == size ) {
+    i = 0;
+  }
+
+  return i;
+}
+
+static void _Objects_Name_index_place(
+  Objects_Control **table,
+  size_t            size,
+  size_t            hash,
+  Objects_Control  *the_object
+)
+{
+  size_t i;
+
+  i = hash % size;
+
+  while ( table[ i ] != NULL ) {
+    i = _Objects_Name_index_next( i, size );
+  }
+
+  table[ i ] = the_object;
+}
+
+void _Objects_Name_index_insert(
+  const Objects_Information *information,
+  Objects_Control           *the_object
+)
+{
+  Objects_Name_index *index;
+  size_t              hash;
+  Objects_Maximum     local_index;
+  ISR_lock_Context    lock_context;
+
+  if ( !_Objects_Name_index_has_name( information, the_object ) ) {
+    return;
+  }
+
+  index = information->name_index;
+  hash = _Objects_Name_index_hash( information, the_object );
+  local_index = _Objects_Get_index( the_object->id ) - OBJECTS_INDEX_MINIMUM;
+
+  _ISR_lock_ISR_disable_and_acquire( &index->Lock, &lock_context );
+
+  /*
+   * A thread may close itself concurrently, see _Objects_Close().  Since the
+   * object is invalidated before it is removed from the name index, check
+   * that the object is still active.
+   */
+  if ( information->local_table[ local_index ] == the_object ) {
+    _Objects_Name_index_place( index->table, index->size, hash, the_object );
+    ++index->generation;
+  }
+
+  _ISR_lock_Release_and_ISR_enable( &index->Lock, &lock_context );
+}
+
+void _Objects_Name_index_remove(
+  const Objects_Information *information,
+  Objects_Control           *the_object
+)
+{
+  Objects_Name_index *index;
+  Objects_Control   **table;
+  size_t              size;
+  size_t              i;
+  size_t              j;
+  ISR_lock_Context    lock_context;
+
+  if ( !_Objects_Name_index_has_name( information, the_object ) ) {
+    return;
+  }
+
+  index = information->name_index;
+
+  _ISR_lock_ISR_disable_and_acquire( &index->Lock, &lock_context );
+
+  table = index->table;
+  size = index->size;
+  i = _Objects_Name_index_hash( information, the_object ) % size;
+
+  while ( table[ i ] != the_object ) {
+    if ( table[ i ] == NULL ) {
+      _ISR_lock_Release_and_ISR_enable( &index->Lock, &lock_context );
+      return;
+    }
+
+    i = _Objects_Name_index_next( i, size );
+  }
+
+  /*
+   * Move the following objects of the cluster which would be no longer
+   * reachable from their home entry into the emptied entry.
+   */
+  j = i;
+
+  while ( true ) {
+    Objects_Control *other;
+    size_t           home;
+
+    j = _Objects_Name_index_next( j, size );
+    other = table[ j ];
+
+    if ( other == NULL ) {
+      break;
+    }
+
+    home = _Objects_Name_index_hash( information, other ) % size;
+
+    if ( i <= j ? ( i < home && home <= j ) : ( i < home || home <= j ) ) {
+      continue;
+    }
+
+    table[ i ] = other;
+    i = j;
+  }
+
+  table[ i ] = NULL;
+  ++index->generation;
+
+  _ISR_lock_Release_and_ISR_enable( &index->Lock, &lock_context );
+}
+
+bool _Objects_Name_index_find_u32(
+  const Objects_Information *information,
+  uint32_t                   name,
+  Objects_Id                *id
+)
+{
+  Objects_Name_index    *index;
+  const Objects_Control *the_object;
+  Objects_Id             found;
+  size_t                 hash;
+  size_t                 i;
+  ISR_lock_Context       lock_context;
+
+  _Assert( !_Objects_Has_string_name( information ) );
+
+  index = information->name_index;
+  hash = _Objects_Name_index_hash_u32( name );
+  found = 0;
+
+  _ISR_lock_ISR_disable_and_acquire( &index->Lock, &lock_context );
+
+  i = hash % index->size;
+
+  /*
+   * The object names are not necessarily unique.  Search the entire cluster
+   * to return the object with the lowest index like the linear search.
+   */
+  while ( ( the_object = index->table[ i ] ) != NULL ) {
+    if (
+      the_object->name.name_u32 == name &&
+      ( found == 0 || the_object->id < found )
+    ) {
+      found = the_object->id;
+    }
+
+    i = _Objects_Name_index_next( i, index->size );
+  }
+
+  _ISR_lock_Release_and_ISR_enable( &index->Lock, &lock_context );
+
+  if ( found == 0 ) {
+    return false;
+  }
+
+  *id = found;
+  return true;
+}
+
+Objects_Control *_Objects_Name_index_find_string(
+  const Objects_Information *information,
+  const char                *name,
+  size_t                     name_length
+)
+{
+  Objects_Name_index *index;
+  Objects_Control    *the_object;
+  Objects_Control    *found;
+  size_t              hash;
+  size_t              i;
+  ISR_lock_Context    lock_context;
+
+  _Assert( _Objects_Has_string_name( information ) );
+  _Assert( _Objects_Allocator_is_owner() );
+
+  index = information->name_index;
+  hash = _Objects_Name_index_hash_string( name, name_length );
+  found = NULL;
+
+  _ISR_lock_ISR_disable_and_acquire( &index->Lock, &lock_context );
+
+  i = hash % index->size;
+
+  while ( ( the_object = index->table[ i ] ) != NULL ) {
+    if (
+      strncmp( name, the_object->name.name_p, information->name_length ) ==
+        0 &&
+      ( found == NULL || the_object->id < found->id )
+    ) {
+      found = the_object;
+    }
+
+    i = _Objects_Name_index_next( i, index->size );
+  }
+
+  _ISR_lock_Release_and_ISR_enable( &index->Lock, &lock_context );
+
+  return found;
+}
+
+bool _Objects_Name_index_extend(
+  const Objects_Information *information,
+  Objects_Maximum            maximum
+)
+{
+  Objects_Name_index *index;
+  Objects_Control   **table;
+  Objects_Control   **old_table;
+  size_t              size;
+  ISR_lock_Context    lock_context;
+
+  _Assert(
+    _Objects_Allocator_is_owner() ||
+    !_System_state_Is_up( _System_state_Get() )
+  );
+
+  index = information->name_index;
+  size = 2 * (size_t) maximum + 1;
+
+  if ( size <= index->size ) {
+    return true;
+  }
+
+  table = _Workspace_Allocate( size * sizeof( *table ) );
+  if ( table == NULL ) {
+    return false;
+  }
+
+  while ( true ) {
+    unsigned int generation;
+    size_t       i;
+
+    /*
+     * Populate the new table without holding the lock to avoid a long
+     * interrupt disabled section.  Only threads closing themselves may change
+     * the table concurrently.  In this case, try again.
+     */
+    _ISR_lock_ISR_disable_and_acquire( &index->Lock, &lock_context );
+    generation = index->generation;
+    _ISR_lock_Release_and_ISR_enable( &index->Lock, &lock_context );
+
+    memset( table, 0, size * sizeof( *table ) );
+
+    for ( i = 0; i < index->size; ++i ) {
+      Objects_Control *the_object;
+
+      the_object = index->table[ i ];
+
+      if ( the_object != NULL ) {
+        _Objects_Name_index_place(
+          table,
+          size,
+          _Objects_Name_index_hash( information, the_object ),
+          the_object
+        );
+      }
+    }
+
+    _ISR_lock_ISR_disable_and_acquire( &index->Lock, &lock_context );
+
+    if ( index->generation == generation ) {
+      break;
+    }
+
+    _ISR_lock_Release_and_ISR_enable( &index->Lock, &lock_context );
+  }
+
+  old_table = index->table;
+  index->table = table;
+  index->size = size;
+  ++index->generation;
+
+  _ISR_lock_Release_and_ISR_enable( &index->Lock, &lock_context );
+
+  /*
+   * The initial table is statically allocated.  It is in use as long as no
+   * object blocks were allocated, see _Objects_Extend_information().
+   */
+  if ( information->object_blocks != NULL ) {
+    _Workspace_Free( old_table );
+  }
+
+  return true;
+}
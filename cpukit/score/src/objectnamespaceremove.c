@@ -47,11 +47,14 @@ void _Objects_Namespace_remove_string(
   Objects_Control           *the_object
 )
 {
-  (void) information;
-
   char *name;
 
   _Assert( _Objects_Has_string_name( information ) );
+
+  if ( information->name_index != NULL ) {
+    _Objects_Name_index_remove( information, the_object );
+  }
+
   name = RTEMS_DECONST( char *, the_object->name.name_p );
   the_object->name.name_p = NULL;
   _Workspace_Free( name );
@@ -74,6 +74,22 @@ Objects_Control *_Objects_Get_by_name(
     *name_length_p = name_length;
   }
 
+  if ( information->name_index != NULL ) {
+    Objects_Control *the_object;
+
+    the_object = _Objects_Name_index_find_string(
+      information,
+      name,
+      name_length
+    );
+
+    if ( the_object == NULL ) {
+      *error = OBJECTS_GET_BY_NAME_NO_OBJECT;
+    }
+
+    return the_object;
+  }
+
   maximum = _Objects_Get_maximum_index( information );
 
   for ( index = 0; index < maximum; ++index ) {
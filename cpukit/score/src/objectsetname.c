@@ -60,6 +60,10 @@ Status_Control _Objects_Set_name(
       return STATUS_NO_MEMORY;
     }
 
+    if ( information->name_index != NULL ) {
+      _Objects_Name_index_remove( information, the_object );
+    }
+
     _Workspace_Free( RTEMS_DECONST( char *, the_object->name.name_p ) );
     the_object->name.name_p = dup;
   } else {
@@ -76,6 +80,10 @@ Status_Control _Objects_Set_name(
       c[ i ] = name[ i ];
     }
 
+    if ( information->name_index != NULL ) {
+      _Objects_Name_index_remove( information, the_object );
+    }
+
     the_object->name.name_u32 = _Objects_Build_name(
       c[ 0 ],
       c[ 1 ],
@@ -84,5 +92,9 @@ Status_Control _Objects_Set_name(
     );
   }
 
+  if ( information->name_index != NULL ) {
+    _Objects_Name_index_insert( information, the_object );
+  }
+
   return STATUS_SUCCESSFUL;
 }
@@ -90,6 +90,7 @@ void _Objects_Free_objects_block(
    *  Free the memory and reset the structures in the object' information
    */
 
+  _Objects_Wait_for_readers();
   _Workspace_Free( information->object_blocks[ block ] );
   information->object_blocks[ block ] = NULL;
   information->inactive_per_block[ block ] = 0;
@@ -55,9 +55,14 @@ typedef struct {
 
 static SMP_lock_Stats_control _SMP_lock_Stats_control = {
   .Lock =
-    { .Ticket_lock =
+    {
+#if defined( RTEMS_SMP_QUEUED_LOCK )
+      .Queued_lock = SMP_QUEUED_LOCK_INITIALIZER,
+#else
+      .Ticket_lock =
         { .next_ticket = ATOMIC_INITIALIZER_UINT( 0U ),
           .now_serving = ATOMIC_INITIALIZER_UINT( 0U ) },
+#endif
       .Stats =
         { .Node = CHAIN_NODE_INITIALIZER_ONE_NODE_CHAIN(
             &_SMP_lock_Stats_control.Stats_chain
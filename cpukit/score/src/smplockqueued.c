@@ -0,0 +1,258 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreSMPLock
+ *
+ * @brief This source file contains the implementation of
+ *   _SMP_queued_lock_Wait().
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/smplockqueued.h>
+#include <rtems/score/assert.h>
+#include <rtems/score/percpu.h>
+
+#define SMP_QUEUED_LOCK_LOCKED_OR_PENDING \
+  ( SMP_QUEUED_LOCK_LOCKED | SMP_QUEUED_LOCK_PENDING )
+
+static unsigned int _SMP_queued_lock_Encode_tail(
+  uint32_t     cpu_index,
+  unsigned int nest_level
+)
+{
+  unsigned int tail;
+
+  tail = cpu_index * SMP_QUEUED_LOCK_NODE_COUNT + nest_level + 1;
+  _Assert(
+    ( ( tail << SMP_QUEUED_LOCK_TAIL_SHIFT ) >> SMP_QUEUED_LOCK_TAIL_SHIFT ) ==
+    tail
+  );
+
+  return tail << SMP_QUEUED_LOCK_TAIL_SHIFT;
+}
+
+static SMP_queued_lock_Node *_SMP_queued_lock_Decode_tail( unsigned int tail )
+{
+  Per_CPU_Control *cpu;
+  unsigned int     index;
+
+  index = ( tail >> SMP_QUEUED_LOCK_TAIL_SHIFT ) - 1;
+  cpu = _Per_CPU_Get_by_index( index / SMP_QUEUED_LOCK_NODE_COUNT );
+
+  return &cpu->Queued_lock.Nodes[ index % SMP_QUEUED_LOCK_NODE_COUNT ];
+}
+
+static unsigned int _SMP_queued_lock_Wait_for_lock_word(
+  SMP_queued_lock_Control *lock,
+  unsigned int             mask
+)
+{
+  unsigned int value;
+
+  do {
+    value = _Atomic_Load_uint( &lock->value, ATOMIC_ORDER_ACQUIRE );
+  } while ( ( value & mask ) != 0 );
+
+  return value;
+}
+
+static unsigned int _SMP_queued_lock_Enqueue(
+  SMP_queued_lock_Control *lock,
+  SMP_queued_lock_Node    *node,
+  unsigned int             tail
+)
+{
+  unsigned int value;
+  uintptr_t    next;
+
+  _Atomic_Store_uintptr( &node->next, 0, ATOMIC_ORDER_RELAXED );
+  _Atomic_Store_uint( &node->locked, 1, ATOMIC_ORDER_RELAXED );
+  node->queue_length = 1;
+
+  /* Make this node the new queue tail */
+  value = _Atomic_Load_uint( &lock->value, ATOMIC_ORDER_RELAXED );
+
+  while (
+    !_Atomic_Compare_exchange_uint(
+      &lock->value,
+      &value,
+      ( value & ~SMP_QUEUED_LOCK_TAIL_MASK ) | tail,
+      ATOMIC_ORDER_ACQ_REL,
+      ATOMIC_ORDER_RELAXED
+    )
+  ) {
+    /* Retry */
+  }
+
+  if ( ( value & SMP_QUEUED_LOCK_TAIL_MASK ) != 0 ) {
+    SMP_queued_lock_Node *previous;
+    unsigned int          locked;
+
+    previous = _SMP_queued_lock_Decode_tail(
+      value & SMP_QUEUED_LOCK_TAIL_MASK
+    );
+    _Atomic_Store_uintptr(
+      &previous->next,
+      (uintptr_t) node,
+      ATOMIC_ORDER_RELEASE
+    );
+
+    do {
+      locked = _Atomic_Load_uint( &node->locked, ATOMIC_ORDER_ACQUIRE );
+    } while ( locked != 0 );
+  }
+
+  /*
+   * We are the queue head now.  Wait for the owner and the pending waiter and
+   * then claim the lock.  New waiters do not set the pending flag
+   * persistently since the queue is not empty.
+   */
+  while ( true ) {
+    value = _SMP_queued_lock_Wait_for_lock_word(
+      lock,
+      SMP_QUEUED_LOCK_LOCKED_OR_PENDING
+    );
+
+    if ( ( value & SMP_QUEUED_LOCK_TAIL_MASK ) != tail ) {
+      break;
+    }
+
+    /* We are also the queue tail, so try to empty the queue */
+    if (
+      _Atomic_Compare_exchange_uint(
+        &lock->value,
+        &value,
+        SMP_QUEUED_LOCK_LOCKED,
+        ATOMIC_ORDER_ACQUIRE,
+        ATOMIC_ORDER_RELAXED
+      )
+    ) {
+      return node->queue_length;
+    }
+  }
+
+  (void) _Atomic_Fetch_or_uint(
+    &lock->value,
+    SMP_QUEUED_LOCK_LOCKED,
+    ATOMIC_ORDER_ACQUIRE
+  );
+
+  /* Pass the queue head position on to the next node */
+  do {
+    next = _Atomic_Load_uintptr( &node->next, ATOMIC_ORDER_ACQUIRE );
+  } while ( next == 0 );
+
+  ( (SMP_queued_lock_Node *) next )->queue_length = node->queue_length + 1;
+  _Atomic_Store_uint(
+    &( (SMP_queued_lock_Node *) next )->locked,
+    0,
+    ATOMIC_ORDER_RELEASE
+  );
+
+  return node->queue_length;
+}
+
+unsigned int _SMP_queued_lock_Wait(
+  SMP_queued_lock_Control *lock,
+  unsigned int             value
+)
+{
+  Per_CPU_Control *cpu_self;
+  unsigned int     nest_level;
+  unsigned int     initial_queue_length;
+
+  /*
+   * If the lock is only owned, then become the pending waiter which spins on
+   * the lock word.  This avoids the queue node handling for the common case
+   * of a lock with one owner and one waiter.
+   */
+  if ( ( value & ~SMP_QUEUED_LOCK_LOCKED ) == 0 ) {
+    value = _Atomic_Fetch_or_uint(
+      &lock->value,
+      SMP_QUEUED_LOCK_PENDING,
+      ATOMIC_ORDER_ACQUIRE
+    );
+
+    if ( ( value & ~SMP_QUEUED_LOCK_LOCKED ) == 0 ) {
+      (void) _SMP_queued_lock_Wait_for_lock_word(
+        lock,
+        SMP_QUEUED_LOCK_LOCKED
+      );
+      (void) _Atomic_Fetch_sub_uint(
+        &lock->value,
+        SMP_QUEUED_LOCK_PENDING - SMP_QUEUED_LOCK_LOCKED,
+        ATOMIC_ORDER_RELAXED
+      );
+
+      return 1;
+    }
+
+    /* Somebody else was faster, so undo our pending flag if we set it */
+    if ( ( value & SMP_QUEUED_LOCK_PENDING ) == 0 ) {
+      (void) _Atomic_Fetch_and_uint(
+        &lock->value,
+        ~SMP_QUEUED_LOCK_PENDING,
+        ATOMIC_ORDER_RELAXED
+      );
+    }
+  }
+
+  cpu_self = _Per_CPU_Get();
+  nest_level = cpu_self->Queued_lock.nest_level;
+
+  if ( RTEMS_PREDICT_FALSE( nest_level >= SMP_QUEUED_LOCK_NODE_COUNT ) ) {
+    /*
+     * All queue nodes of this processor are in use.  This requires deeply
+     * nested interrupts which acquire contended locks.  Fall back to a simple
+     * spin until the lock word is free.
+     */
+    while ( !_SMP_queued_lock_Try_acquire( lock ) ) {
+      /* Wait */
+    }
+
+    return 1;
+  }
+
+  cpu_self->Queued_lock.nest_level = nest_level + 1;
+  initial_queue_length = _SMP_queued_lock_Enqueue(
+    lock,
+    &cpu_self->Queued_lock.Nodes[ nest_level ],
+    _SMP_queued_lock_Encode_tail(
+      _Per_CPU_Get_index( cpu_self ),
+      nest_level
+    )
+  );
+  cpu_self->Queued_lock.nest_level = nest_level;
+
+  return initial_queue_length;
+}
@@ -53,6 +53,11 @@ void _Watchdog_Insert(
 
   _Assert( _Watchdog_Get_state( the_watchdog ) == WATCHDOG_INACTIVE );
 
+  if ( header->wheel != NULL ) {
+    _Watchdog_Wheel_insert( header->wheel, the_watchdog, expire );
+    return;
+  }
+
   link = _RBTree_Root_reference( &header->Watchdogs );
   parent = NULL;
   old_first = header->first;
@@ -0,0 +1,204 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreWatchdog
+ *
+ * @brief This source file contains the implementation of
+ *   _Watchdog_Ticks_to_next_expiration().
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/watchdogimpl.h>
+#include <rtems/score/chainimpl.h>
+#include <rtems/score/timecounter.h>
+
+#include <sys/param.h>
+
+static uint64_t _Watchdog_Wheel_Get_next_expiration(
+  const Watchdog_Wheel *wheel
+)
+{
+  uint64_t time;
+  uint64_t next;
+  int      level;
+
+  time = wheel->time;
+
+  /*
+   * The watchdogs of the first level expire exactly at the time of their slot
+   * within the next revolution.
+   */
+  for ( next = time + 1; next <= time + WATCHDOG_WHEEL_SLOTS; ++next ) {
+    const Chain_Control *slot;
+
+    slot = &wheel->Slots[ 0 ][ next & WATCHDOG_WHEEL_MASK ];
+
+    if ( !_Chain_Is_empty( slot ) ) {
+      return next;
+    }
+  }
+
+  /*
+   * The watchdogs of the other levels expire not before their slot is
+   * cascaded.  Use the cascade time as a lower bound.
+   */
+  next = UINT64_MAX;
+
+  for ( level = 1; level < WATCHDOG_WHEEL_LEVELS; ++level ) {
+    int      shift;
+    uint64_t cascade;
+    uint32_t i;
+
+    shift = level * WATCHDOG_WHEEL_BITS;
+    cascade = time >> shift;
+
+    for ( i = 0; i < WATCHDOG_WHEEL_SLOTS; ++i ) {
+      ++cascade;
+
+      if (
+        !_Chain_Is_empty(
+          &wheel->Slots[ level ][ cascade & WATCHDOG_WHEEL_MASK ]
+        )
+      ) {
+        next = MIN( next, cascade << shift );
+        break;
+      }
+    }
+  }
+
+  if ( !_Chain_Is_empty( &wheel->Overflow ) ) {
+    int shift;
+
+    shift = WATCHDOG_WHEEL_LEVELS * WATCHDOG_WHEEL_BITS;
+    next = MIN( next, ( ( time >> shift ) + 1 ) << shift );
+  }
+
+  return next;
+}
+
+static uint64_t _Watchdog_Header_get_first_expiration(
+  const Watchdog_Header *header
+)
+{
+  const Watchdog_Control *first;
+
+  first = _Watchdog_Header_first( header );
+
+  if ( first == NULL ) {
+    return UINT64_MAX;
+  }
+
+  return first->expire;
+}
+
+static uint64_t _Watchdog_Clock_ticks_to_expiration(
+  uint64_t               expire,
+  const struct timespec *now
+)
+{
+  uint64_t expire_ns;
+  uint64_t now_ns;
+
+  if ( expire == UINT64_MAX ) {
+    return UINT64_MAX;
+  }
+
+  expire_ns = ( expire >> WATCHDOG_BITS_FOR_1E9_NANOSECONDS ) *
+    WATCHDOG_NANOSECONDS_PER_SECOND +
+    ( expire & ( ( 1U << WATCHDOG_BITS_FOR_1E9_NANOSECONDS ) - 1 ) );
+  now_ns = (uint64_t) now->tv_sec * WATCHDOG_NANOSECONDS_PER_SECOND +
+    (uint64_t) now->tv_nsec;
+
+  if ( expire_ns <= now_ns ) {
+    return 0;
+  }
+
+  /*
+   * Round down, a processor which wakes up too early just goes to sleep
+   * again.
+   */
+  return ( expire_ns - now_ns ) / _Watchdog_Nanoseconds_per_tick;
+}
+
+uint32_t _Watchdog_Ticks_to_next_expiration(
+  Per_CPU_Control *cpu,
+  uint32_t         maximum
+)
+{
+  ISR_lock_Context lock_context;
+  Watchdog_Header *header;
+  uint64_t         expire;
+  uint64_t         ticks;
+  uint64_t         delta;
+  struct timespec  now;
+
+  _Assert( maximum > 0 );
+  delta = maximum;
+
+  _ISR_lock_ISR_disable_and_acquire( &cpu->Watchdog.Lock, &lock_context );
+
+  ticks = cpu->Watchdog.ticks;
+  header = &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_TICKS ];
+
+  if ( header->wheel != NULL ) {
+    expire = _Watchdog_Wheel_Get_next_expiration( header->wheel );
+  } else {
+    expire = _Watchdog_Header_get_first_expiration( header );
+  }
+
+  if ( expire <= ticks ) {
+    delta = 1;
+  } else {
+    delta = MIN( delta, expire - ticks );
+  }
+
+  header = &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_MONOTONIC ];
+  expire = _Watchdog_Header_get_first_expiration( header );
+
+  if ( expire != UINT64_MAX ) {
+    _Timecounter_Getnanouptime( &now );
+    delta = MIN( delta, _Watchdog_Clock_ticks_to_expiration( expire, &now ) );
+  }
+
+  header = &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_REALTIME ];
+  expire = _Watchdog_Header_get_first_expiration( header );
+
+  if ( expire != UINT64_MAX ) {
+    _Timecounter_Getnanotime( &now );
+    delta = MIN( delta, _Watchdog_Clock_ticks_to_expiration( expire, &now ) );
+  }
+
+  _ISR_lock_Release_and_ISR_enable( &cpu->Watchdog.Lock, &lock_context );
+
+  return (uint32_t) MAX( delta, 1 );
+}
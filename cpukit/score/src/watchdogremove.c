@@ -45,6 +45,11 @@ void _Watchdog_Remove(
   Watchdog_Control *the_watchdog
 )
 {
+  if ( header->wheel != NULL ) {
+    _Watchdog_Wheel_remove( header->wheel, the_watchdog );
+    return;
+  }
+
   if ( _Watchdog_Is_scheduled( the_watchdog ) ) {
     if ( header->first == &the_watchdog->Node.RBTree ) {
       _Watchdog_Next_first( header, the_watchdog );
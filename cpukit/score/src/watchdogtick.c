@@ -6,7 +6,7 @@
  * @ingroup RTEMSScoreWatchdog
  *
  * @brief This source file contains the implementation of
- *   _Watchdog_Do_tickle() and _Watchdog_Tick().
+ *   _Watchdog_Do_tickle(), _Watchdog_Tick(), and _Watchdog_Tick_multiple().
  */
 
 /*
@@ -73,7 +73,10 @@ void _Watchdog_Do_tickle(
   } while ( first != NULL );
 }
 
-void _Watchdog_Tick( Per_CPU_Control *cpu )
+static inline void _Watchdog_Do_tick(
+  Per_CPU_Control *cpu,
+  uint32_t         count
+)
 {
   ISR_lock_Context                    lock_context;
   Watchdog_Header                    *header;
@@ -86,7 +89,7 @@ void _Watchdog_Tick( Per_CPU_Control *cpu )
 #ifdef RTEMS_SMP
   if ( _Per_CPU_Is_boot_processor( cpu ) ) {
 #endif
-    ++_Watchdog_Ticks_since_boot;
+    _Watchdog_Ticks_since_boot += count;
 #ifdef RTEMS_SMP
   }
 #endif
@@ -94,21 +97,31 @@ void _Watchdog_Tick( Per_CPU_Control *cpu )
   _ISR_lock_ISR_disable_and_acquire( &cpu->Watchdog.Lock, &lock_context );
 
   ticks = cpu->Watchdog.ticks;
-  _Assert( ticks < UINT64_MAX );
-  ++ticks;
+  _Assert( ticks <= UINT64_MAX - count );
+  ticks += count;
   cpu->Watchdog.ticks = ticks;
 
   header = &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_TICKS ];
-  first = _Watchdog_Header_first( header );
 
-  if ( first != NULL ) {
-    _Watchdog_Tickle(
-      header,
-      first,
+  if ( header->wheel != NULL ) {
+    _Watchdog_Wheel_tick(
+      header->wheel,
       ticks,
       &cpu->Watchdog.Lock,
       &lock_context
     );
+  } else {
+    first = _Watchdog_Header_first( header );
+
+    if ( first != NULL ) {
+      _Watchdog_Tickle(
+        header,
+        first,
+        ticks,
+        &cpu->Watchdog.Lock,
+        &lock_context
+      );
+    }
   }
 
   header = &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_MONOTONIC ];
@@ -151,6 +164,20 @@ void _Watchdog_Tick( Per_CPU_Control *cpu )
   cpu_budget_operations = executing->CPU_budget.operations;
 
   if ( cpu_budget_operations != NULL ) {
-    ( *cpu_budget_operations->at_tick )( executing );
+    do {
+      ( *cpu_budget_operations->at_tick )( executing );
+      --count;
+    } while ( count > 0 );
   }
 }
+
+void _Watchdog_Tick( Per_CPU_Control *cpu )
+{
+  _Watchdog_Do_tick( cpu, 1 );
+}
+
+void _Watchdog_Tick_multiple( Per_CPU_Control *cpu, uint32_t count )
+{
+  _Assert( count > 0 );
+  _Watchdog_Do_tick( cpu, count );
+}
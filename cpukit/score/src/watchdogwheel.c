@@ -0,0 +1,206 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreWatchdog
+ *
+ * @brief This source file contains the implementation of
+ *   _Watchdog_Wheel_insert(), _Watchdog_Wheel_remove(), and
+ *   _Watchdog_Wheel_do_tick().
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/watchdogimpl.h>
+#include <rtems/score/chainimpl.h>
+
+static Chain_Control *_Watchdog_Wheel_Get_slot(
+  Watchdog_Wheel *wheel,
+  uint64_t        expire
+)
+{
+  uint64_t base;
+  uint64_t delta;
+  int      level;
+
+  /*
+   * The slots of the next clock tick are the first slots to be processed.
+   * Watchdogs which are already expired are placed there.
+   */
+  base = wheel->time + 1;
+
+  if ( expire < base ) {
+    expire = base;
+  }
+
+  delta = expire - base;
+
+  for ( level = 0; level < WATCHDOG_WHEEL_LEVELS; ++level ) {
+    int      shift;
+    uint64_t index;
+
+    shift = level * WATCHDOG_WHEEL_BITS;
+
+    if ( delta < ( (uint64_t) WATCHDOG_WHEEL_SLOTS << shift ) ) {
+      index = ( expire >> shift ) & WATCHDOG_WHEEL_MASK;
+      return &wheel->Slots[ level ][ index ];
+    }
+  }
+
+  return &wheel->Overflow;
+}
+
+static void _Watchdog_Wheel_Cascade(
+  Watchdog_Wheel *wheel,
+  Chain_Control  *slot
+)
+{
+  Chain_Node       *node;
+  const Chain_Node *tail;
+
+  node = _Chain_First( slot );
+  tail = _Chain_Immutable_tail( slot );
+
+  while ( node != tail ) {
+    Chain_Node       *next;
+    Watchdog_Control *the_watchdog;
+    Chain_Control    *target;
+
+    next = _Chain_Next( node );
+    the_watchdog = RTEMS_CONTAINER_OF( node, Watchdog_Control, Node.Chain );
+    target = _Watchdog_Wheel_Get_slot( wheel, the_watchdog->expire );
+
+    if ( target != slot ) {
+      _Chain_Extract_unprotected( node );
+      _Chain_Append_unprotected( target, node );
+    }
+
+    node = next;
+  }
+}
+
+void _Watchdog_Wheel_insert(
+  Watchdog_Wheel   *wheel,
+  Watchdog_Control *the_watchdog,
+  uint64_t          expire
+)
+{
+  _Assert( _Watchdog_Get_state( the_watchdog ) == WATCHDOG_INACTIVE );
+
+  the_watchdog->expire = expire;
+  _Chain_Initialize_node( &the_watchdog->Node.Chain );
+  _Chain_Append_unprotected(
+    _Watchdog_Wheel_Get_slot( wheel, expire ),
+    &the_watchdog->Node.Chain
+  );
+  _Watchdog_Set_state( the_watchdog, WATCHDOG_SCHEDULED_BLACK );
+  ++wheel->count;
+}
+
+void _Watchdog_Wheel_remove(
+  Watchdog_Wheel   *wheel,
+  Watchdog_Control *the_watchdog
+)
+{
+  if ( _Watchdog_Is_scheduled( the_watchdog ) ) {
+    _Assert( wheel->count > 0 );
+    _Chain_Extract_unprotected( &the_watchdog->Node.Chain );
+    _Watchdog_Set_state( the_watchdog, WATCHDOG_INACTIVE );
+    --wheel->count;
+  }
+}
+
+void _Watchdog_Wheel_do_tick(
+  Watchdog_Wheel   *wheel,
+  uint64_t          now,
+#ifdef RTEMS_SMP
+  ISR_lock_Control *lock,
+#endif
+  ISR_lock_Context *lock_context
+)
+{
+  while ( wheel->time < now ) {
+    uint64_t       ticks;
+    Chain_Control *slot;
+    Chain_Node    *node;
+
+    if ( wheel->count == 0 ) {
+      wheel->time = now;
+      break;
+    }
+
+    ticks = wheel->time + 1;
+
+    if ( ( ticks & WATCHDOG_WHEEL_MASK ) == 0 ) {
+      int level;
+
+      for ( level = 1; level < WATCHDOG_WHEEL_LEVELS; ++level ) {
+        uint64_t index;
+
+        index = ( ticks >> ( level * WATCHDOG_WHEEL_BITS ) ) &
+          WATCHDOG_WHEEL_MASK;
+        _Watchdog_Wheel_Cascade( wheel, &wheel->Slots[ level ][ index ] );
+
+        if ( index != 0 ) {
+          break;
+        }
+      }
+
+      if ( level == WATCHDOG_WHEEL_LEVELS ) {
+        _Watchdog_Wheel_Cascade( wheel, &wheel->Overflow );
+      }
+    }
+
+    /*
+     * The wheel time is updated after the slot is drained, so that watchdogs
+     * inserted by the routines with an expiration time less than or equal to
+     * the current tick are placed into this slot and called in this tick.
+     */
+    slot = &wheel->Slots[ 0 ][ ticks & WATCHDOG_WHEEL_MASK ];
+
+    while ( ( node = _Chain_Get_unprotected( slot ) ) != NULL ) {
+      Watchdog_Control              *the_watchdog;
+      Watchdog_Service_routine_entry routine;
+
+      the_watchdog = RTEMS_CONTAINER_OF( node, Watchdog_Control, Node.Chain );
+      _Assert( the_watchdog->expire <= ticks );
+      _Watchdog_Set_state( the_watchdog, WATCHDOG_INACTIVE );
+      --wheel->count;
+      routine = the_watchdog->routine;
+
+      _ISR_lock_Release_and_ISR_enable( lock, lock_context );
+      ( *routine )( the_watchdog );
+      _ISR_lock_ISR_disable_and_acquire( lock, lock_context );
+    }
+
+    wheel->time = ticks;
+  }
+}
@@ -0,0 +1,78 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreWatchdog
+ *
+ * @brief This source file contains the implementation of
+ *   _Watchdog_Wheel_initialize().
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/watchdogimpl.h>
+#include <rtems/score/chainimpl.h>
+#include <rtems/config.h>
+
+void _Watchdog_Wheel_initialize( void )
+{
+  uint32_t cpu_max;
+  uint32_t cpu_index;
+
+  cpu_max = rtems_configuration_get_maximum_processors();
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    Per_CPU_Control *cpu;
+    Watchdog_Wheel  *wheel;
+    size_t           level;
+    size_t           slot;
+
+    cpu = _Per_CPU_Get_by_index( cpu_index );
+    wheel = &_Watchdog_Wheels[ cpu_index ];
+    wheel->time = cpu->Watchdog.ticks;
+    wheel->count = 0;
+
+    for ( level = 0; level < WATCHDOG_WHEEL_LEVELS; ++level ) {
+      for ( slot = 0; slot < WATCHDOG_WHEEL_SLOTS; ++slot ) {
+        _Chain_Initialize_empty( &wheel->Slots[ level ][ slot ] );
+      }
+    }
+
+    _Chain_Initialize_empty( &wheel->Overflow );
+
+    _Assert(
+      _Watchdog_Header_is_empty(
+        &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_TICKS ]
+      )
+    );
+    cpu->Watchdog.Header[ PER_CPU_WATCHDOG_TICKS ].wheel = wheel;
+  }
+}
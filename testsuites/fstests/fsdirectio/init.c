@@ -0,0 +1,226 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems.h>
+
+#include "fstest.h"
+#include "fs_config.h"
+#include <tmacros.h>
+
+const char             rtems_test_name[] = "FSDIRECTIO " FILESYSTEM;
+const RTEMS_TEST_STATE rtems_test_state = TEST_STATE;
+
+/*
+ * The transfers cover enough whole blocks to use the direct transfers of the
+ * block device buffer cache.
+ */
+#define TRANSFER_BLOCKS 16
+
+static const mode_t mode = S_IRWXU | S_IRWXG | S_IRWXO;
+
+typedef struct {
+  int    fd;
+  size_t block_size;
+  size_t size;
+  char  *out;
+  char  *in;
+} test_context;
+
+static void random_fill( char *dst, size_t n )
+{
+  static uint32_t u = 0x12345678;
+  size_t          i;
+
+  for ( i = 0; i < n; ++i ) {
+    u *= 1664525;
+    u += 1013904223;
+    dst[ i ] = (char) ( u >> 24 );
+  }
+}
+
+static void do_lseek( const test_context *ctx, size_t pos )
+{
+  off_t actual;
+
+  actual = lseek( ctx->fd, pos, SEEK_SET );
+  rtems_test_assert( actual == (off_t) pos );
+}
+
+static void do_write( test_context *ctx, size_t pos, size_t size )
+{
+  ssize_t n;
+
+  random_fill( ctx->out + pos, size );
+  do_lseek( ctx, pos );
+
+  n = write( ctx->fd, ctx->out + pos, size );
+  rtems_test_assert( n == (ssize_t) size );
+}
+
+static void check( test_context *ctx, size_t pos, size_t size )
+{
+  ssize_t n;
+
+  memset( ctx->in, 0, ctx->size );
+  do_lseek( ctx, pos );
+
+  n = read( ctx->fd, ctx->in, size );
+  rtems_test_assert( n == (ssize_t) size );
+  rtems_test_assert( memcmp( ctx->out + pos, ctx->in, size ) == 0 );
+}
+
+static void reopen( test_context *ctx )
+{
+  int rv;
+
+  rv = close( ctx->fd );
+  rtems_test_assert( rv == 0 );
+
+  ctx->fd = open( "file", O_RDWR );
+  rtems_test_assert( ctx->fd >= 0 );
+}
+
+/*
+ * Write and read all blocks of the file with one transfer.  The unaligned
+ * read covers a partial block at the begin and the end.
+ */
+static void test_multi_block_transfer( test_context *ctx )
+{
+  puts( "test case: multi-block transfer" );
+
+  do_write( ctx, 0, ctx->size );
+  check( ctx, 0, ctx->size );
+  check( ctx, ctx->block_size / 2, ctx->size - ctx->block_size );
+
+  reopen( ctx );
+  check( ctx, 0, ctx->size );
+}
+
+/*
+ * Modify the file through the cache and then use direct transfers which cover
+ * the modified blocks.  The direct read shall return the modified data and
+ * the direct write shall update the cached blocks.
+ */
+static void test_cache_coherence( test_context *ctx )
+{
+  size_t pos;
+
+  puts( "test case: cache coherence" );
+
+  pos = 3 * ctx->block_size + 5;
+  do_write( ctx, pos, 1 );
+  check( ctx, 0, ctx->size );
+
+  pos = 5 * ctx->block_size + 3;
+  check( ctx, pos, 10 );
+  do_write( ctx, 0, ctx->size );
+  check( ctx, pos, 10 );
+  check( ctx, 0, ctx->size );
+
+  pos = 2 * ctx->block_size;
+  do_write( ctx, pos, 4 * ctx->block_size );
+  check( ctx, 0, ctx->size );
+
+  reopen( ctx );
+  check( ctx, 0, ctx->size );
+}
+
+/*
+ * The direct transfers need a buffer aligned to the cache line size.  A
+ * transfer with an unaligned buffer uses the cache.
+ */
+static void test_unaligned_buffer( test_context *ctx )
+{
+  char   *buf;
+  ssize_t n;
+
+  puts( "test case: unaligned buffer" );
+
+  buf = ctx->in + 1;
+  random_fill( ctx->out, ctx->size );
+  memcpy( buf, ctx->out, ctx->size );
+
+  do_lseek( ctx, 0 );
+  n = write( ctx->fd, buf, ctx->size );
+  rtems_test_assert( n == (ssize_t) ctx->size );
+
+  memset( buf, 0, ctx->size );
+  do_lseek( ctx, 0 );
+  n = read( ctx->fd, buf, ctx->size );
+  rtems_test_assert( n == (ssize_t) ctx->size );
+  rtems_test_assert( memcmp( ctx->out, buf, ctx->size ) == 0 );
+
+  check( ctx, 0, ctx->size );
+}
+
+void test( void )
+{
+  test_context ctx;
+  struct stat  st;
+  int          rv;
+
+  ctx.fd = open( "file", O_RDWR | O_CREAT | O_TRUNC, mode );
+  rtems_test_assert( ctx.fd >= 0 );
+
+  rv = fstat( ctx.fd, &st );
+  rtems_test_assert( rv == 0 );
+
+  ctx.block_size = st.st_blksize;
+  ctx.size = TRANSFER_BLOCKS * ctx.block_size;
+
+  ctx.out = rtems_cache_aligned_malloc( ctx.size );
+  rtems_test_assert( ctx.out != NULL );
+
+  /* One more byte for the unaligned buffer */
+  ctx.in = rtems_cache_aligned_malloc( ctx.size + 1 );
+  rtems_test_assert( ctx.in != NULL );
+
+  test_multi_block_transfer( &ctx );
+  test_cache_coherence( &ctx );
+  test_unaligned_buffer( &ctx );
+
+  rv = close( ctx.fd );
+  rtems_test_assert( rv == 0 );
+
+  rv = unlink( "file" );
+  rtems_test_assert( rv == 0 );
+
+  free( ctx.out );
+  free( ctx.in );
+}
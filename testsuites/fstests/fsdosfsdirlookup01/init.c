@@ -0,0 +1,340 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/ioctl.h>
+#include <sys/stat.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems.h>
+#include <rtems/dosfs.h>
+#include <rtems/ramdisk.h>
+
+const char rtems_test_name[] = "FSDOSFSDIRLOOKUP 1";
+
+#define RAMDISK_PATH "/dev/rda"
+
+#define MOUNT_PATH "/mnt"
+
+#define DIR_PATH MOUNT_PATH "/dir"
+
+#define DIRECTORY_ENTRIES 10000
+
+#define OPEN_COUNT 100
+
+#define NAME_CACHE_ENTRIES 16384
+
+static void make_name( char *name, size_t size, size_t i )
+{
+  int n;
+
+  /* Use short and long file names */
+  if ( i % 2 == 0 ) {
+    n = snprintf( name, size, "f%05zu.txt", i );
+  } else {
+    n = snprintf( name, size, "File-%05zu.txt", i );
+  }
+
+  rtems_test_assert( n > 0 && (size_t) n < size );
+}
+
+static void make_path( char *path, size_t size, size_t i )
+{
+  char name[ 32 ];
+  int  n;
+
+  make_name( name, sizeof( name ), i );
+  n = snprintf( path, size, "%s/%s", DIR_PATH, name );
+  rtems_test_assert( n > 0 && (size_t) n < size );
+}
+
+static void mount_with_name_cache( uint32_t name_cache_entries )
+{
+  rtems_dosfs_mount_options mount_opts;
+  int                       rv;
+
+  memset( &mount_opts, 0, sizeof( mount_opts ) );
+  mount_opts.name_cache_entries = name_cache_entries;
+
+  rv = mount(
+    RAMDISK_PATH,
+    MOUNT_PATH,
+    RTEMS_FILESYSTEM_TYPE_DOSFS,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    &mount_opts
+  );
+  rtems_test_assert( rv == 0 );
+}
+
+static void get_name_cache_stats( rtems_dosfs_name_cache_stats *stats )
+{
+  int fd;
+  int rv;
+
+  fd = open( MOUNT_PATH, O_RDONLY );
+  rtems_test_assert( fd >= 0 );
+
+  rv = ioctl( fd, RTEMS_DOSFS_GET_NAME_CACHE_STATS, stats );
+  rtems_test_assert( rv == 0 );
+
+  rv = close( fd );
+  rtems_test_assert( rv == 0 );
+}
+
+static void create_entries( void )
+{
+  char   path[ 64 ];
+  size_t i;
+  int    rv;
+
+  rv = msdos_format( RAMDISK_PATH, NULL );
+  rtems_test_assert( rv == 0 );
+
+  mount_with_name_cache( NAME_CACHE_ENTRIES );
+
+  rv = mkdir( DIR_PATH, S_IRWXU );
+  rtems_test_assert( rv == 0 );
+
+  for ( i = 0; i < DIRECTORY_ENTRIES; ++i ) {
+    int fd;
+
+    make_path( path, sizeof( path ), i );
+    fd = creat( path, S_IRWXU );
+    rtems_test_assert( fd >= 0 );
+
+    rv = close( fd );
+    rtems_test_assert( rv == 0 );
+  }
+
+  rv = unmount( MOUNT_PATH );
+  rtems_test_assert( rv == 0 );
+}
+
+static void benchmark_open( uint32_t name_cache_entries )
+{
+  rtems_dosfs_name_cache_stats stats;
+  char                         path[ 64 ];
+  uint64_t                     begin;
+  uint64_t                     duration;
+  size_t                       i;
+  int                          rv;
+
+  mount_with_name_cache( name_cache_entries );
+
+  begin = rtems_clock_get_uptime_nanoseconds();
+
+  for ( i = 0; i < OPEN_COUNT; ++i ) {
+    int fd;
+
+    make_path(
+      path,
+      sizeof( path ),
+      ( i * ( DIRECTORY_ENTRIES / OPEN_COUNT ) + i ) % DIRECTORY_ENTRIES
+    );
+    fd = open( path, O_RDONLY );
+    rtems_test_assert( fd >= 0 );
+
+    rv = close( fd );
+    rtems_test_assert( rv == 0 );
+  }
+
+  duration = rtems_clock_get_uptime_nanoseconds() - begin;
+
+  printf(
+    "open in directory with %d entries, name cache with %5" PRIu32
+    " entries: %" PRIu64 "ns\n",
+    DIRECTORY_ENTRIES,
+    name_cache_entries,
+    duration / OPEN_COUNT
+  );
+
+  get_name_cache_stats( &stats );
+
+  if ( name_cache_entries == 0 ) {
+    rtems_test_assert( stats.entries == 0 );
+    rtems_test_assert( stats.hits == 0 );
+    rtems_test_assert( stats.misses == 0 );
+    rtems_test_assert( stats.fills == 0 );
+  } else {
+    rtems_test_assert( stats.entries == name_cache_entries );
+    rtems_test_assert( stats.hits + stats.misses == OPEN_COUNT );
+    /* Hash collisions in the direct mapped cache may evict some names */
+    rtems_test_assert( stats.hits >= OPEN_COUNT / 2 );
+    rtems_test_assert( stats.fills == 1 );
+  }
+
+  rv = unmount( MOUNT_PATH );
+  rtems_test_assert( rv == 0 );
+}
+
+static void test_rename_and_unlink( void )
+{
+  rtems_dosfs_name_cache_stats stats;
+  struct stat                  st;
+  char                         path[ 64 ];
+  char                         other[ 64 ];
+  int                          rv;
+
+  mount_with_name_cache( NAME_CACHE_ENTRIES );
+
+  /* Fill the cache */
+  make_path( path, sizeof( path ), DIRECTORY_ENTRIES - 1 );
+  rv = stat( path, &st );
+  rtems_test_assert( rv == 0 );
+
+  /* Move a long name to the end of the directory */
+  make_path( path, sizeof( path ), 1 );
+  rv = rename( path, DIR_PATH "/Renamed-long-name.txt" );
+  rtems_test_assert( rv == 0 );
+
+  errno = 0;
+  rv = stat( path, &st );
+  rtems_test_assert( rv == -1 );
+  rtems_test_assert( errno == ENOENT );
+
+  rv = stat( DIR_PATH "/Renamed-long-name.txt", &st );
+  rtems_test_assert( rv == 0 );
+
+  /* Reuse the free directory entries of the old name */
+  make_path( other, sizeof( other ), 2 );
+  rv = unlink( other );
+  rtems_test_assert( rv == 0 );
+
+  rv = rename( DIR_PATH "/Renamed-long-name.txt", path );
+  rtems_test_assert( rv == 0 );
+
+  rv = stat( path, &st );
+  rtems_test_assert( rv == 0 );
+
+  errno = 0;
+  rv = stat( DIR_PATH "/Renamed-long-name.txt", &st );
+  rtems_test_assert( rv == -1 );
+  rtems_test_assert( errno == ENOENT );
+
+  errno = 0;
+  rv = stat( other, &st );
+  rtems_test_assert( rv == -1 );
+  rtems_test_assert( errno == ENOENT );
+
+  get_name_cache_stats( &stats );
+  rtems_test_assert( stats.fills == 1 );
+
+  /* A removed directory must not share the fill state with a new one */
+  rv = mkdir( MOUNT_PATH "/a", S_IRWXU );
+  rtems_test_assert( rv == 0 );
+
+  rv = creat( MOUNT_PATH "/a/x", S_IRWXU );
+  rtems_test_assert( rv >= 0 );
+
+  rv = close( rv );
+  rtems_test_assert( rv == 0 );
+
+  rv = stat( MOUNT_PATH "/a/x", &st );
+  rtems_test_assert( rv == 0 );
+
+  rv = unlink( MOUNT_PATH "/a/x" );
+  rtems_test_assert( rv == 0 );
+
+  rv = rmdir( MOUNT_PATH "/a" );
+  rtems_test_assert( rv == 0 );
+
+  rv = mkdir( MOUNT_PATH "/b", S_IRWXU );
+  rtems_test_assert( rv == 0 );
+
+  errno = 0;
+  rv = stat( MOUNT_PATH "/b/x", &st );
+  rtems_test_assert( rv == -1 );
+  rtems_test_assert( errno == ENOENT );
+
+  rv = rmdir( MOUNT_PATH "/b" );
+  rtems_test_assert( rv == 0 );
+
+  rv = unmount( MOUNT_PATH );
+  rtems_test_assert( rv == 0 );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  int rv;
+
+  (void) arg;
+
+  TEST_BEGIN();
+
+  rv = mkdir( MOUNT_PATH, S_IRWXU );
+  rtems_test_assert( rv == 0 );
+
+  create_entries();
+  benchmark_open( 0 );
+  benchmark_open( NAME_CACHE_ENTRIES );
+  test_rename_and_unlink();
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+rtems_ramdisk_config rtems_ramdisk_configuration[] = {
+  { .block_size = 512, .block_num = 4096 }
+};
+
+size_t rtems_ramdisk_configuration_size = RTEMS_ARRAY_SIZE(
+  rtems_ramdisk_configuration
+);
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_APPLICATION_EXTRA_DRIVERS RAMDISK_DRIVER_TABLE_ENTRY
+
+#define CONFIGURE_FILESYSTEM_DOSFS
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 8
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_UNIFIED_WORK_AREAS
+
+#define CONFIGURE_INIT_TASK_STACK_SIZE ( 16 * 1024 )
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
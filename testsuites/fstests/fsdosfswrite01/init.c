@@ -31,6 +31,8 @@
 
 #include "tmacros.h"
 #include <fcntl.h>
+#include <sys/ioctl.h>
+#include <sys/statvfs.h>
 #include <rtems/dosfs.h>
 #include <rtems/sparse-disk.h>
 #include <rtems/blkdev.h>
@@ -99,6 +101,18 @@ static void check_block_stats(
 
   rv = ioctl( fd, RTEMS_BLKIO_GETDEVSTATS, &actual_stats );
   rtems_test_assert( rv == 0 );
+
+  /*
+   * The lookup and replacement statistics depend on the configured lookup
+   * engine and replacement policy.
+   */
+  actual_stats.lookups = 0;
+  actual_stats.lookup_probes = 0;
+  actual_stats.recent_hits = 0;
+  actual_stats.frequent_hits = 0;
+  actual_stats.recent_evictions = 0;
+  actual_stats.frequent_evictions = 0;
+
   rtems_test_assert(
     memcmp( &actual_stats, expected_stats, sizeof( actual_stats ) ) == 0
   );
@@ -259,6 +273,412 @@ static void test_fat12_root_directory_write(
   rtems_test_assert( rv == 0 );
 }
 
+static fsblkcnt_t get_free_blocks( const char *mount_dir )
+{
+  struct statvfs sb;
+  int            rv;
+
+  rv = statvfs( mount_dir, &sb );
+  rtems_test_assert( rv == 0 );
+  rtems_test_assert( sb.f_bfree == sb.f_bavail );
+
+  return sb.f_bfree;
+}
+
+static void mount_with_free_cluster_bitmap(
+  const char *dev_name,
+  const char *mount_dir
+)
+{
+  rtems_dosfs_mount_options mount_opts;
+  int                       rv;
+
+  memset( &mount_opts, 0, sizeof( mount_opts ) );
+  mount_opts.free_cluster_bitmap = true;
+
+  rv = mount(
+    dev_name,
+    mount_dir,
+    RTEMS_FILESYSTEM_TYPE_DOSFS,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    &mount_opts
+  );
+  rtems_test_assert( rv == 0 );
+}
+
+static void write_clusters(
+  const char *file_name,
+  size_t      cluster_count
+)
+{
+  uint8_t cluster_buf[ SECTOR_SIZE * SECTORS_PER_CLUSTER ];
+  ssize_t num_bytes;
+  size_t  i;
+  int     fd;
+  int     rv;
+
+  memset( cluster_buf, 0xFE, sizeof( cluster_buf ) );
+
+  fd = open( file_name, O_WRONLY | O_CREAT | O_APPEND, S_IRWXU );
+  rtems_test_assert( fd >= 0 );
+
+  for ( i = 0; i < cluster_count; ++i ) {
+    num_bytes = write( fd, cluster_buf, sizeof( cluster_buf ) );
+    rtems_test_assert( num_bytes == (ssize_t) sizeof( cluster_buf ) );
+  }
+
+  rv = close( fd );
+  rtems_test_assert( rv == 0 );
+}
+
+static void test_free_cluster_bitmap(
+  const char *dev_name,
+  const char *mount_dir
+)
+{
+  static const char file_a[] = "/mnt/a.txt";
+  static const char file_b[] = "/mnt/b.txt";
+  static const char file_c[] = "/mnt/c.txt";
+
+  fsblkcnt_t free_blocks;
+  int        rv;
+
+  /* Create a fragmented free space without the bitmap */
+  format_and_mount( dev_name, mount_dir );
+  free_blocks = get_free_blocks( mount_dir );
+  write_clusters( file_a, 3 );
+  write_clusters( file_b, 5 );
+  write_clusters( file_a, 2 );
+  rtems_test_assert( get_free_blocks( mount_dir ) == free_blocks - 10 );
+
+  rv = unlink( file_b );
+  rtems_test_assert( rv == 0 );
+
+  rv = unmount( mount_dir );
+  rtems_test_assert( rv == 0 );
+
+  /* The bitmap must agree with the FAT scan */
+  mount_with_free_cluster_bitmap( dev_name, mount_dir );
+  rtems_test_assert( get_free_blocks( mount_dir ) == free_blocks - 5 );
+
+  /* Allocate the hole and clusters after it */
+  write_clusters( file_c, 8 );
+  rtems_test_assert( get_free_blocks( mount_dir ) == free_blocks - 13 );
+
+  rv = unlink( file_a );
+  rtems_test_assert( rv == 0 );
+  rtems_test_assert( get_free_blocks( mount_dir ) == free_blocks - 8 );
+
+  write_clusters( file_b, 4 );
+  rtems_test_assert( get_free_blocks( mount_dir ) == free_blocks - 12 );
+
+  rv = unmount( mount_dir );
+  rtems_test_assert( rv == 0 );
+
+  /* The FAT written with the bitmap must agree with a FAT scan */
+  rv = mount(
+    dev_name,
+    mount_dir,
+    RTEMS_FILESYSTEM_TYPE_DOSFS,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    NULL
+  );
+  rtems_test_assert( rv == 0 );
+  rtems_test_assert( get_free_blocks( mount_dir ) == free_blocks - 12 );
+
+  rv = unlink( file_b );
+  rtems_test_assert( rv == 0 );
+
+  rv = unlink( file_c );
+  rtems_test_assert( rv == 0 );
+  rtems_test_assert( get_free_blocks( mount_dir ) == free_blocks );
+
+  rv = unmount( mount_dir );
+  rtems_test_assert( rv == 0 );
+}
+
+static void check_fat_copies_are_equal( const char *dev_name )
+{
+  uint8_t  sector[ SECTOR_SIZE ];
+  uint8_t  copy[ SECTOR_SIZE ];
+  uint32_t reserved_sectors;
+  uint32_t fat_length;
+  uint32_t i;
+  ssize_t  n;
+  off_t    off;
+  int      fd;
+  int      rv;
+
+  fd = open( dev_name, O_RDONLY );
+  rtems_test_assert( fd >= 0 );
+
+  n = read( fd, sector, sizeof( sector ) );
+  rtems_test_assert( n == (ssize_t) sizeof( sector ) );
+
+  /* The FAT12 boot sector has exactly two FAT copies */
+  rtems_test_assert( sector[ 16 ] == 2 );
+  reserved_sectors = sector[ 14 ] | ( sector[ 15 ] << 8 );
+  fat_length = sector[ 22 ] | ( sector[ 23 ] << 8 );
+
+  for ( i = 0; i < fat_length; ++i ) {
+    off = lseek( fd, ( reserved_sectors + i ) * SECTOR_SIZE, SEEK_SET );
+    rtems_test_assert( off == ( reserved_sectors + i ) * SECTOR_SIZE );
+    n = read( fd, sector, sizeof( sector ) );
+    rtems_test_assert( n == (ssize_t) sizeof( sector ) );
+
+    off = lseek(
+      fd,
+      ( reserved_sectors + fat_length + i ) * SECTOR_SIZE,
+      SEEK_SET
+    );
+    rtems_test_assert(
+      off == ( reserved_sectors + fat_length + i ) * SECTOR_SIZE
+    );
+    n = read( fd, copy, sizeof( copy ) );
+    rtems_test_assert( n == (ssize_t) sizeof( copy ) );
+
+    rtems_test_assert( memcmp( sector, copy, sizeof( sector ) ) == 0 );
+  }
+
+  rv = close( fd );
+  rtems_test_assert( rv == 0 );
+}
+
+static void get_fat_cache_stats(
+  const char                  *mount_dir,
+  rtems_dosfs_fat_cache_stats *stats
+)
+{
+  int fd;
+  int rv;
+
+  fd = open( mount_dir, O_RDONLY );
+  rtems_test_assert( fd >= 0 );
+
+  rv = ioctl( fd, RTEMS_DOSFS_GET_FAT_CACHE_STATS, stats );
+  rtems_test_assert( rv == 0 );
+
+  rv = close( fd );
+  rtems_test_assert( rv == 0 );
+}
+
+static void test_fat_cache( const char *dev_name, const char *mount_dir )
+{
+  static const char file_a[] = "/mnt/a.txt";
+  static const char file_b[] = "/mnt/b.txt";
+
+  rtems_dosfs_mount_options   mount_opts;
+  rtems_dosfs_fat_cache_stats stats;
+  fsblkcnt_t                  free_blocks;
+  int                         rv;
+
+  format_and_mount( dev_name, mount_dir );
+  free_blocks = get_free_blocks( mount_dir );
+
+  get_fat_cache_stats( mount_dir, &stats );
+  rtems_test_assert( stats.sectors == 0 );
+  rtems_test_assert( stats.hits == 0 );
+  rtems_test_assert( stats.misses == 0 );
+  rtems_test_assert( stats.write_backs == 0 );
+
+  rv = unmount( mount_dir );
+  rtems_test_assert( rv == 0 );
+
+  memset( &mount_opts, 0, sizeof( mount_opts ) );
+  mount_opts.fat_cache_sectors = 2;
+
+  rv = mount(
+    dev_name,
+    mount_dir,
+    RTEMS_FILESYSTEM_TYPE_DOSFS,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    &mount_opts
+  );
+  rtems_test_assert( rv == 0 );
+
+  /*
+   * Interleave the allocations of two files to get cluster chains which span
+   * more than one FAT sector.
+   */
+  write_clusters( file_a, 300 );
+  write_clusters( file_b, 300 );
+  write_clusters( file_a, 300 );
+  write_clusters( file_b, 300 );
+
+  get_fat_cache_stats( mount_dir, &stats );
+  rtems_test_assert( stats.sectors == 2 );
+  rtems_test_assert( stats.hits > stats.misses );
+  rtems_test_assert( stats.misses > 0 );
+
+  rv = unlink( file_a );
+  rtems_test_assert( rv == 0 );
+
+  rv = unmount( mount_dir );
+  rtems_test_assert( rv == 0 );
+
+  /* All modified FAT sectors must be written back to both FAT copies */
+  check_fat_copies_are_equal( dev_name );
+
+  rv = mount(
+    dev_name,
+    mount_dir,
+    RTEMS_FILESYSTEM_TYPE_DOSFS,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    NULL
+  );
+  rtems_test_assert( rv == 0 );
+  rtems_test_assert( get_free_blocks( mount_dir ) == free_blocks - 600 );
+
+  rv = unlink( file_b );
+  rtems_test_assert( rv == 0 );
+  rtems_test_assert( get_free_blocks( mount_dir ) == free_blocks );
+
+  rv = unmount( mount_dir );
+  rtems_test_assert( rv == 0 );
+}
+
+#define CLUSTER_SIZE ( SECTOR_SIZE * SECTORS_PER_CLUSTER )
+
+static void fill_cluster( uint8_t *cluster_buf, uint32_t file_cln )
+{
+  memset( cluster_buf, (int) ( file_cln & 0xff ), CLUSTER_SIZE );
+  memcpy( cluster_buf, &file_cln, sizeof( file_cln ) );
+}
+
+static void write_cluster_at( int fd, uint32_t file_cln )
+{
+  uint8_t cluster_buf[ CLUSTER_SIZE ];
+  ssize_t num_bytes;
+
+  fill_cluster( cluster_buf, file_cln );
+  num_bytes = pwrite(
+    fd,
+    cluster_buf,
+    sizeof( cluster_buf ),
+    (off_t) file_cln * CLUSTER_SIZE
+  );
+  rtems_test_assert( num_bytes == (ssize_t) sizeof( cluster_buf ) );
+}
+
+static void check_cluster_at( int fd, uint32_t file_cln )
+{
+  uint8_t cluster_buf[ CLUSTER_SIZE ];
+  uint8_t expected_buf[ CLUSTER_SIZE ];
+  ssize_t num_bytes;
+
+  fill_cluster( expected_buf, file_cln );
+  num_bytes = pread(
+    fd,
+    cluster_buf,
+    sizeof( cluster_buf ),
+    (off_t) file_cln * CLUSTER_SIZE
+  );
+  rtems_test_assert( num_bytes == (ssize_t) sizeof( cluster_buf ) );
+  rtems_test_assert(
+    memcmp( cluster_buf, expected_buf, sizeof( cluster_buf ) ) == 0
+  );
+}
+
+static void test_extent_map( const char *dev_name, const char *mount_dir )
+{
+  static const char file_a[] = "/mnt/a.txt";
+  static const char file_b[] = "/mnt/b.txt";
+
+  uint8_t  cluster_buf[ CLUSTER_SIZE ];
+  uint8_t  zero_buf[ CLUSTER_SIZE ];
+  uint32_t i;
+  ssize_t  num_bytes;
+  int      fd;
+  int      rv;
+
+  format_and_mount( dev_name, mount_dir );
+
+  /* Create a file with a clusters chain of four extents */
+  fd = open( file_a, O_RDWR | O_CREAT, S_IRWXU );
+  rtems_test_assert( fd >= 0 );
+
+  for ( i = 0; i < 20; ++i ) {
+    write_cluster_at( fd, i );
+
+    if ( i % 5 == 4 ) {
+      write_clusters( file_b, 3 );
+    }
+  }
+
+  rv = close( fd );
+  rtems_test_assert( rv == 0 );
+
+  /* Random access through a fresh descriptor */
+  fd = open( file_a, O_RDWR );
+  rtems_test_assert( fd >= 0 );
+
+  for ( i = 0; i < 20; ++i ) {
+    check_cluster_at( fd, ( i * 7 ) % 20 );
+  }
+
+  /* Truncate in the middle of the third extent */
+  rv = ftruncate( fd, 11 * CLUSTER_SIZE + 100 );
+  rtems_test_assert( rv == 0 );
+
+  num_bytes = pread(
+    fd,
+    cluster_buf,
+    sizeof( cluster_buf ),
+    11 * CLUSTER_SIZE
+  );
+  rtems_test_assert( num_bytes == 100 );
+
+  num_bytes = pread(
+    fd,
+    cluster_buf,
+    sizeof( cluster_buf ),
+    12 * CLUSTER_SIZE
+  );
+  rtems_test_assert( num_bytes == 0 );
+
+  for ( i = 0; i < 11; ++i ) {
+    check_cluster_at( fd, 10 - i );
+  }
+
+  /* Extend the file with a hole and new clusters */
+  write_clusters( file_b, 1 );
+  write_cluster_at( fd, 30 );
+
+  memset( zero_buf, 0, sizeof( zero_buf ) );
+
+  for ( i = 12; i < 30; ++i ) {
+    num_bytes = pread(
+      fd,
+      cluster_buf,
+      sizeof( cluster_buf ),
+      (off_t) i * CLUSTER_SIZE
+    );
+    rtems_test_assert( num_bytes == (ssize_t) sizeof( cluster_buf ) );
+    rtems_test_assert(
+      memcmp( cluster_buf, zero_buf, sizeof( cluster_buf ) ) == 0
+    );
+  }
+
+  check_cluster_at( fd, 30 );
+  check_cluster_at( fd, 5 );
+  check_cluster_at( fd, 10 );
+
+  /* Overwrite clusters in place */
+  for ( i = 0; i < 31; i += 3 ) {
+    write_cluster_at( fd, i );
+  }
+
+  for ( i = 0; i < 31; i += 3 ) {
+    check_cluster_at( fd, i );
+  }
+
+  rv = close( fd );
+  rtems_test_assert( rv == 0 );
+
+  rv = unmount( mount_dir );
+  rtems_test_assert( rv == 0 );
+}
+
 static void test( void )
 {
   static const char dev_name[] = "/dev/sda";
@@ -285,6 +705,12 @@ static void test( void )
 
   test_normal_file_write( dev_name, mount_dir, file_name );
 
+  test_free_cluster_bitmap( dev_name, mount_dir );
+
+  test_fat_cache( dev_name, mount_dir );
+
+  test_extent_map( dev_name, mount_dir );
+
   rv = unlink( dev_name );
   rtems_test_assert( rv == 0 );
 }
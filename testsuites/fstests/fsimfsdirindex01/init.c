@@ -0,0 +1,332 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/stat.h>
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems.h>
+
+const char rtems_test_name[] = "FSIMFSDIRINDEX 1";
+
+#define MAX_ENTRIES 2048
+
+#define LOOKUP_ROUNDS 4
+
+static const size_t directory_sizes[] = { 8, 64, 512, MAX_ENTRIES };
+
+static void make_name( char *name, size_t size, size_t i )
+{
+  int n;
+
+  n = snprintf( name, size, "entry-%05zu", i );
+  rtems_test_assert( n > 0 && (size_t) n < size );
+}
+
+static void create_entries( const char *dir, size_t begin, size_t end )
+{
+  char   path[ 64 ];
+  size_t i;
+
+  for ( i = begin; i < end; ++i ) {
+    int fd;
+    int rv;
+    int n;
+
+    n = snprintf( path, sizeof( path ), "%s/entry-%05zu", dir, i );
+    rtems_test_assert( n > 0 && (size_t) n < sizeof( path ) );
+
+    fd = creat( path, S_IRWXU );
+    rtems_test_assert( fd >= 0 );
+
+    rv = close( fd );
+    rtems_test_assert( rv == 0 );
+  }
+}
+
+static void check_readdir_order( const char *dir, size_t count )
+{
+  char           name[ 32 ];
+  DIR           *dirp;
+  struct dirent *dire;
+  size_t         i;
+  int            rv;
+
+  dirp = opendir( dir );
+  rtems_test_assert( dirp != NULL );
+
+  i = 0;
+
+  while ( ( dire = readdir( dirp ) ) != NULL ) {
+    if ( strcmp( dire->d_name, "." ) == 0 ) {
+      continue;
+    }
+
+    if ( strcmp( dire->d_name, ".." ) == 0 ) {
+      continue;
+    }
+
+    make_name( name, sizeof( name ), i );
+    rtems_test_assert( strcmp( dire->d_name, name ) == 0 );
+    ++i;
+  }
+
+  rtems_test_assert( i == count );
+
+  rv = closedir( dirp );
+  rtems_test_assert( rv == 0 );
+}
+
+static void benchmark_lookups( size_t count )
+{
+  char     name[ 32 ];
+  uint64_t begin;
+  uint64_t duration;
+  size_t   round;
+  size_t   i;
+  int      rv;
+
+  rv = chdir( "/dir" );
+  rtems_test_assert( rv == 0 );
+
+  begin = rtems_clock_get_uptime_nanoseconds();
+
+  for ( round = 0; round < LOOKUP_ROUNDS; ++round ) {
+    for ( i = 0; i < count; ++i ) {
+      struct stat st;
+
+      make_name( name, sizeof( name ), i );
+      rv = stat( name, &st );
+      rtems_test_assert( rv == 0 );
+    }
+  }
+
+  duration = rtems_clock_get_uptime_nanoseconds() - begin;
+
+  printf(
+    "lookup in directory with %4zu entries: %" PRIu64 "ns\n",
+    count,
+    duration / ( LOOKUP_ROUNDS * count )
+  );
+
+  rv = chdir( "/" );
+  rtems_test_assert( rv == 0 );
+}
+
+static void test_repeated_rename( size_t count )
+{
+  char        name[ 32 ];
+  char        current[ 32 ];
+  char        next[ 32 ];
+  struct stat st;
+  size_t      i;
+  int         rv;
+
+  rv = chdir( "/dir" );
+  rtems_test_assert( rv == 0 );
+
+  /*
+   * Rename the same node many times, so that each rename removes a node with
+   * a name stored by a previous rename from the index.  Use different name
+   * lengths to get different hash values.
+   */
+  make_name( current, sizeof( current ), 1 );
+
+  for ( i = 0; i < 64; ++i ) {
+    rv = snprintf( next, sizeof( next ), "r%0*zu", (int) ( i % 8 ) + 1, i );
+    rtems_test_assert( rv > 0 && (size_t) rv < sizeof( next ) );
+
+    rv = rename( current, next );
+    rtems_test_assert( rv == 0 );
+
+    errno = 0;
+    rv = stat( current, &st );
+    rtems_test_assert( rv == -1 );
+    rtems_test_assert( errno == ENOENT );
+
+    rv = stat( next, &st );
+    rtems_test_assert( rv == 0 );
+
+    strcpy( current, next );
+  }
+
+  make_name( name, sizeof( name ), 1 );
+  rv = rename( current, name );
+  rtems_test_assert( rv == 0 );
+
+  errno = 0;
+  rv = stat( current, &st );
+  rtems_test_assert( rv == -1 );
+  rtems_test_assert( errno == ENOENT );
+
+  for ( i = 0; i < count; ++i ) {
+    make_name( name, sizeof( name ), i );
+    rv = stat( name, &st );
+    rtems_test_assert( rv == 0 );
+  }
+
+  rv = chdir( "/" );
+  rtems_test_assert( rv == 0 );
+}
+
+static void test_rename_and_unlink( size_t count )
+{
+  char        name[ 32 ];
+  char        other[ 32 ];
+  struct stat st;
+  size_t      i;
+  int         rv;
+
+  rv = mkdir( "/other", S_IRWXU );
+  rtems_test_assert( rv == 0 );
+
+  rv = chdir( "/dir" );
+  rtems_test_assert( rv == 0 );
+
+  /* Rename within the directory */
+  rv = rename( "entry-00000", "renamed" );
+  rtems_test_assert( rv == 0 );
+
+  errno = 0;
+  rv = stat( "entry-00000", &st );
+  rtems_test_assert( rv == -1 );
+  rtems_test_assert( errno == ENOENT );
+
+  rv = stat( "renamed", &st );
+  rtems_test_assert( rv == 0 );
+
+  rv = rename( "renamed", "entry-00000" );
+  rtems_test_assert( rv == 0 );
+
+  /* Move every second entry to another directory */
+  for ( i = 0; i < count; i += 2 ) {
+    make_name( name, sizeof( name ), i );
+    rv = snprintf( other, sizeof( other ), "/other/%s", name );
+    rtems_test_assert( rv > 0 && (size_t) rv < sizeof( other ) );
+    rv = rename( name, other );
+    rtems_test_assert( rv == 0 );
+  }
+
+  for ( i = 0; i < count; ++i ) {
+    make_name( name, sizeof( name ), i );
+    errno = 0;
+    rv = stat( name, &st );
+
+    if ( i % 2 == 0 ) {
+      rtems_test_assert( rv == -1 );
+      rtems_test_assert( errno == ENOENT );
+      rv = snprintf( other, sizeof( other ), "/other/%s", name );
+      rtems_test_assert( rv > 0 && (size_t) rv < sizeof( other ) );
+      rv = stat( other, &st );
+      rtems_test_assert( rv == 0 );
+    } else {
+      rtems_test_assert( rv == 0 );
+    }
+  }
+
+  /* Remove all entries, the index is discarded on the way */
+  for ( i = 0; i < count; ++i ) {
+    make_name( name, sizeof( name ), i );
+
+    if ( i % 2 == 0 ) {
+      rv = snprintf( other, sizeof( other ), "/other/%s", name );
+      rtems_test_assert( rv > 0 && (size_t) rv < sizeof( other ) );
+      rv = unlink( other );
+    } else {
+      rv = unlink( name );
+    }
+
+    rtems_test_assert( rv == 0 );
+  }
+
+  check_readdir_order( "/dir", 0 );
+  check_readdir_order( "/other", 0 );
+
+  rv = chdir( "/" );
+  rtems_test_assert( rv == 0 );
+
+  rv = rmdir( "/other" );
+  rtems_test_assert( rv == 0 );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  size_t count;
+  size_t i;
+  int    rv;
+
+  (void) arg;
+
+  TEST_BEGIN();
+
+  rv = mkdir( "/dir", S_IRWXU );
+  rtems_test_assert( rv == 0 );
+
+  count = 0;
+
+  for ( i = 0; i < RTEMS_ARRAY_SIZE( directory_sizes ); ++i ) {
+    create_entries( "/dir", count, directory_sizes[ i ] );
+    count = directory_sizes[ i ];
+    check_readdir_order( "/dir", count );
+    benchmark_lookups( count );
+  }
+
+  test_repeated_rename( count );
+  test_rename_and_unlink( count );
+
+  rv = rmdir( "/dir" );
+  rtems_test_assert( rv == 0 );
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 4
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,370 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/param.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/malloc.h>
+
+const char rtems_test_name[] = "FSIMFSEXTFILE 1";
+
+#define LARGE_SIZE ( 256 * 1024 + 123 )
+
+static unsigned char pattern( size_t i )
+{
+  return (unsigned char) ( ( i * 7 ) ^ ( i >> 8 ) );
+}
+
+static void check_size( int fd, off_t size )
+{
+  struct stat st;
+  int         rv;
+
+  rv = fstat( fd, &st );
+  rtems_test_assert( rv == 0 );
+  rtems_test_assert( st.st_size == size );
+}
+
+static void check_zero( int fd, off_t offset, size_t count )
+{
+  unsigned char buf[ 64 ];
+  ssize_t       n;
+  size_t        i;
+
+  rtems_test_assert( count <= sizeof( buf ) );
+
+  n = pread( fd, buf, count, offset );
+  rtems_test_assert( n == (ssize_t) count );
+
+  for ( i = 0; i < count; ++i ) {
+    rtems_test_assert( buf[ i ] == 0 );
+  }
+}
+
+static void test_large_buffers( const char *file )
+{
+  unsigned char *out;
+  unsigned char *in;
+  ssize_t        n;
+  size_t         i;
+  int            fd;
+  int            rv;
+
+  out = malloc( LARGE_SIZE );
+  rtems_test_assert( out != NULL );
+
+  in = malloc( LARGE_SIZE );
+  rtems_test_assert( in != NULL );
+
+  for ( i = 0; i < LARGE_SIZE; ++i ) {
+    out[ i ] = pattern( i );
+  }
+
+  fd = open( file, O_RDWR | O_CREAT | O_TRUNC, S_IRWXU );
+  rtems_test_assert( fd >= 0 );
+
+  /* Write in pieces which cross the extent boundaries */
+  for ( i = 0; i < LARGE_SIZE; i += (size_t) n ) {
+    n = write( fd, &out[ i ], MIN( 1000, LARGE_SIZE - i ) );
+    rtems_test_assert( n > 0 );
+  }
+
+  check_size( fd, LARGE_SIZE );
+
+  n = pread( fd, in, LARGE_SIZE, 0 );
+  rtems_test_assert( n == LARGE_SIZE );
+  rtems_test_assert( memcmp( in, out, LARGE_SIZE ) == 0 );
+
+  /* Overwrite in one large write and read in pieces */
+  for ( i = 0; i < LARGE_SIZE; ++i ) {
+    out[ i ] = (unsigned char) ~out[ i ];
+  }
+
+  n = pwrite( fd, out, LARGE_SIZE, 0 );
+  rtems_test_assert( n == LARGE_SIZE );
+
+  for ( i = 0; i < LARGE_SIZE; i += (size_t) n ) {
+    n = pread( fd, &in[ i ], 777, (off_t) i );
+    rtems_test_assert( n > 0 );
+  }
+
+  rtems_test_assert( memcmp( in, out, LARGE_SIZE ) == 0 );
+
+  n = pread( fd, in, 1, LARGE_SIZE );
+  rtems_test_assert( n == 0 );
+
+  rv = close( fd );
+  rtems_test_assert( rv == 0 );
+
+  free( in );
+  free( out );
+}
+
+static void test_holes_and_truncate( const char *file )
+{
+  unsigned char buf[ 4 ];
+  ssize_t       n;
+  off_t         off;
+  int           fd;
+  int           rv;
+
+  fd = open( file, O_RDWR | O_TRUNC );
+  rtems_test_assert( fd >= 0 );
+  check_size( fd, 0 );
+
+  /* Write behind the end of file leaves a zero filled hole */
+  n = pwrite( fd, "abcd", 4, 5000 );
+  rtems_test_assert( n == 4 );
+  check_size( fd, 5004 );
+  check_zero( fd, 0, 64 );
+  check_zero( fd, 4936, 64 );
+
+  /* Shrink, then grow again, the stale data must not reappear */
+  rv = ftruncate( fd, 5001 );
+  rtems_test_assert( rv == 0 );
+  check_size( fd, 5001 );
+
+  rv = ftruncate( fd, 5004 );
+  rtems_test_assert( rv == 0 );
+  check_size( fd, 5004 );
+
+  n = pread( fd, buf, 4, 5000 );
+  rtems_test_assert( n == 4 );
+  rtems_test_assert( memcmp( buf, "a\0\0\0", 4 ) == 0 );
+
+  /* Write after a shrink leaves a zero filled hole */
+  rv = ftruncate( fd, 10 );
+  rtems_test_assert( rv == 0 );
+
+  n = pwrite( fd, "x", 1, 5002 );
+  rtems_test_assert( n == 1 );
+  check_zero( fd, 4990, 12 );
+
+  rv = ftruncate( fd, 0 );
+  rtems_test_assert( rv == 0 );
+  check_size( fd, 0 );
+
+  rv = close( fd );
+  rtems_test_assert( rv == 0 );
+
+  /* Append */
+  fd = open( file, O_WRONLY | O_APPEND );
+  rtems_test_assert( fd >= 0 );
+
+  n = write( fd, "ab", 2 );
+  rtems_test_assert( n == 2 );
+
+  off = lseek( fd, 0, SEEK_SET );
+  rtems_test_assert( off == 0 );
+
+  n = write( fd, "cd", 2 );
+  rtems_test_assert( n == 2 );
+  check_size( fd, 4 );
+
+  rv = close( fd );
+  rtems_test_assert( rv == 0 );
+
+  fd = open( file, O_RDONLY );
+  rtems_test_assert( fd >= 0 );
+
+  n = read( fd, buf, sizeof( buf ) );
+  rtems_test_assert( n == 4 );
+  rtems_test_assert( memcmp( buf, "abcd", 4 ) == 0 );
+
+  rv = close( fd );
+  rtems_test_assert( rv == 0 );
+}
+
+static void test_mmap( const char *file )
+{
+  unsigned char *out;
+  unsigned char *p;
+  unsigned char *q;
+  ssize_t        n;
+  size_t         i;
+  int            fd;
+  int            rv;
+
+  out = malloc( LARGE_SIZE );
+  rtems_test_assert( out != NULL );
+
+  for ( i = 0; i < LARGE_SIZE; ++i ) {
+    out[ i ] = pattern( i );
+  }
+
+  fd = open( file, O_RDWR | O_CREAT | O_TRUNC, S_IRWXU );
+  rtems_test_assert( fd >= 0 );
+
+  for ( i = 0; i < LARGE_SIZE; i += (size_t) n ) {
+    n = write( fd, &out[ i ], MIN( 3000, LARGE_SIZE - i ) );
+    rtems_test_assert( n > 0 );
+  }
+
+  /* A range spanning several extents is made contiguous */
+  p = mmap( NULL, LARGE_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+  rtems_test_assert( p != MAP_FAILED );
+  rtems_test_assert( memcmp( p, out, LARGE_SIZE ) == 0 );
+
+  /* The mapping shares the file data */
+  q = mmap( NULL, 100, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 1000 );
+  rtems_test_assert( q == p + 1000 );
+
+  p[ 0 ] = 0xaa;
+  n = pread( fd, out, 1, 0 );
+  rtems_test_assert( n == 1 );
+  rtems_test_assert( out[ 0 ] == 0xaa );
+
+  n = pwrite( fd, "x", 1, 1 );
+  rtems_test_assert( n == 1 );
+  rtems_test_assert( p[ 1 ] == 'x' );
+
+  /* A truncate keeps the mapped data */
+  rv = ftruncate( fd, 0 );
+  rtems_test_assert( rv == 0 );
+  p[ LARGE_SIZE - 1 ] = 0;
+
+  rv = munmap( q, 100 );
+  rtems_test_assert( rv == 0 );
+
+  rv = munmap( p, LARGE_SIZE );
+  rtems_test_assert( rv == 0 );
+
+  rv = close( fd );
+  rtems_test_assert( rv == 0 );
+
+  free( out );
+}
+
+static uintptr_t get_free_size( void )
+{
+  Heap_Information_block info;
+
+  malloc_info( &info );
+
+  return info.Free.total;
+}
+
+static void test_mmap_after_unlink( void )
+{
+  const char    *file = "unlinked";
+  unsigned char *p;
+  unsigned char *q;
+  size_t         i;
+  uintptr_t      free_size;
+  int            fd;
+  int            rv;
+
+  fd = open( file, O_RDWR | O_CREAT | O_TRUNC, S_IRWXU );
+  rtems_test_assert( fd >= 0 );
+
+  rv = ftruncate( fd, LARGE_SIZE );
+  rtems_test_assert( rv == 0 );
+
+  p = mmap( NULL, LARGE_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+  rtems_test_assert( p != MAP_FAILED );
+
+  for ( i = 0; i < LARGE_SIZE; ++i ) {
+    p[ i ] = pattern( i );
+  }
+
+  rv = close( fd );
+  rtems_test_assert( rv == 0 );
+
+  rv = unlink( file );
+  rtems_test_assert( rv == 0 );
+
+  /*
+   * The mapping keeps the storage of the removed file.  Memory allocated
+   * after the removal shall not overlap with the mapping.
+   */
+  q = malloc( LARGE_SIZE );
+  rtems_test_assert( q != NULL );
+  memset( q, 0x55, LARGE_SIZE );
+  free( q );
+
+  for ( i = 0; i < LARGE_SIZE; ++i ) {
+    rtems_test_assert( p[ i ] == pattern( i ) );
+  }
+
+  free_size = get_free_size();
+
+  rv = munmap( p, LARGE_SIZE );
+  rtems_test_assert( rv == 0 );
+
+  /* The unmap released the file */
+  rtems_test_assert( get_free_size() >= free_size + LARGE_SIZE );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  const char *file = "file";
+  int         rv;
+
+  (void) arg;
+
+  TEST_BEGIN();
+
+  test_large_buffers( file );
+  test_holes_and_truncate( file );
+  test_mmap( file );
+  test_mmap_after_unlink();
+
+  rv = unlink( file );
+  rtems_test_assert( rv == 0 );
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 4
+
+#define CONFIGURE_IMFS_ENABLE_EXTENT_FILES
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,197 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/imfs.h>
+
+const char rtems_test_name[] = "FSIMFSMMAP 1";
+
+static const char image[] = "This is a linear file image linked into the "
+  "executable.  It is mapped without a copy.";
+
+static void test_linear_file( void )
+{
+  const char *file = "linear";
+  char       *p;
+  int         fd;
+  int         rv;
+
+  rv = IMFS_make_linearfile( file, S_IRWXU, image, sizeof( image ) );
+  rtems_test_assert( rv == 0 );
+
+  fd = open( file, O_RDONLY );
+  rtems_test_assert( fd >= 0 );
+
+  p = mmap( NULL, sizeof( image ), PROT_READ, MAP_SHARED, fd, 0 );
+  rtems_test_assert( p == image );
+
+  rv = munmap( p, sizeof( image ) );
+  rtems_test_assert( rv == 0 );
+
+  p = mmap( NULL, 10, PROT_READ, MAP_SHARED, fd, 8 );
+  rtems_test_assert( p == &image[ 8 ] );
+
+  rv = munmap( p, 10 );
+  rtems_test_assert( rv == 0 );
+
+  /* The image cannot be mapped for writing through a read-only descriptor */
+  errno = 0;
+  p = mmap( NULL, 10, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 8 );
+  rtems_test_assert( p == MAP_FAILED );
+  rtems_test_assert( errno == EACCES );
+
+  /* Private mappings still copy the data */
+  p = mmap( NULL, 10, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 8 );
+  rtems_test_assert( p != MAP_FAILED );
+  rtems_test_assert( p != &image[ 8 ] );
+  rtems_test_assert( memcmp( p, &image[ 8 ], 10 ) == 0 );
+
+  rv = munmap( p, 10 );
+  rtems_test_assert( rv == 0 );
+
+  errno = 0;
+  p = mmap( NULL, 1, PROT_READ, MAP_SHARED, fd, sizeof( image ) );
+  rtems_test_assert( p == MAP_FAILED );
+  rtems_test_assert( errno == EOVERFLOW );
+
+  rv = close( fd );
+  rtems_test_assert( rv == 0 );
+
+  rv = unlink( file );
+  rtems_test_assert( rv == 0 );
+}
+
+static void test_memory_file( void )
+{
+  const char *file = "memory";
+  char        buf[ 64 ];
+  char       *p;
+  ssize_t     n;
+  size_t      i;
+  int         fd;
+  int         rv;
+
+  memset( buf, 'a', sizeof( buf ) );
+
+  fd = open( file, O_RDWR | O_CREAT, S_IRWXU );
+  rtems_test_assert( fd >= 0 );
+
+  for ( i = 0; i < 2 * IMFS_MEMFILE_BYTES_PER_BLOCK; i += sizeof( buf ) ) {
+    n = write( fd, buf, sizeof( buf ) );
+    rtems_test_assert( n == (ssize_t) sizeof( buf ) );
+  }
+
+  /* A range within one block is mapped without a copy */
+  p = mmap( NULL, 16, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 16 );
+  rtems_test_assert( p != MAP_FAILED );
+
+  p[ 0 ] = 'b';
+  n = pread( fd, buf, 1, 16 );
+  rtems_test_assert( n == 1 );
+  rtems_test_assert( buf[ 0 ] == 'b' );
+
+  rv = munmap( p, 16 );
+  rtems_test_assert( rv == 0 );
+
+  /* A range which spans two blocks cannot be mapped without a copy */
+  errno = 0;
+  p = mmap(
+    NULL,
+    32,
+    PROT_READ | PROT_WRITE,
+    MAP_SHARED,
+    fd,
+    IMFS_MEMFILE_BYTES_PER_BLOCK - 16
+  );
+  rtems_test_assert( p == MAP_FAILED );
+  rtems_test_assert( errno == ENOTSUP );
+
+  rv = close( fd );
+  rtems_test_assert( rv == 0 );
+
+  fd = open( file, O_RDONLY );
+  rtems_test_assert( fd >= 0 );
+
+  /* A read-only descriptor provides only read-only mappings */
+  errno = 0;
+  p = mmap( NULL, 16, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 16 );
+  rtems_test_assert( p == MAP_FAILED );
+  rtems_test_assert( errno == EACCES );
+
+  p = mmap( NULL, 16, PROT_READ, MAP_SHARED, fd, 16 );
+  rtems_test_assert( p != MAP_FAILED );
+  rtems_test_assert( p[ 0 ] == 'b' );
+
+  rv = munmap( p, 16 );
+  rtems_test_assert( rv == 0 );
+
+  rv = close( fd );
+  rtems_test_assert( rv == 0 );
+
+  rv = unlink( file );
+  rtems_test_assert( rv == 0 );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  (void) arg;
+
+  TEST_BEGIN();
+
+  test_linear_file();
+  test_memory_file();
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 4
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
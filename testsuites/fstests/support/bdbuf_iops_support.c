@@ -0,0 +1,227 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "bdbuf_iops_support.h"
+#include "tmacros.h"
+
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/bdbuf.h>
+#include <rtems/blkdev.h>
+#include <rtems/ramdisk.h>
+
+#define ASSERT_SC( sc ) rtems_test_assert( ( sc ) == RTEMS_SUCCESSFUL )
+
+#define BLOCK_SIZE BDBUF_IOPS_BLOCK_SIZE
+
+#define BLOCK_COUNT BDBUF_IOPS_BLOCK_COUNT
+
+#define READER_COUNT BDBUF_IOPS_READER_COUNT
+
+#define MEASURE_TICKS 100
+
+typedef struct {
+  rtems_disk_device *dd;
+  volatile bool      done;
+  rtems_id           reader_ids[ READER_COUNT ];
+  volatile uint32_t  reads[ READER_COUNT ];
+} test_context;
+
+static test_context test_instance;
+
+static uint32_t next_block( uint32_t *seed )
+{
+  *seed = *seed * 1664525U + 1013904223U;
+
+  return ( *seed >> 8 ) % BLOCK_COUNT;
+}
+
+static void reader_task( rtems_task_argument arg )
+{
+  test_context *ctx = &test_instance;
+  uint32_t      seed = (uint32_t) arg + 1;
+
+  while ( !ctx->done ) {
+    rtems_status_code   sc;
+    rtems_bdbuf_buffer *bd;
+    uint32_t            block;
+    uint32_t            value;
+
+    block = next_block( &seed );
+    sc = rtems_bdbuf_read( ctx->dd, block, &bd );
+    ASSERT_SC( sc );
+
+    memcpy( &value, bd->buffer, sizeof( value ) );
+    rtems_test_assert( value == block );
+
+    sc = rtems_bdbuf_release( bd );
+    ASSERT_SC( sc );
+
+    ++ctx->reads[ arg ];
+  }
+
+  rtems_task_suspend( RTEMS_SELF );
+  rtems_test_assert( 0 );
+}
+
+static void fill_disk( test_context *ctx )
+{
+  rtems_status_code sc;
+  uint32_t          block;
+
+  for ( block = 0; block < BLOCK_COUNT; ++block ) {
+    rtems_bdbuf_buffer *bd;
+
+    sc = rtems_bdbuf_get( ctx->dd, block, &bd );
+    ASSERT_SC( sc );
+
+    memset( bd->buffer, 0, BLOCK_SIZE );
+    memcpy( bd->buffer, &block, sizeof( block ) );
+
+    sc = rtems_bdbuf_release_modified( bd );
+    ASSERT_SC( sc );
+  }
+
+  sc = rtems_bdbuf_syncdev( ctx->dd );
+  ASSERT_SC( sc );
+}
+
+static void measure( test_context *ctx, uint32_t reader_count )
+{
+  rtems_status_code  sc;
+  rtems_blkdev_stats stats;
+  uint32_t           i;
+  uint64_t           reads;
+  uint64_t           iops;
+
+  ctx->done = false;
+  rtems_bdbuf_reset_device_stats( ctx->dd );
+
+  for ( i = 0; i < reader_count; ++i ) {
+    ctx->reads[ i ] = 0;
+
+    sc = rtems_task_create(
+      rtems_build_name( 'R', 'E', 'A', 'D' ),
+      2,
+      RTEMS_MINIMUM_STACK_SIZE,
+      RTEMS_TIMESLICE,
+      RTEMS_DEFAULT_ATTRIBUTES,
+      &ctx->reader_ids[ i ]
+    );
+    ASSERT_SC( sc );
+
+    sc = rtems_task_start( ctx->reader_ids[ i ], reader_task, i );
+    ASSERT_SC( sc );
+  }
+
+  sc = rtems_task_wake_after( MEASURE_TICKS );
+  ASSERT_SC( sc );
+
+  ctx->done = true;
+  reads = 0;
+
+  for ( i = 0; i < reader_count; ++i ) {
+    /* Wait for the reader to finish its current read */
+    while (
+      rtems_task_is_suspended( ctx->reader_ids[ i ] ) !=
+      RTEMS_ALREADY_SUSPENDED
+    ) {
+      sc = rtems_task_wake_after( 1 );
+      ASSERT_SC( sc );
+    }
+
+    reads += ctx->reads[ i ];
+
+    sc = rtems_task_delete( ctx->reader_ids[ i ] );
+    ASSERT_SC( sc );
+  }
+
+  rtems_bdbuf_get_device_stats( ctx->dd, &stats );
+  rtems_test_assert( stats.read_hits + stats.read_misses == reads );
+
+  iops = ( reads * rtems_clock_get_ticks_per_second() ) / MEASURE_TICKS;
+
+  printf(
+    "shards %" PRIu32 ", readers %" PRIu32 ": reads %" PRIu64
+    ", misses %" PRIu32 ", aggregate read IOPS %" PRIu64 "\n",
+    rtems_bdbuf_configuration.shard_count,
+    reader_count,
+    reads,
+    stats.read_misses,
+    iops
+  );
+}
+
+static void test( test_context *ctx, uint32_t shard_count )
+{
+  int      fd;
+  int      rv;
+  uint32_t reader_count;
+
+  fd = open( "/dev/rda", O_RDWR );
+  rtems_test_assert( fd >= 0 );
+
+  rv = rtems_disk_fd_get_disk_device( fd, &ctx->dd );
+  rtems_test_assert( rv == 0 );
+
+  rtems_test_assert( rtems_bdbuf_configuration.shard_count == shard_count );
+
+  fill_disk( ctx );
+
+  printf(
+    "bdbuf shards %" PRIu32 ", processors %" PRIu32 "\n",
+    rtems_bdbuf_configuration.shard_count,
+    rtems_scheduler_get_processor_maximum()
+  );
+
+  for ( reader_count = 1; reader_count <= READER_COUNT; ++reader_count ) {
+    measure( ctx, reader_count );
+  }
+
+  rv = close( fd );
+  rtems_test_assert( rv == 0 );
+}
+
+void bdbuf_iops_test( uint32_t shard_count )
+{
+  test( &test_instance, shard_count );
+}
+
+rtems_ramdisk_config rtems_ramdisk_configuration[] = {
+  { .block_size = BLOCK_SIZE, .block_num = BLOCK_COUNT }
+};
+
+size_t rtems_ramdisk_configuration_size = 1;
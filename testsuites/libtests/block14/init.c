@@ -94,39 +94,40 @@ static const test_action actions[ ACTION_COUNT ] = {
   { 7, rtems_bdbuf_read, NULL, RTEMS_SUCCESSFUL, rtems_bdbuf_release },
 };
 
-#define STATS( a, b, c, d, e, f, g, h, i ) \
-  { .read_hits = a,                        \
-    .read_misses = b,                      \
-    .read_ahead_transfers = c,             \
-    .read_ahead_peeks = d,                 \
-    .read_blocks = e,                      \
-    .read_errors = f,                      \
-    .write_transfers = g,                  \
-    .write_blocks = h,                     \
-    .write_errors = i }
+#define STATS( a, b, c, d, e, f, g, h, i, j ) \
+  { .read_hits = a,                           \
+    .read_misses = b,                         \
+    .read_ahead_transfers = c,                \
+    .read_ahead_peeks = d,                    \
+    .read_blocks = e,                         \
+    .read_errors = f,                         \
+    .write_transfers = g,                     \
+    .write_blocks = h,                        \
+    .write_errors = i,                        \
+    .recent_hits = j }
 
 static const rtems_blkdev_stats expected_stats[ ACTION_COUNT ] = {
-  STATS( 0, 1, 0, 0, 1, 0, 0, 0, 0 ),
-  STATS( 0, 2, 1, 0, 3, 0, 0, 0, 0 ),
-  STATS( 1, 2, 2, 0, 4, 0, 0, 0, 0 ),
+  STATS( 0, 1, 0, 0, 1, 0, 0, 0, 0, 0 ),
+  STATS( 0, 2, 1, 0, 3, 0, 0, 0, 0, 0 ),
+  STATS( 1, 2, 2, 0, 4, 0, 0, 0, 0, 1 ),
 
-  STATS( 2, 2, 2, 0, 4, 0, 0, 0, 0 ),
+  STATS( 2, 2, 2, 0, 4, 0, 0, 0, 0, 2 ),
 
-  STATS( 2, 2, 2, 0, 4, 0, 1, 1, 0 ),
-  STATS( 2, 3, 2, 0, 5, 1, 1, 1, 0 ),
-  STATS( 2, 3, 2, 0, 5, 1, 2, 2, 1 ),
+  STATS( 2, 2, 2, 0, 4, 0, 1, 1, 0, 2 ),
+  STATS( 2, 3, 2, 0, 5, 1, 1, 1, 0, 2 ),
+  STATS( 2, 3, 2, 0, 5, 1, 2, 2, 1, 2 ),
 
-  STATS( 2, 4, 2, 0, 6, 1, 2, 2, 1 ),
-  STATS( 2, 4, 3, 1, 7, 1, 2, 2, 1 ),
-  STATS( 2, 5, 3, 1, 8, 1, 2, 2, 1 ),
-  STATS( 2, 6, 4, 1, 10, 1, 2, 2, 1 ),
-  STATS( 3, 6, 4, 1, 10, 1, 2, 2, 1 ),
+  STATS( 2, 4, 2, 0, 6, 1, 2, 2, 1, 2 ),
+  STATS( 2, 4, 3, 1, 7, 1, 2, 2, 1, 2 ),
+  STATS( 2, 5, 3, 1, 8, 1, 2, 2, 1, 2 ),
+  STATS( 2, 6, 4, 1, 10, 1, 2, 2, 1, 2 ),
+  STATS( 3, 6, 4, 1, 10, 1, 2, 2, 1, 3 ),
 
-  STATS( 3, 6, 5, 2, 11, 1, 2, 2, 1 ),
-  STATS( 4, 6, 5, 2, 11, 1, 2, 2, 1 ),
+  STATS( 3, 6, 5, 2, 11, 1, 2, 2, 1, 3 ),
+  STATS( 4, 6, 5, 2, 11, 1, 2, 2, 1, 4 ),
 
-  STATS( 4, 6, 6, 3, 12, 1, 2, 2, 1 ),
-  STATS( 4, 7, 6, 3, 13, 1, 2, 2, 1 ),
+  STATS( 4, 6, 6, 3, 12, 1, 2, 2, 1, 4 ),
+  STATS( 4, 7, 6, 3, 13, 1, 2, 2, 1, 4 ),
 };
 
 static const int expected_block_access_counts[ ACTION_COUNT ][ BLOCK_COUNT ] =
@@ -222,6 +223,15 @@ static void test_actions( rtems_disk_device *dd )
 
     rtems_bdbuf_get_device_stats( dd, &stats );
 
+    /*
+     * The lookup statistics depend on the configured lookup engine.
+     */
+    rtems_test_assert(
+      stats.lookups >= stats.read_hits + stats.read_misses
+    );
+    stats.lookups = 0;
+    stats.lookup_probes = 0;
+
     rtems_test_assert(
       memcmp( &stats, &expected_stats[ i ], sizeof( stats ) ) == 0
     );
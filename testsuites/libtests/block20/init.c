@@ -0,0 +1,426 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/bdbuf.h>
+
+const char rtems_test_name[] = "BLOCK 20";
+
+#define BLOCK_SIZE 16
+
+#define BLOCK_COUNT 8
+
+#define DIRECT_COUNT 4
+
+#define DISK_PATH "/disk"
+
+static uint8_t disk_data[ BLOCK_COUNT ][ BLOCK_SIZE ];
+
+static uint32_t request_count;
+
+static bool purge_on_read;
+
+static bool fail_write;
+
+static int test_disk_ioctl( rtems_disk_device *dd, uint32_t req, void *arg )
+{
+  int rv = 0;
+
+  if ( req == RTEMS_BLKIO_REQUEST ) {
+    rtems_blkdev_request   *breq = arg;
+    rtems_blkdev_sg_buffer *sg = breq->bufs;
+    uint32_t                i;
+
+    ++request_count;
+
+    /*
+     * Discard the buffers during the read.  This is what happens if the
+     * buffers are written to the device and recycled while the direct read is
+     * in progress.
+     */
+    if ( breq->req == RTEMS_BLKDEV_REQ_READ && purge_on_read ) {
+      purge_on_read = false;
+      rtems_bdbuf_purge_dev( dd );
+    }
+
+    if ( breq->req == RTEMS_BLKDEV_REQ_WRITE && fail_write ) {
+      fail_write = false;
+      rtems_blkdev_request_done( breq, RTEMS_IO_ERROR );
+      return 0;
+    }
+
+    for ( i = 0; i < breq->bufnum; ++i ) {
+      rtems_blkdev_bnum block = sg[ i ].block;
+
+      rtems_test_assert( block < BLOCK_COUNT );
+      rtems_test_assert( sg[ i ].length == BLOCK_SIZE );
+
+      if ( breq->req == RTEMS_BLKDEV_REQ_READ ) {
+        memcpy( sg[ i ].buffer, disk_data[ block ], BLOCK_SIZE );
+      } else {
+        memcpy( disk_data[ block ], sg[ i ].buffer, BLOCK_SIZE );
+      }
+    }
+
+    rtems_blkdev_request_done( breq, RTEMS_SUCCESSFUL );
+  } else {
+    rv = rtems_blkdev_ioctl( dd, req, arg );
+  }
+
+  return rv;
+}
+
+static void test_direct_write( rtems_disk_device *dd )
+{
+  rtems_status_code  sc;
+  rtems_blkdev_stats stats;
+  uint8_t            data[ DIRECT_COUNT ][ BLOCK_SIZE ];
+
+  memset( data, 0xa5, sizeof( data ) );
+  request_count = 0;
+
+  sc = rtems_bdbuf_write_direct( dd, 0, DIRECT_COUNT, data );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( request_count == 1 );
+  rtems_test_assert( memcmp( disk_data, data, sizeof( data ) ) == 0 );
+
+  rtems_bdbuf_get_device_stats( dd, &stats );
+  rtems_test_assert( stats.direct_transfers == 1 );
+  rtems_test_assert( stats.write_transfers == 1 );
+  rtems_test_assert( stats.write_blocks == DIRECT_COUNT );
+}
+
+static void test_direct_read( rtems_disk_device *dd )
+{
+  rtems_status_code  sc;
+  rtems_blkdev_stats stats;
+  uint8_t            data[ DIRECT_COUNT ][ BLOCK_SIZE ];
+
+  memset( disk_data[ 2 ], 0x5a, sizeof( disk_data[ 2 ] ) );
+  request_count = 0;
+
+  sc = rtems_bdbuf_read_direct( dd, 1, DIRECT_COUNT, data );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( request_count == 1 );
+  rtems_test_assert( memcmp( data, disk_data[ 1 ], sizeof( data ) ) == 0 );
+
+  rtems_bdbuf_get_device_stats( dd, &stats );
+  rtems_test_assert( stats.direct_transfers == 2 );
+  rtems_test_assert( stats.read_blocks == DIRECT_COUNT );
+  rtems_test_assert( stats.read_hits == 0 );
+  rtems_test_assert( stats.read_misses == 0 );
+}
+
+static void test_cached_block_update( rtems_disk_device *dd )
+{
+  rtems_status_code   sc;
+  rtems_bdbuf_buffer *bd;
+  uint8_t             data[ DIRECT_COUNT ][ BLOCK_SIZE ];
+
+  sc = rtems_bdbuf_read( dd, 1, &bd );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_bdbuf_release( bd );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  memset( data, 0x33, sizeof( data ) );
+
+  sc = rtems_bdbuf_write_direct( dd, 0, DIRECT_COUNT, data );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  request_count = 0;
+
+  sc = rtems_bdbuf_read( dd, 1, &bd );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( request_count == 0 );
+  rtems_test_assert( memcmp( bd->buffer, data[ 1 ], BLOCK_SIZE ) == 0 );
+
+  sc = rtems_bdbuf_release( bd );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void test_modified_block_read( rtems_disk_device *dd )
+{
+  rtems_status_code   sc;
+  rtems_bdbuf_buffer *bd;
+  uint8_t             data[ DIRECT_COUNT ][ BLOCK_SIZE ];
+
+  sc = rtems_bdbuf_get( dd, 6, &bd );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  memset( bd->buffer, 0x77, BLOCK_SIZE );
+
+  sc = rtems_bdbuf_release_modified( bd );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_bdbuf_read_direct( dd, 4, DIRECT_COUNT, data );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( memcmp( data[ 0 ], disk_data[ 4 ], BLOCK_SIZE ) == 0 );
+  rtems_test_assert( memcmp( data[ 1 ], disk_data[ 5 ], BLOCK_SIZE ) == 0 );
+  rtems_test_assert( data[ 2 ][ 0 ] == 0x77 );
+  rtems_test_assert( data[ 2 ][ BLOCK_SIZE - 1 ] == 0x77 );
+  rtems_test_assert( memcmp( data[ 3 ], disk_data[ 7 ], BLOCK_SIZE ) == 0 );
+
+  sc = rtems_bdbuf_syncdev( dd );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( disk_data[ 6 ][ 0 ] == 0x77 );
+}
+
+static void test_modified_block_write_back( rtems_disk_device *dd )
+{
+  rtems_status_code   sc;
+  rtems_bdbuf_buffer *bd;
+  uint8_t             data[ DIRECT_COUNT ][ BLOCK_SIZE ];
+
+  sc = rtems_bdbuf_get( dd, 5, &bd );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  memset( bd->buffer, 0x44, BLOCK_SIZE );
+
+  sc = rtems_bdbuf_release_modified( bd );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  request_count = 0;
+  purge_on_read = true;
+
+  sc = rtems_bdbuf_read_direct( dd, 4, DIRECT_COUNT, data );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( !purge_on_read );
+  rtems_test_assert( request_count == 2 );
+  rtems_test_assert( disk_data[ 5 ][ 0 ] == 0x44 );
+  rtems_test_assert( data[ 1 ][ 0 ] == 0x44 );
+  rtems_test_assert( data[ 1 ][ BLOCK_SIZE - 1 ] == 0x44 );
+  rtems_test_assert( memcmp( data, disk_data[ 4 ], sizeof( data ) ) == 0 );
+}
+
+static void test_modified_block_write( rtems_disk_device *dd )
+{
+  rtems_status_code   sc;
+  rtems_bdbuf_buffer *bd;
+  uint8_t             data[ DIRECT_COUNT ][ BLOCK_SIZE ];
+
+  sc = rtems_bdbuf_get( dd, 2, &bd );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  memset( bd->buffer, 0x11, BLOCK_SIZE );
+
+  sc = rtems_bdbuf_release_modified( bd );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  memset( data, 0x22, sizeof( data ) );
+
+  sc = rtems_bdbuf_write_direct( dd, 0, DIRECT_COUNT, data );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  /* The modified buffer shall not overwrite the new data */
+  sc = rtems_bdbuf_syncdev( dd );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( memcmp( disk_data, data, sizeof( data ) ) == 0 );
+}
+
+static void test_failed_write( rtems_disk_device *dd )
+{
+  rtems_status_code   sc;
+  rtems_bdbuf_buffer *bd;
+  uint8_t             data[ DIRECT_COUNT ][ BLOCK_SIZE ];
+
+  sc = rtems_bdbuf_read( dd, 1, &bd );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_bdbuf_release( bd );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  memset( data, 0x99, sizeof( data ) );
+  fail_write = true;
+
+  sc = rtems_bdbuf_write_direct( dd, 0, DIRECT_COUNT, data );
+  rtems_test_assert( sc == RTEMS_IO_ERROR );
+  rtems_test_assert( !fail_write );
+
+  /* The content of the block is unknown, so it shall be read again */
+  request_count = 0;
+
+  sc = rtems_bdbuf_read( dd, 1, &bd );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( request_count == 1 );
+  rtems_test_assert( memcmp( bd->buffer, disk_data[ 1 ], BLOCK_SIZE ) == 0 );
+
+  sc = rtems_bdbuf_release( bd );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void access_task( rtems_task_argument arg )
+{
+  rtems_disk_device  *dd = (rtems_disk_device *) arg;
+  rtems_status_code   sc;
+  rtems_bdbuf_buffer *bd;
+
+  sc = rtems_bdbuf_read( dd, 3, &bd );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  /* Let the direct write wait for the release of the buffer */
+  sc = rtems_task_wake_after( 2 );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  memset( bd->buffer, 0x66, BLOCK_SIZE );
+
+  sc = rtems_bdbuf_release_modified( bd );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  rtems_task_exit();
+}
+
+static void test_accessed_block_write( rtems_disk_device *dd )
+{
+  rtems_status_code sc;
+  rtems_id          id;
+  uint8_t           data[ DIRECT_COUNT ][ BLOCK_SIZE ];
+
+  sc = rtems_task_create(
+    rtems_build_name( 'A', 'C', 'C', 'S' ),
+    1,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &id
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_task_start( id, access_task, (rtems_task_argument) dd );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  memset( data, 0x55, sizeof( data ) );
+
+  sc = rtems_bdbuf_write_direct( dd, 0, DIRECT_COUNT, data );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  /*
+   * The buffer was modified before the transfer, so the new data shall not be
+   * overwritten by the buffer.
+   */
+  sc = rtems_bdbuf_syncdev( dd );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( memcmp( disk_data, data, sizeof( data ) ) == 0 );
+}
+
+static void test_invalid_blocks( rtems_disk_device *dd )
+{
+  rtems_status_code sc;
+  uint8_t           data[ DIRECT_COUNT ][ BLOCK_SIZE ];
+
+  sc = rtems_bdbuf_read_direct( dd, BLOCK_COUNT - 1, 2, data );
+  rtems_test_assert( sc == RTEMS_INVALID_ID );
+
+  sc = rtems_bdbuf_write_direct( dd, BLOCK_COUNT, 1, data );
+  rtems_test_assert( sc == RTEMS_INVALID_ID );
+}
+
+static void test( void )
+{
+  rtems_status_code  sc;
+  rtems_disk_device *dd;
+  int                fd;
+  int                rv;
+
+  sc = rtems_blkdev_create(
+    DISK_PATH,
+    BLOCK_SIZE,
+    BLOCK_COUNT,
+    test_disk_ioctl,
+    NULL
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  fd = open( DISK_PATH, O_RDWR );
+  rtems_test_assert( fd >= 0 );
+
+  rv = rtems_disk_fd_get_disk_device( fd, &dd );
+  rtems_test_assert( rv == 0 );
+
+  rv = close( fd );
+  rtems_test_assert( rv == 0 );
+
+  test_direct_write( dd );
+  test_direct_read( dd );
+  test_cached_block_update( dd );
+  test_modified_block_read( dd );
+  test_modified_block_write_back( dd );
+  test_modified_block_write( dd );
+  test_failed_write( dd );
+  test_accessed_block_write( dd );
+  test_invalid_blocks( dd );
+
+  rv = unlink( DISK_PATH );
+  rtems_test_assert( rv == 0 );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  (void) arg;
+
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 4
+
+#define CONFIGURE_BDBUF_BUFFER_MIN_SIZE       BLOCK_SIZE
+#define CONFIGURE_BDBUF_BUFFER_MAX_SIZE       BLOCK_SIZE
+#define CONFIGURE_BDBUF_CACHE_MEMORY_SIZE     ( BLOCK_SIZE * BLOCK_COUNT )
+#define CONFIGURE_BDBUF_MAX_READ_AHEAD_BLOCKS 0
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+#define CONFIGURE_INIT_TASK_PRIORITY      2
+#define CONFIGURE_INIT_TASK_ATTRIBUTES    RTEMS_FLOATING_POINT
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,210 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/bdbuf.h>
+
+const char rtems_test_name[] = "BLOCK 23";
+
+#define BLOCK_COUNT 256
+
+#define BUFFER_COUNT 16
+
+#define EVICT_BEGIN 128
+
+#define MAX_REQUESTS 16
+
+#define DISK_PATH "/disk"
+
+static uint32_t request_sizes[ MAX_REQUESTS ];
+
+static uint32_t request_count;
+
+static int test_disk_ioctl( rtems_disk_device *dd, uint32_t req, void *arg )
+{
+  int rv = 0;
+
+  if ( req == RTEMS_BLKIO_REQUEST ) {
+    rtems_blkdev_request *breq = arg;
+
+    rtems_test_assert( request_count < MAX_REQUESTS );
+    request_sizes[ request_count ] = breq->bufnum;
+    ++request_count;
+
+    rtems_blkdev_request_done( breq, RTEMS_SUCCESSFUL );
+  } else {
+    rv = rtems_blkdev_ioctl( dd, req, arg );
+  }
+
+  return rv;
+}
+
+static void read_block( rtems_disk_device *dd, rtems_blkdev_bnum block )
+{
+  rtems_status_code   sc;
+  rtems_bdbuf_buffer *bd;
+
+  sc = rtems_bdbuf_read( dd, block, &bd );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_bdbuf_release( bd );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void evict_all_buffers( rtems_disk_device *dd )
+{
+  rtems_bdbuf_buffer *bds[ BUFFER_COUNT ];
+  size_t              i;
+
+  /*
+   * Hold all buffers at the same time, so that each get recycles another
+   * cached block.  The get operation does not take part in the read-ahead.
+   */
+  for ( i = 0; i < BUFFER_COUNT; ++i ) {
+    rtems_status_code sc;
+
+    sc = rtems_bdbuf_get( dd, EVICT_BEGIN + i, &bds[ i ] );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  }
+
+  for ( i = 0; i < BUFFER_COUNT; ++i ) {
+    rtems_status_code sc;
+
+    sc = rtems_bdbuf_release( bds[ i ] );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  }
+}
+
+static void test_window_shrink( rtems_disk_device *dd )
+{
+  static const uint32_t expected_sizes[] = {
+    /* Ramp up: misses of blocks 0 and 1, windows of 2, 4 and 8 blocks */
+    1, 1, 2, 4, 8,
+    /* The blocks read ahead were recycled, blocks 7 to 12 miss */
+    1, 1, 1, 1, 1, 1,
+    /* The shrunk window restarts with 2 blocks instead of 8 blocks */
+    2
+  };
+  rtems_blkdev_stats stats;
+  rtems_blkdev_bnum  block;
+
+  for ( block = 0; block < 7; ++block ) {
+    read_block( dd, block );
+  }
+
+  rtems_test_assert( request_count == 5 );
+
+  evict_all_buffers( dd );
+
+  for ( block = 7; block <= 12; ++block ) {
+    read_block( dd, block );
+  }
+
+  rtems_test_assert( request_count == RTEMS_ARRAY_SIZE( expected_sizes ) );
+  rtems_test_assert(
+    memcmp( request_sizes, expected_sizes, sizeof( expected_sizes ) ) == 0
+  );
+
+  rtems_bdbuf_get_device_stats( dd, &stats );
+  rtems_test_assert( stats.read_misses == 8 );
+  rtems_test_assert( stats.read_hits == 5 );
+  rtems_test_assert( stats.read_ahead_transfers == 4 );
+}
+
+static void test( void )
+{
+  rtems_status_code  sc;
+  rtems_disk_device *dd;
+  int                fd;
+  int                rv;
+
+  sc = rtems_blkdev_create( DISK_PATH, 1, BLOCK_COUNT, test_disk_ioctl, NULL );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  fd = open( DISK_PATH, O_RDWR );
+  rtems_test_assert( fd >= 0 );
+
+  rv = rtems_disk_fd_get_disk_device( fd, &dd );
+  rtems_test_assert( rv == 0 );
+
+  rv = close( fd );
+  rtems_test_assert( rv == 0 );
+
+  test_window_shrink( dd );
+
+  rv = unlink( DISK_PATH );
+  rtems_test_assert( rv == 0 );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  (void) arg;
+
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 4
+
+#define CONFIGURE_BDBUF_BUFFER_MIN_SIZE          1
+#define CONFIGURE_BDBUF_BUFFER_MAX_SIZE          1
+#define CONFIGURE_BDBUF_CACHE_MEMORY_SIZE        BUFFER_COUNT
+#define CONFIGURE_BDBUF_MAX_READ_AHEAD_BLOCKS    8
+#define CONFIGURE_BDBUF_READ_AHEAD_TASK_PRIORITY 1
+#define CONFIGURE_BDBUF_READ_AHEAD_STREAMS       2
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+#define CONFIGURE_INIT_TASK_PRIORITY      2
+#define CONFIGURE_INIT_TASK_ATTRIBUTES    RTEMS_FLOATING_POINT
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,207 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <tmacros.h>
+#include <rtems/malloc.h>
+#include <rtems/score/protectedheap.h>
+#include <rtems/score/threaddispatch.h>
+
+const char rtems_test_name[] = "MALLOC 5";
+
+#define OBJECT_COUNT 4
+
+static void get_info( rtems_malloc_cache_information *info )
+{
+  rtems_status_code sc;
+
+  sc = rtems_malloc_cache_get_information(
+    rtems_scheduler_get_processor(),
+    info
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void test_invalid_parameters( void )
+{
+  rtems_malloc_cache_information info;
+  rtems_status_code              sc;
+
+  puts( "Invalid parameters" );
+
+  sc = rtems_malloc_cache_get_information( 0, NULL );
+  rtems_test_assert( sc == RTEMS_INVALID_ADDRESS );
+
+  sc = rtems_malloc_cache_get_information(
+    rtems_configuration_get_maximum_processors(),
+    &info
+  );
+  rtems_test_assert( sc == RTEMS_INVALID_NUMBER );
+}
+
+static void test_hit_and_miss( void )
+{
+  rtems_malloc_cache_information before;
+  rtems_malloc_cache_information after;
+  void                          *p;
+  void                          *q;
+  void                          *r;
+
+  puts( "Cache hit and miss" );
+
+  rtems_malloc_cache_flush();
+  get_info( &before );
+  rtems_test_assert( before.cached_objects == 0 );
+
+  p = malloc( 20 );
+  rtems_test_assert( p != NULL );
+  get_info( &after );
+  rtems_test_assert( after.misses == before.misses + 1 );
+  rtems_test_assert( after.hits == before.hits );
+  rtems_test_assert( after.cached_objects == OBJECT_COUNT / 2 - 1 );
+
+  q = malloc( 32 );
+  rtems_test_assert( q != NULL );
+  rtems_test_assert( q != p );
+  get_info( &after );
+  rtems_test_assert( after.misses == before.misses + 1 );
+  rtems_test_assert( after.hits == before.hits + 1 );
+  rtems_test_assert( after.cached_objects == 0 );
+
+  r = malloc( 4096 );
+  rtems_test_assert( r != NULL );
+  get_info( &after );
+  rtems_test_assert( after.misses == before.misses + 1 );
+  rtems_test_assert( after.hits == before.hits + 1 );
+
+  free( r );
+  free( q );
+  free( p );
+  get_info( &after );
+  rtems_test_assert( after.frees == before.frees + 2 );
+  rtems_test_assert( after.cached_objects == 2 );
+
+  p = malloc( 17 );
+  rtems_test_assert( p != NULL );
+  get_info( &after );
+  rtems_test_assert( after.hits == before.hits + 2 );
+  free( p );
+}
+
+static void test_flush( void )
+{
+  rtems_malloc_cache_information before;
+  rtems_malloc_cache_information after;
+  void                          *p[ OBJECT_COUNT + 1 ];
+  size_t                         i;
+
+  puts( "Flush full magazine" );
+
+  rtems_malloc_cache_flush();
+
+  for ( i = 0; i < RTEMS_ARRAY_SIZE( p ); ++i ) {
+    p[ i ] = malloc( 64 );
+    rtems_test_assert( p[ i ] != NULL );
+  }
+
+  get_info( &before );
+
+  for ( i = 0; i < RTEMS_ARRAY_SIZE( p ); ++i ) {
+    free( p[ i ] );
+  }
+
+  get_info( &after );
+  rtems_test_assert( after.frees == before.frees + OBJECT_COUNT + 1 );
+  rtems_test_assert( after.flushes == before.flushes + 1 );
+  rtems_test_assert(
+    after.cached_objects == before.cached_objects + OBJECT_COUNT / 2 + 1
+  );
+
+  rtems_malloc_cache_flush();
+  get_info( &after );
+  rtems_test_assert( after.cached_objects == 0 );
+  rtems_test_assert( _Protected_heap_Walk( RTEMS_Malloc_Heap, 0, false ) );
+}
+
+static void test_free_with_thread_dispatch_disabled( void )
+{
+  rtems_malloc_cache_information before;
+  rtems_malloc_cache_information after;
+  Per_CPU_Control               *cpu_self;
+  void                          *p;
+
+  puts( "Free with thread dispatching disabled" );
+
+  rtems_malloc_cache_flush();
+  p = malloc( 100 );
+  rtems_test_assert( p != NULL );
+  get_info( &before );
+
+  cpu_self = _Thread_Dispatch_disable();
+  free( p );
+  _Thread_Dispatch_enable( cpu_self );
+
+  get_info( &after );
+  rtems_test_assert( after.frees == before.frees + 1 );
+  rtems_test_assert( after.cached_objects == before.cached_objects + 1 );
+
+  rtems_malloc_cache_flush();
+  rtems_test_assert( _Protected_heap_Walk( RTEMS_Malloc_Heap, 0, false ) );
+}
+
+static rtems_task Init( rtems_task_argument argument )
+{
+  (void) argument;
+
+  TEST_BEGIN();
+
+  test_invalid_parameters();
+  test_hit_and_miss();
+  test_flush();
+  test_free_with_thread_dispatch_disabled();
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_MALLOC_PER_CPU_CACHE_OBJECTS OBJECT_COUNT
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,262 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/record.h>
+#include <rtems/recordserver.h>
+
+#include <rtems.h>
+#include <rtems/imfs.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/test.h>
+#include <rtems/test-info.h>
+
+#define CHECK_ITEM( item, expected_event, expected_data )                  \
+  do {                                                                     \
+    T_eq_u32( RTEMS_RECORD_GET_EVENT( ( item )->event ), expected_event ); \
+    T_eq_ulong( ( item )->data, expected_data );                           \
+  } while ( 0 )
+
+#define ITEM_COUNT 16
+
+#ifdef RTEMS_SMP
+#define CAPACITY ( ITEM_COUNT - 1 )
+#else
+#define CAPACITY ITEM_COUNT
+#endif
+
+static rtems_record_data next_produced;
+
+static rtems_record_item storage[ ITEM_COUNT + 2 ];
+
+#define STORAGE_COUNT rtems_record_get_item_count_for_fetch()
+
+static rtems_record_data next_consumed;
+
+static void produce( size_t count )
+{
+  size_t i;
+
+  for ( i = 0; i < count; ++i ) {
+    rtems_record_produce( RTEMS_RECORD_USER_0, next_produced );
+    ++next_produced;
+  }
+}
+
+T_TEST_CASE( RecordSink )
+{
+  rtems_record_item items[ 2 * ITEM_COUNT ];
+  const char       *file;
+  ssize_t           n;
+  int               fd;
+  int               rv;
+  size_t            i;
+
+  file = "/record";
+  fd = open( file, O_RDWR | O_CREAT | O_TRUNC, S_IRWXU );
+  T_assert_ge_int( fd, 0 );
+
+  /* Drain the initial events */
+  n = rtems_record_sink_drain( fd, storage, STORAGE_COUNT );
+  T_ge_ssz( n, (ssize_t) sizeof( items[ 0 ] ) );
+
+  rv = ftruncate( fd, 0 );
+  T_eq_int( rv, 0 );
+
+  next_consumed = next_produced;
+  produce( 5 );
+  n = rtems_record_sink_drain( fd, storage, STORAGE_COUNT );
+  T_eq_ssz( n, (ssize_t) ( 6 * sizeof( items[ 0 ] ) ) );
+
+  n = pread( fd, items, sizeof( items ), 0 );
+  T_eq_ssz( n, (ssize_t) ( 6 * sizeof( items[ 0 ] ) ) );
+  CHECK_ITEM( &items[ 0 ], RTEMS_RECORD_PROCESSOR, 0 );
+
+  for ( i = 1; i < 6; ++i ) {
+    CHECK_ITEM( &items[ i ], RTEMS_RECORD_USER_0, next_consumed );
+    ++next_consumed;
+  }
+
+  /* No items are available */
+  n = rtems_record_sink_drain( fd, storage, STORAGE_COUNT );
+  T_eq_ssz( n, (ssize_t) sizeof( items[ 0 ] ) );
+
+  rv = close( fd );
+  T_eq_int( rv, 0 );
+
+  /* Write errors are reported */
+  n = rtems_record_sink_drain( fd, storage, STORAGE_COUNT );
+  T_eq_ssz( n, -1 );
+
+  rv = unlink( file );
+  T_eq_int( rv, 0 );
+}
+
+typedef struct {
+  size_t            produce_during_write;
+  size_t            size;
+  rtems_record_item items[ 2 * ITEM_COUNT ];
+} wrap_context;
+
+static ssize_t wrap_write(
+  rtems_libio_t *iop,
+  const void    *buffer,
+  size_t         count
+)
+{
+  wrap_context *ctx;
+
+  ctx = IMFS_generic_get_context_by_iop( iop );
+
+  /* Let the producers wrap around the record buffer during the write */
+  produce( ctx->produce_during_write );
+  ctx->produce_during_write = 0;
+
+  T_quiet_le_sz( ctx->size + count, sizeof( ctx->items ) );
+  memcpy( (char *) ctx->items + ctx->size, buffer, count );
+  ctx->size += count;
+
+  return (ssize_t) count;
+}
+
+static const rtems_filesystem_file_handlers_r wrap_handlers = {
+  .open_h = rtems_filesystem_default_open,
+  .close_h = rtems_filesystem_default_close,
+  .write_h = wrap_write,
+  .fstat_h = rtems_filesystem_default_fstat,
+  .fcntl_h = rtems_filesystem_default_fcntl
+};
+
+static const IMFS_node_control wrap_node_control = {
+  .handlers = &wrap_handlers,
+  .node_initialize = IMFS_node_initialize_generic,
+  .node_remove = IMFS_node_remove_default,
+  .node_destroy = IMFS_node_destroy_default
+};
+
+T_TEST_CASE( RecordSinkWrapDuringWrite )
+{
+  wrap_context ctx;
+  const char  *file;
+  ssize_t      n;
+  int          fd;
+  int          rv;
+  size_t       i;
+
+  memset( &ctx, 0, sizeof( ctx ) );
+  file = "/wrap";
+  rv = IMFS_make_generic_node(
+    file,
+    S_IFCHR | S_IRWXU,
+    &wrap_node_control,
+    &ctx
+  );
+  T_assert_eq_int( rv, 0 );
+
+  fd = open( file, O_WRONLY );
+  T_assert_ge_int( fd, 0 );
+
+  /* Drain the events of the previous test cases */
+  n = rtems_record_sink_drain( fd, storage, STORAGE_COUNT );
+  T_ge_ssz( n, (ssize_t) sizeof( ctx.items[ 0 ] ) );
+
+  /*
+   * The record buffer wraps around while the items are written.  The written
+   * items shall be the ones available at the time of the call.
+   */
+  ctx.size = 0;
+  ctx.produce_during_write = CAPACITY + 2;
+  next_consumed = next_produced;
+  produce( ITEM_COUNT / 2 );
+  n = rtems_record_sink_drain( fd, storage, STORAGE_COUNT );
+  T_eq_ssz(
+    n,
+    (ssize_t) ( ( ITEM_COUNT / 2 + 1 ) * sizeof( ctx.items[ 0 ] ) )
+  );
+  T_eq_sz( ctx.size, (size_t) n );
+  CHECK_ITEM( &ctx.items[ 0 ], RTEMS_RECORD_PROCESSOR, 0 );
+
+  for ( i = 1; i <= ITEM_COUNT / 2; ++i ) {
+    CHECK_ITEM( &ctx.items[ i ], RTEMS_RECORD_USER_0, next_consumed );
+    ++next_consumed;
+  }
+
+  /* The items lost during the write are reported by the next drain */
+  ctx.size = 0;
+  n = rtems_record_sink_drain( fd, storage, STORAGE_COUNT );
+  T_eq_ssz( n, (ssize_t) ( ( CAPACITY + 2 ) * sizeof( ctx.items[ 0 ] ) ) );
+  T_eq_sz( ctx.size, (size_t) n );
+  CHECK_ITEM( &ctx.items[ 0 ], RTEMS_RECORD_PROCESSOR, 0 );
+  CHECK_ITEM( &ctx.items[ 1 ], RTEMS_RECORD_PER_CPU_OVERFLOW, 2 );
+  next_consumed += 2;
+
+  for ( i = 2; i < CAPACITY + 2; ++i ) {
+    CHECK_ITEM( &ctx.items[ i ], RTEMS_RECORD_USER_0, next_consumed );
+    ++next_consumed;
+  }
+
+  T_eq_ulong( next_consumed, next_produced );
+
+  rv = close( fd );
+  T_eq_int( rv, 0 );
+
+  rv = unlink( file );
+  T_eq_int( rv, 0 );
+}
+
+const char rtems_test_name[] = "RECORD 5";
+
+static void Init( rtems_task_argument argument )
+{
+  rtems_test_run( argument, TEST_STATE );
+}
+
+#define CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 4
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_MAXIMUM_PROCESSORS 1
+
+#define CONFIGURE_RECORD_PER_PROCESSOR_ITEMS ITEM_COUNT
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
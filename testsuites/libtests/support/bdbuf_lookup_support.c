@@ -0,0 +1,226 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "bdbuf_lookup_support.h"
+#include "tmacros.h"
+
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/bdbuf.h>
+
+#define BLOCK_SIZE BDBUF_LOOKUP_BLOCK_SIZE
+
+#define BUFFER_COUNT BDBUF_LOOKUP_BUFFER_COUNT
+
+#define BLOCK_COUNT ( 2 * BUFFER_COUNT )
+
+#define DISK_PATH "/disk"
+
+/*
+ * This is the minimum total depth of a binary search tree with BUFFER_COUNT
+ * nodes.  Each hit in the AVL tree visits at least the nodes on the path to the
+ * node of the block.
+ */
+#define AVL_MIN_HIT_PROBES 328
+
+static bool is_avl_tree( void )
+{
+  return rtems_bdbuf_configuration.lookup_engine ==
+    RTEMS_BDBUF_LOOKUP_AVL_TREE;
+}
+
+static const char *engine_name( void )
+{
+  if ( is_avl_tree() ) {
+    return "avl-tree";
+  }
+
+  return "hash-index";
+}
+
+static int test_disk_ioctl( rtems_disk_device *dd, uint32_t req, void *arg )
+{
+  int rv = 0;
+
+  if ( req == RTEMS_BLKIO_REQUEST ) {
+    rtems_blkdev_request   *breq = arg;
+    rtems_blkdev_sg_buffer *sg = breq->bufs;
+    uint32_t                i;
+
+    rtems_test_assert( breq->req == RTEMS_BLKDEV_REQ_READ );
+
+    for ( i = 0; i < breq->bufnum; ++i ) {
+      rtems_test_assert( sg[ i ].block < BLOCK_COUNT );
+      memset( sg[ i ].buffer, 0, sg[ i ].length );
+      memcpy( sg[ i ].buffer, &sg[ i ].block, sizeof( sg[ i ].block ) );
+    }
+
+    rtems_blkdev_request_done( breq, RTEMS_SUCCESSFUL );
+  } else {
+    rv = rtems_blkdev_ioctl( dd, req, arg );
+  }
+
+  return rv;
+}
+
+static void read_blocks(
+  rtems_disk_device *dd,
+  rtems_blkdev_bnum  begin,
+  rtems_blkdev_bnum  end
+)
+{
+  rtems_blkdev_bnum block;
+
+  for ( block = begin; block < end; ++block ) {
+    rtems_status_code   sc;
+    rtems_bdbuf_buffer *bd;
+    rtems_blkdev_bnum   value;
+
+    sc = rtems_bdbuf_read( dd, block, &bd );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+    memcpy( &value, bd->buffer, sizeof( value ) );
+    rtems_test_assert( value == block );
+
+    sc = rtems_bdbuf_release( bd );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  }
+}
+
+static void run_phase(
+  rtems_disk_device *dd,
+  const char        *name,
+  rtems_blkdev_bnum  begin,
+  rtems_blkdev_bnum  end,
+  uint32_t           expected_hits,
+  uint32_t           expected_evictions,
+  rtems_blkdev_stats *stats
+)
+{
+  uint32_t accesses = end - begin;
+
+  rtems_bdbuf_reset_device_stats( dd );
+  read_blocks( dd, begin, end );
+  rtems_bdbuf_get_device_stats( dd, stats );
+
+  rtems_test_assert( stats->read_hits == expected_hits );
+  rtems_test_assert( stats->read_misses == accesses - expected_hits );
+  rtems_test_assert( stats->recent_evictions == expected_evictions );
+  rtems_test_assert( stats->lookups == accesses );
+  rtems_test_assert( stats->lookup_probes >= expected_hits );
+
+  printf(
+    "%s: %s: lookups %" PRIu32 ", probes %" PRIu32 ", hits %" PRIu32
+    ", evictions %" PRIu32 "\n",
+    engine_name(),
+    name,
+    stats->lookups,
+    stats->lookup_probes,
+    stats->read_hits,
+    stats->recent_evictions
+  );
+}
+
+void bdbuf_lookup_test( void )
+{
+  rtems_status_code  sc;
+  rtems_disk_device *dd;
+  rtems_blkdev_stats stats;
+  int                fd;
+  int                rv;
+
+  sc = rtems_blkdev_create(
+    DISK_PATH,
+    BLOCK_SIZE,
+    BLOCK_COUNT,
+    test_disk_ioctl,
+    NULL
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  fd = open( DISK_PATH, O_RDWR );
+  rtems_test_assert( fd >= 0 );
+
+  rv = rtems_disk_fd_get_disk_device( fd, &dd );
+  rtems_test_assert( rv == 0 );
+
+  rv = close( fd );
+  rtems_test_assert( rv == 0 );
+
+  /* Fill the cache */
+  run_phase( dd, "fill", 0, BUFFER_COUNT, 0, 0, &stats );
+
+  /* Hit each cached block once */
+  run_phase( dd, "hit", 0, BUFFER_COUNT, BUFFER_COUNT, 0, &stats );
+
+  if ( is_avl_tree() ) {
+    rtems_test_assert( stats.lookup_probes >= AVL_MIN_HIT_PROBES );
+  } else {
+    /*
+     * The index has at least twice as many slots as buffers, so the probe
+     * sequences are short.  This is far less than the minimum of the AVL
+     * tree.
+     */
+    rtems_test_assert( stats.lookup_probes < AVL_MIN_HIT_PROBES );
+  }
+
+  /* Evict all cached blocks */
+  run_phase(
+    dd,
+    "evict",
+    BUFFER_COUNT,
+    BLOCK_COUNT,
+    0,
+    BUFFER_COUNT,
+    &stats
+  );
+
+  /* The blocks which replaced the evicted blocks are found */
+  run_phase(
+    dd,
+    "rehit",
+    BUFFER_COUNT,
+    BLOCK_COUNT,
+    BUFFER_COUNT,
+    0,
+    &stats
+  );
+
+  /* The evicted blocks are no longer found */
+  run_phase( dd, "miss", 0, BUFFER_COUNT, 0, BUFFER_COUNT, &stats );
+
+  rv = unlink( DISK_PATH );
+  rtems_test_assert( rv == 0 );
+}
@@ -0,0 +1,52 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef LIBTESTS_BDBUF_LOOKUP_SUPPORT_H
+#define LIBTESTS_BDBUF_LOOKUP_SUPPORT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define BDBUF_LOOKUP_BLOCK_SIZE 512
+
+#define BDBUF_LOOKUP_BUFFER_COUNT 64
+
+/*
+ * Fills, hits, evicts and misses the buffers of a test disk and checks the
+ * lookup statistics against the configured lookup engine.  The cache shall be
+ * configured with BDBUF_LOOKUP_BUFFER_COUNT buffers of
+ * BDBUF_LOOKUP_BLOCK_SIZE bytes and without read
+ * ahead.
+ */
+void bdbuf_lookup_test( void );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LIBTESTS_BDBUF_LOOKUP_SUPPORT_H */
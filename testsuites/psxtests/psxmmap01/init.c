@@ -135,7 +135,7 @@ static void mmap_bad_arguments( void )
 
   rtems_test_assert( ( pagesize = getpagesize() ) > 0 );
   rtems_test_assert(
-    ( devfd = open( &test_driver_name[ 0 ], O_RDONLY ) ) >= 0
+    ( devfd = open( &test_driver_name[ 0 ], O_RDWR ) ) >= 0
   );
   rtems_test_assert(
     ( shmfd = shm_open( "/shm", O_CREAT | O_RDWR, 0644 ) ) >= 0
@@ -171,14 +171,14 @@ static void mmap_bad_arguments( void )
     "simple /dev/zero shared"
   );
   /*
-    * Repeat with no write protection. Will fail because of unimplemented
-    * mmap handler in /dev/zero.
+    * Repeat with no write protection. Will fail because the descriptor is
+    * read-only.
     */
   checked_mmap(
     PROT_READ | PROT_WRITE,
     MAP_SHARED,
     zerofd,
-    ENOTSUP,
+    EACCES,
     "simple /dev/zero shared"
   );
   /* RTEMS /dev/zero is a character device so this will fail */
@@ -286,16 +286,12 @@ static void mmap_bad_arguments( void )
     "MAP_ANON with fd != -1"
   );
 
-  /*
-   * Writable MAP_SHARED should fail on read-only descriptors. Will fail
-   * on RTEMS because of unimplemented mmap handler in /dev/null and the fact
-   * that there is no read only protection.
-   */
+  /* Writable MAP_SHARED should fail on read-only descriptors. */
   checked_mmap(
     PROT_READ | PROT_WRITE,
     MAP_SHARED,
     zerofd,
-    ENOTSUP,
+    EACCES,
     "MAP_SHARED of read-only /dev/zero"
   );
 
@@ -0,0 +1,578 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <errno.h>
+#include <fcntl.h>
+#include <mqueue.h>
+#include <string.h>
+#include <time.h>
+
+#include <rtems.h>
+#include <rtems/posix/mqueue.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "PSXMSGQ 5";
+
+#define MAXIMUM_PENDING 4
+
+#define MESSAGE_SIZE 8
+
+#define BATCH_SIZE 8
+
+#define WORKER_COUNT 2
+
+#define PRIO_WORKER 1
+
+#define PRIO_INIT 2
+
+typedef struct {
+  mqd_t        mq;
+  rtems_id     workers[ WORKER_COUNT ];
+  ssize_t      results[ WORKER_COUNT ];
+  int          errors[ WORKER_COUNT ];
+  size_t       sizes[ WORKER_COUNT ][ BATCH_SIZE ];
+  unsigned int prios[ WORKER_COUNT ][ BATCH_SIZE ];
+  char         buffers[ WORKER_COUNT ][ BATCH_SIZE * MESSAGE_SIZE ];
+} test_context;
+
+static test_context test_instance;
+
+static const char too_large[] = "123456789";
+
+static void check_messages(
+  const char         *buffer,
+  const size_t       *sizes,
+  const unsigned int *prios,
+  size_t              count,
+  const char *const  *expected,
+  unsigned int        expected_prio
+)
+{
+  size_t i;
+
+  for ( i = 0; i < count; ++i ) {
+    size_t size;
+
+    size = strlen( expected[ i ] );
+    rtems_test_assert( sizes[ i ] == size );
+    rtems_test_assert( prios[ i ] == expected_prio );
+    rtems_test_assert( memcmp( buffer, expected[ i ], size ) == 0 );
+    buffer += size;
+  }
+}
+
+static ssize_t send_batch(
+  mqd_t                  mq,
+  const char *const     *messages,
+  size_t                 count,
+  unsigned int           prio,
+  const struct timespec *abstime,
+  int                    expected_error
+)
+{
+  char    buffer[ BATCH_SIZE * sizeof( too_large ) ];
+  size_t  sizes[ BATCH_SIZE ];
+  size_t  offset;
+  size_t  i;
+  ssize_t n;
+
+  rtems_test_assert( count <= BATCH_SIZE );
+  offset = 0;
+
+  for ( i = 0; i < count; ++i ) {
+    sizes[ i ] = strlen( messages[ i ] );
+    memcpy( &buffer[ offset ], messages[ i ], sizes[ i ] );
+    offset += sizes[ i ];
+  }
+
+  errno = 0;
+  n = mq_send_multiple_np( mq, buffer, sizes, count, prio, abstime );
+
+  if ( expected_error != 0 ) {
+    rtems_test_assert( n == -1 );
+    rtems_test_assert( errno == expected_error );
+  } else {
+    rtems_test_assert( n > 0 );
+  }
+
+  return n;
+}
+
+static ssize_t receive_batch(
+  mqd_t                  mq,
+  size_t                 count,
+  const struct timespec *abstime,
+  int                    expected_error,
+  const char *const     *expected,
+  unsigned int           expected_prio
+)
+{
+  char         buffer[ BATCH_SIZE * MESSAGE_SIZE ];
+  size_t       sizes[ BATCH_SIZE ];
+  unsigned int prios[ BATCH_SIZE ];
+  ssize_t      n;
+
+  rtems_test_assert( count <= BATCH_SIZE );
+
+  errno = 0;
+  n = mq_receive_multiple_np(
+    mq,
+    buffer,
+    sizeof( buffer ),
+    sizes,
+    prios,
+    count,
+    abstime
+  );
+
+  if ( expected_error != 0 ) {
+    rtems_test_assert( n == -1 );
+    rtems_test_assert( errno == expected_error );
+  } else {
+    rtems_test_assert( n > 0 );
+    check_messages( buffer, sizes, prios, (size_t) n, expected, expected_prio );
+  }
+
+  return n;
+}
+
+static long get_pending( mqd_t mq )
+{
+  struct mq_attr attr;
+  int            rv;
+
+  rv = mq_getattr( mq, &attr );
+  rtems_test_assert( rv == 0 );
+
+  return attr.mq_curmsgs;
+}
+
+static void set_nonblock( mqd_t mq, bool nonblock )
+{
+  struct mq_attr attr;
+  int            rv;
+
+  memset( &attr, 0, sizeof( attr ) );
+  attr.mq_flags = O_RDWR | ( nonblock ? O_NONBLOCK : 0 );
+  rv = mq_setattr( mq, &attr, NULL );
+  rtems_test_assert( rv == 0 );
+}
+
+static void get_timeout( struct timespec *abstime )
+{
+  int rv;
+
+  rv = clock_gettime( CLOCK_REALTIME, abstime );
+  rtems_test_assert( rv == 0 );
+
+  abstime->tv_nsec += 20000000;
+
+  if ( abstime->tv_nsec >= 1000000000 ) {
+    abstime->tv_nsec -= 1000000000;
+    ++abstime->tv_sec;
+  }
+}
+
+static void receiver_task( rtems_task_argument arg )
+{
+  test_context *ctx;
+  size_t        i;
+
+  ctx = &test_instance;
+  i = (size_t) arg;
+
+  while ( true ) {
+    rtems_status_code sc;
+
+    errno = 0;
+    ctx->results[ i ] = mq_receive_multiple_np(
+      ctx->mq,
+      ctx->buffers[ i ],
+      sizeof( ctx->buffers[ i ] ),
+      ctx->sizes[ i ],
+      ctx->prios[ i ],
+      BATCH_SIZE,
+      NULL
+    );
+    ctx->errors[ i ] = errno;
+
+    sc = rtems_task_suspend( RTEMS_SELF );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  }
+}
+
+static void sender_task( rtems_task_argument arg )
+{
+  static const char *const messages[] = { "w" };
+  test_context            *ctx;
+  size_t                   i;
+
+  ctx = &test_instance;
+  i = (size_t) arg;
+
+  while ( true ) {
+    rtems_status_code sc;
+
+    ctx->sizes[ i ][ 0 ] = strlen( messages[ 0 ] );
+    errno = 0;
+    ctx->results[ i ] = mq_send_multiple_np(
+      ctx->mq,
+      messages[ 0 ],
+      ctx->sizes[ i ],
+      1,
+      1,
+      NULL
+    );
+    ctx->errors[ i ] = errno;
+
+    sc = rtems_task_suspend( RTEMS_SELF );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  }
+}
+
+static void start_worker(
+  test_context    *ctx,
+  size_t           i,
+  rtems_task_entry entry
+)
+{
+  rtems_status_code sc;
+
+  ctx->results[ i ] = 0;
+  ctx->errors[ i ] = 0;
+
+  sc = rtems_task_create(
+    rtems_build_name( 'W', 'O', 'R', 'K' ),
+    PRIO_WORKER,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &ctx->workers[ i ]
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  /* The worker blocks on the message queue */
+  sc = rtems_task_start( ctx->workers[ i ], entry, i );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void delete_worker( test_context *ctx, size_t i )
+{
+  rtems_status_code sc;
+
+  sc = rtems_task_delete( ctx->workers[ i ] );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void test_invalid_arguments( test_context *ctx )
+{
+  static const char *const messages[] = { "a" };
+  static const char *const invalid_size[] = { too_large };
+  struct mq_attr           attr;
+  char                     buffer[ MESSAGE_SIZE ];
+  size_t                   sizes[ 1 ];
+  unsigned int             prios[ 1 ];
+  mqd_t                    mq;
+  ssize_t                  n;
+  int                      rv;
+
+  sizes[ 0 ] = 1;
+
+  errno = 0;
+  n = mq_send_multiple_np( ctx->mq, "a", sizes, 0, 0, NULL );
+  rtems_test_assert( n == -1 );
+  rtems_test_assert( errno == EINVAL );
+
+  send_batch( ctx->mq, messages, 1, MQ_PRIO_MAX + 1, NULL, EINVAL );
+  send_batch( (mqd_t) -1, messages, 1, 0, NULL, EBADF );
+
+  /* The first message is too large */
+  send_batch( ctx->mq, invalid_size, 1, 0, NULL, EMSGSIZE );
+  rtems_test_assert( get_pending( ctx->mq ) == 0 );
+
+  errno = 0;
+  n = mq_receive_multiple_np(
+    ctx->mq,
+    buffer,
+    sizeof( buffer ),
+    sizes,
+    prios,
+    0,
+    NULL
+  );
+  rtems_test_assert( n == -1 );
+  rtems_test_assert( errno == EINVAL );
+
+  /* The buffer shall be able to store at least one message */
+  errno = 0;
+  n = mq_receive_multiple_np(
+    ctx->mq,
+    buffer,
+    sizeof( buffer ) - 1,
+    sizes,
+    prios,
+    1,
+    NULL
+  );
+  rtems_test_assert( n == -1 );
+  rtems_test_assert( errno == EMSGSIZE );
+
+  receive_batch( (mqd_t) -1, 1, NULL, EBADF, NULL, 0 );
+
+  /* The access mode of the queue is checked */
+  memset( &attr, 0, sizeof( attr ) );
+  attr.mq_maxmsg = 1;
+  attr.mq_msgsize = MESSAGE_SIZE;
+  mq = mq_open( "/rdonly", O_CREAT | O_RDONLY | O_NONBLOCK, 0666, &attr );
+  rtems_test_assert( mq != (mqd_t) -1 );
+
+  send_batch( mq, messages, 1, 0, NULL, EBADF );
+
+  rv = mq_close( mq );
+  rtems_test_assert( rv == 0 );
+
+  rv = mq_unlink( "/rdonly" );
+  rtems_test_assert( rv == 0 );
+
+  mq = mq_open( "/wronly", O_CREAT | O_WRONLY | O_NONBLOCK, 0666, &attr );
+  rtems_test_assert( mq != (mqd_t) -1 );
+
+  receive_batch( mq, 1, NULL, EBADF, NULL, 0 );
+
+  rv = mq_close( mq );
+  rtems_test_assert( rv == 0 );
+
+  rv = mq_unlink( "/wronly" );
+  rtems_test_assert( rv == 0 );
+}
+
+static void test_partial_batches( test_context *ctx )
+{
+  static const char *const invalid_size[] = { "a", too_large, "b" };
+  static const char *const too_many[] = { "bb", "ccc", "dddd", "eeeee" };
+  static const char *const full[] = { "f" };
+  static const char *const first[] = { "a", "bb" };
+  static const char *const second[] = { "ccc", "dddd" };
+  static const char *const low[] = { "low" };
+  static const char *const high[] = { "high" };
+  char                     buffer[ 2 * MESSAGE_SIZE ];
+  size_t                   sizes[ BATCH_SIZE ];
+  unsigned int             prios[ BATCH_SIZE ];
+  ssize_t                  n;
+
+  set_nonblock( ctx->mq, true );
+
+  /* A batch stops at a message which is too large */
+  n = send_batch( ctx->mq, invalid_size, 3, 1, NULL, 0 );
+  rtems_test_assert( n == 1 );
+
+  /* A batch stops if no message buffer is available */
+  n = send_batch( ctx->mq, too_many, 4, 1, NULL, 0 );
+  rtems_test_assert( n == MAXIMUM_PENDING - 1 );
+  rtems_test_assert( get_pending( ctx->mq ) == MAXIMUM_PENDING );
+
+  /* No message can be sent */
+  send_batch( ctx->mq, full, 1, 1, NULL, EAGAIN );
+
+  /* A batch receive takes at most the requested count of messages */
+  n = receive_batch( ctx->mq, 2, NULL, 0, first, 1 );
+  rtems_test_assert( n == 2 );
+
+  /* A batch receive takes at most the messages which fit into the buffer */
+  n = mq_receive_multiple_np(
+    ctx->mq,
+    buffer,
+    sizeof( buffer ),
+    sizes,
+    prios,
+    BATCH_SIZE,
+    NULL
+  );
+  rtems_test_assert( n == 2 );
+  check_messages( buffer, sizes, prios, 2, second, 1 );
+
+  receive_batch( ctx->mq, BATCH_SIZE, NULL, EAGAIN, NULL, 0 );
+
+  /* Messages are received in priority order */
+  n = send_batch( ctx->mq, low, 1, 1, NULL, 0 );
+  rtems_test_assert( n == 1 );
+
+  n = send_batch( ctx->mq, high, 1, 2, NULL, 0 );
+  rtems_test_assert( n == 1 );
+
+  n = receive_batch( ctx->mq, 1, NULL, 0, high, 2 );
+  rtems_test_assert( n == 1 );
+
+  n = receive_batch( ctx->mq, BATCH_SIZE, NULL, 0, low, 1 );
+  rtems_test_assert( n == 1 );
+
+  set_nonblock( ctx->mq, false );
+}
+
+static void test_timeouts( test_context *ctx )
+{
+  static const char *const messages[] = { "a", "b", "c", "d", "e" };
+  static const char *const more[] = { "f" };
+  struct timespec          abstime;
+  ssize_t                  n;
+
+  get_timeout( &abstime );
+  receive_batch( ctx->mq, BATCH_SIZE, &abstime, ETIMEDOUT, NULL, 0 );
+
+  n = send_batch( ctx->mq, messages, 5, 1, NULL, 0 );
+  rtems_test_assert( n == MAXIMUM_PENDING );
+
+  get_timeout( &abstime );
+  send_batch( ctx->mq, more, 1, 1, &abstime, ETIMEDOUT );
+
+  n = receive_batch( ctx->mq, BATCH_SIZE, NULL, 0, messages, 1 );
+  rtems_test_assert( n == MAXIMUM_PENDING );
+}
+
+static void test_waiting_receivers( test_context *ctx )
+{
+  static const char *const messages[] = { "a", "bb", "ccc" };
+  size_t                   i;
+  ssize_t                  n;
+
+  for ( i = 0; i < WORKER_COUNT; ++i ) {
+    start_worker( ctx, i, receiver_task );
+  }
+
+  /*
+   * Each waiting receiver gets one message of the batch directly, the rest of
+   * the batch is queued up.
+   */
+  n = send_batch( ctx->mq, messages, 3, 1, NULL, 0 );
+  rtems_test_assert( n == 3 );
+
+  for ( i = 0; i < WORKER_COUNT; ++i ) {
+    rtems_test_assert( ctx->results[ i ] == 1 );
+    check_messages(
+      ctx->buffers[ i ],
+      ctx->sizes[ i ],
+      ctx->prios[ i ],
+      1,
+      &messages[ i ],
+      1
+    );
+    delete_worker( ctx, i );
+  }
+
+  rtems_test_assert( get_pending( ctx->mq ) == 1 );
+  n = receive_batch( ctx->mq, BATCH_SIZE, NULL, 0, &messages[ 2 ], 1 );
+  rtems_test_assert( n == 1 );
+}
+
+static void test_blocked_senders( test_context *ctx )
+{
+  static const char *const messages[] = { "a", "b", "c", "d" };
+  static const char *const rest[] = { "c", "d", "w" };
+  ssize_t                  n;
+
+  n = send_batch( ctx->mq, messages, 4, 1, NULL, 0 );
+  rtems_test_assert( n == MAXIMUM_PENDING );
+
+  /* The sender blocks since the queue is full */
+  start_worker( ctx, 0, sender_task );
+  rtems_test_assert( ctx->results[ 0 ] == 0 );
+
+  /*
+   * The first message buffer freed by the batch receive is handed over to the
+   * blocked sender.
+   */
+  n = receive_batch( ctx->mq, 2, NULL, 0, messages, 1 );
+  rtems_test_assert( n == 2 );
+  rtems_test_assert( ctx->results[ 0 ] == 1 );
+  delete_worker( ctx, 0 );
+
+  rtems_test_assert( get_pending( ctx->mq ) == 3 );
+  n = receive_batch( ctx->mq, BATCH_SIZE, NULL, 0, rest, 1 );
+  rtems_test_assert( n == 3 );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  test_context  *ctx;
+  struct mq_attr attr;
+  int            rv;
+
+  (void) arg;
+
+  TEST_BEGIN();
+
+  ctx = &test_instance;
+
+  memset( &attr, 0, sizeof( attr ) );
+  attr.mq_maxmsg = MAXIMUM_PENDING;
+  attr.mq_msgsize = MESSAGE_SIZE;
+  ctx->mq = mq_open( "/mq", O_CREAT | O_RDWR, 0666, &attr );
+  rtems_test_assert( ctx->mq != (mqd_t) -1 );
+
+  test_invalid_arguments( ctx );
+  test_partial_batches( ctx );
+  test_timeouts( ctx );
+  test_waiting_receivers( ctx );
+  test_blocked_senders( ctx );
+
+  rv = mq_close( ctx->mq );
+  rtems_test_assert( rv == 0 );
+
+  rv = mq_unlink( "/mq" );
+  rtems_test_assert( rv == 0 );
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS ( 1 + WORKER_COUNT )
+
+#define CONFIGURE_MAXIMUM_POSIX_MESSAGE_QUEUES 2
+
+#define CONFIGURE_MESSAGE_BUFFER_MEMORY \
+  ( CONFIGURE_MESSAGE_BUFFERS_FOR_QUEUE( MAXIMUM_PENDING, MESSAGE_SIZE ) \
+    + CONFIGURE_MESSAGE_BUFFERS_FOR_QUEUE( 1, MESSAGE_SIZE ) )
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_INIT_TASK_PRIORITY PRIO_INIT
+
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -31,6 +31,7 @@
 
 #include <rtems/score/smplock.h>
 #include <rtems/score/smplockmcs.h>
+#include <rtems/score/smplockqueued.h>
 #include <rtems/score/smplockseq.h>
 #include <rtems/test-info.h>
 #include <rtems.h>
@@ -43,7 +44,13 @@ const char rtems_test_name[] = "SMPLOCK 1";
 
 #define CPU_COUNT 32
 
-#define TEST_COUNT 13
+#define TEST_COUNT 16
+
+#if defined( RTEMS_SMP_QUEUED_LOCK )
+#define SMP_LOCK_TYPE "Queued Lock"
+#else
+#define SMP_LOCK_TYPE "Ticket Lock"
+#endif
 
 typedef struct {
   rtems_test_parallel_context base;
@@ -56,6 +63,10 @@ typedef struct {
   SMP_MCS_lock_Control mcs_lock RTEMS_ALIGNED( CPU_CACHE_LINE_BYTES );
 #if defined( RTEMS_PROFILING )
   SMP_lock_Stats mcs_stats;
+#endif
+  SMP_queued_lock_Control queued_lock RTEMS_ALIGNED( CPU_CACHE_LINE_BYTES );
+#if defined( RTEMS_PROFILING )
+  SMP_lock_Stats queued_stats;
 #endif
   SMP_sequence_lock_Control seq_lock RTEMS_ALIGNED( CPU_CACHE_LINE_BYTES );
   int a                              RTEMS_ALIGNED( CPU_CACHE_LINE_BYTES );
@@ -63,12 +74,14 @@ typedef struct {
 } test_context;
 
 static test_context test_instance = {
-  .lock = SMP_LOCK_INITIALIZER( "global ticket" ),
+  .lock = SMP_LOCK_INITIALIZER( "global" ),
 #if defined( RTEMS_PROFILING )
   .mcs_stats = SMP_LOCK_STATS_INITIALIZER( "global MCS" ),
+  .queued_stats = SMP_LOCK_STATS_INITIALIZER( "global queued" ),
 #endif
   .flag = ATOMIC_INITIALIZER_UINT( 0 ),
   .mcs_lock = SMP_MCS_LOCK_INITIALIZER,
+  .queued_lock = SMP_QUEUED_LOCK_INITIALIZER,
   .seq_lock = SMP_SEQUENCE_LOCK_INITIALIZER
 };
 
@@ -188,7 +201,7 @@ static void test_0_fini(
 
   test_context *ctx = (test_context *) base;
 
-  test_fini( ctx, "Ticket Lock", true, "local counter", 0, active_workers );
+  test_fini( ctx, SMP_LOCK_TYPE, true, "local counter", 0, active_workers );
 }
 
 static void test_1_body(
@@ -261,7 +274,7 @@ static void test_2_fini(
 
   test_context *ctx = (test_context *) base;
 
-  test_fini( ctx, "Ticket Lock", true, "global counter", 2, active_workers );
+  test_fini( ctx, SMP_LOCK_TYPE, true, "global counter", 2, active_workers );
 }
 
 static void test_3_body(
@@ -339,7 +352,7 @@ static void test_4_fini(
 
   test_context *ctx = (test_context *) base;
 
-  test_fini( ctx, "Ticket Lock", false, "local counter", 4, active_workers );
+  test_fini( ctx, SMP_LOCK_TYPE, false, "local counter", 4, active_workers );
 }
 
 static void test_5_body(
@@ -430,7 +443,7 @@ static void test_6_fini(
 
   test_context *ctx = (test_context *) base;
 
-  test_fini( ctx, "Ticket Lock", false, "global counter", 6, active_workers );
+  test_fini( ctx, SMP_LOCK_TYPE, false, "global counter", 6, active_workers );
 }
 
 static void test_7_body(
@@ -526,7 +539,7 @@ static void test_8_fini(
 
   test_context *ctx = (test_context *) base;
 
-  test_fini( ctx, "Ticket Lock", true, "busy loop", 8, active_workers );
+  test_fini( ctx, SMP_LOCK_TYPE, true, "busy loop", 8, active_workers );
 }
 
 static void test_9_body(
@@ -714,6 +727,143 @@ static void test_12_fini(
   test_fini( ctx, "TTAS Lock", true, "local counter", 12, active_workers );
 }
 
+static void test_13_body(
+  rtems_test_parallel_context *base,
+  void                        *arg,
+  size_t                       active_workers,
+  size_t                       worker_index
+)
+{
+  (void) arg;
+
+  test_context          *ctx = (test_context *) base;
+  size_t                 test = 13;
+  unsigned long          counter = 0;
+  rtems_interrupt_level  level;
+#if defined( RTEMS_PROFILING )
+  SMP_lock_Stats_context stats_context;
+#endif
+
+  while ( !rtems_test_parallel_stop_job( &ctx->base ) ) {
+    rtems_interrupt_local_disable( level );
+    _SMP_queued_lock_Acquire(
+      &ctx->queued_lock,
+      &ctx->queued_stats,
+      &stats_context
+    );
+    _SMP_queued_lock_Release( &ctx->queued_lock, &stats_context );
+    rtems_interrupt_local_enable( level );
+    ++counter;
+  }
+
+  ctx->local_counter[ active_workers - 1 ][ test ][ worker_index ] = counter;
+}
+
+static void test_13_fini(
+  rtems_test_parallel_context *base,
+  void                        *arg,
+  size_t                       active_workers
+)
+{
+  (void) arg;
+
+  test_context *ctx = (test_context *) base;
+
+  test_fini( ctx, "Queued Lock", true, "local counter", 13, active_workers );
+}
+
+static void test_14_body(
+  rtems_test_parallel_context *base,
+  void                        *arg,
+  size_t                       active_workers,
+  size_t                       worker_index
+)
+{
+  (void) arg;
+
+  test_context          *ctx = (test_context *) base;
+  size_t                 test = 14;
+  unsigned long          counter = 0;
+  rtems_interrupt_level  level;
+#if defined( RTEMS_PROFILING )
+  SMP_lock_Stats_context stats_context;
+#endif
+
+  while ( !rtems_test_parallel_stop_job( &ctx->base ) ) {
+    rtems_interrupt_local_disable( level );
+    _SMP_queued_lock_Acquire(
+      &ctx->queued_lock,
+      &ctx->queued_stats,
+      &stats_context
+    );
+    ++ctx->counter[ test ];
+    _SMP_queued_lock_Release( &ctx->queued_lock, &stats_context );
+    rtems_interrupt_local_enable( level );
+    ++counter;
+  }
+
+  ctx->local_counter[ active_workers - 1 ][ test ][ worker_index ] = counter;
+}
+
+static void test_14_fini(
+  rtems_test_parallel_context *base,
+  void                        *arg,
+  size_t                       active_workers
+)
+{
+  (void) arg;
+
+  test_context *ctx = (test_context *) base;
+
+  test_fini( ctx, "Queued Lock", true, "global counter", 14, active_workers );
+}
+
+static void test_15_body(
+  rtems_test_parallel_context *base,
+  void                        *arg,
+  size_t                       active_workers,
+  size_t                       worker_index
+)
+{
+  (void) arg;
+
+  test_context          *ctx = (test_context *) base;
+  size_t                 test = 15;
+  unsigned long          counter = 0;
+  rtems_interrupt_level  level;
+#if defined( RTEMS_PROFILING )
+  SMP_lock_Stats_context stats_context;
+#endif
+
+  while ( !rtems_test_parallel_stop_job( &ctx->base ) ) {
+    rtems_interrupt_local_disable( level );
+    _SMP_queued_lock_Acquire(
+      &ctx->queued_lock,
+      &ctx->queued_stats,
+      &stats_context
+    );
+    busy_section();
+    _SMP_queued_lock_Release( &ctx->queued_lock, &stats_context );
+    rtems_interrupt_local_enable( level );
+    ++counter;
+  }
+
+  ctx->local_counter[ active_workers - 1 ][ test ][ worker_index ] = counter;
+}
+
+static void test_15_fini(
+  rtems_test_parallel_context *base,
+  void                        *arg,
+  size_t                       active_workers
+)
+{
+  (void) arg;
+
+  test_context *ctx = (test_context *) base;
+
+  test_fini( ctx, "Queued Lock", true, "busy loop", 15, active_workers );
+}
+
 static const rtems_test_parallel_job test_jobs[ TEST_COUNT ] = {
   { .init = test_init,
     .body = test_0_body,
@@ -766,7 +916,19 @@ static const rtems_test_parallel_job test_jobs[ TEST_COUNT ] = {
   { .init = test_init,
     .body = test_12_body,
     .fini = test_12_fini,
-    .cascade = true }
+    .cascade = true },
+  { .init = test_init,
+    .body = test_13_body,
+    .fini = test_13_fini,
+    .cascade = true },
+  { .init = test_init,
+    .body = test_14_body,
+    .fini = test_14_fini,
+    .cascade = false },
+  { .init = test_init,
+    .body = test_15_body,
+    .fini = test_15_fini,
+    .cascade = false }
 };
 
 static void test( void )
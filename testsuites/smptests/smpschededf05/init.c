@@ -0,0 +1,356 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems.h>
+#include <rtems/counter.h>
+
+#include <inttypes.h>
+#include <string.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SMPSCHEDEDF 5";
+
+#define CPU_COUNT 8
+
+#define PAIR_COUNT CPU_COUNT
+
+#define TASK_PRIORITY 2
+
+typedef struct {
+  rtems_id            sender;
+  rtems_id            receiver;
+  rtems_counter_ticks send_instant;
+  unsigned long       round_trips;
+  uint64_t            latency_sum;
+  rtems_counter_ticks latency_max;
+} pair_context;
+
+typedef struct {
+  rtems_id         scheduler_ids[ CPU_COUNT ];
+  uint32_t         cpu_count;
+  rtems_id         done;
+  volatile bool    stop;
+  const char      *test_sep;
+  pair_context     pairs[ PAIR_COUNT ];
+} test_context;
+
+static test_context test_instance;
+
+static void sender_task( rtems_task_argument arg )
+{
+  test_context     *ctx;
+  pair_context     *pair;
+  rtems_status_code sc;
+
+  ctx = &test_instance;
+  pair = &ctx->pairs[ arg ];
+
+  while ( !ctx->stop ) {
+    pair->send_instant = rtems_counter_read();
+
+    sc = rtems_event_transient_send( pair->receiver );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+    sc = rtems_event_transient_receive( RTEMS_WAIT, RTEMS_NO_TIMEOUT );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+    ++pair->round_trips;
+  }
+
+  sc = rtems_semaphore_release( ctx->done );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  (void) rtems_task_suspend( RTEMS_SELF );
+  rtems_test_assert( 0 );
+}
+
+static void receiver_task( rtems_task_argument arg )
+{
+  pair_context *pair;
+
+  pair = &test_instance.pairs[ arg ];
+
+  while ( true ) {
+    rtems_status_code   sc;
+    rtems_counter_ticks latency;
+
+    sc = rtems_event_transient_receive( RTEMS_WAIT, RTEMS_NO_TIMEOUT );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+    latency = rtems_counter_difference(
+      rtems_counter_read(),
+      pair->send_instant
+    );
+    pair->latency_sum += latency;
+
+    if ( latency > pair->latency_max ) {
+      pair->latency_max = latency;
+    }
+
+    sc = rtems_event_transient_send( pair->sender );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  }
+}
+
+static rtems_id create_task( rtems_id scheduler_id, rtems_name name )
+{
+  rtems_status_code sc;
+  rtems_id          id;
+
+  sc = rtems_task_create(
+    name,
+    TASK_PRIORITY,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &id
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_task_set_scheduler( id, scheduler_id, TASK_PRIORITY );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  return id;
+}
+
+static void move_processor( rtems_id from, rtems_id to, uint32_t cpu_index )
+{
+  rtems_status_code sc;
+
+  sc = rtems_scheduler_remove_processor( from, cpu_index );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_scheduler_add_processor( to, cpu_index );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void run(
+  test_context *ctx,
+  uint32_t      active_processors,
+  bool          global
+)
+{
+  rtems_status_code sc;
+  unsigned long     round_trips;
+  uint64_t          latency_sum;
+  uint64_t          latency_max;
+  uint32_t          i;
+
+  if ( global ) {
+    for ( i = 1; i < active_processors; ++i ) {
+      move_processor( ctx->scheduler_ids[ i ], ctx->scheduler_ids[ 0 ], i );
+    }
+  }
+
+  ctx->stop = false;
+
+  for ( i = 0; i < active_processors; ++i ) {
+    pair_context *pair;
+    rtems_id      scheduler_id;
+
+    pair = &ctx->pairs[ i ];
+    memset( pair, 0, sizeof( *pair ) );
+    scheduler_id = ctx->scheduler_ids[ global ? 0 : i ];
+    pair->sender = create_task(
+      scheduler_id,
+      rtems_build_name( 'S', 'E', 'N', 'D' )
+    );
+    pair->receiver = create_task(
+      scheduler_id,
+      rtems_build_name( 'R', 'E', 'C', 'V' )
+    );
+
+    sc = rtems_task_start( pair->receiver, receiver_task, i );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  }
+
+  for ( i = 0; i < active_processors; ++i ) {
+    sc = rtems_task_start( ctx->pairs[ i ].sender, sender_task, i );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  }
+
+  sc = rtems_task_wake_after( rtems_clock_get_ticks_per_second() );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  ctx->stop = true;
+  round_trips = 0;
+  latency_sum = 0;
+  latency_max = 0;
+
+  for ( i = 0; i < active_processors; ++i ) {
+    pair_context *pair;
+
+    sc = rtems_semaphore_obtain( ctx->done, RTEMS_WAIT, RTEMS_NO_TIMEOUT );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+    pair = &ctx->pairs[ i ];
+    round_trips += pair->round_trips;
+    latency_sum += pair->latency_sum;
+
+    if ( pair->latency_max > latency_max ) {
+      latency_max = pair->latency_max;
+    }
+  }
+
+  for ( i = 0; i < active_processors; ++i ) {
+    sc = rtems_task_delete( ctx->pairs[ i ].sender );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+    sc = rtems_task_delete( ctx->pairs[ i ].receiver );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  }
+
+  if ( global ) {
+    for ( i = 1; i < active_processors; ++i ) {
+      move_processor( ctx->scheduler_ids[ 0 ], ctx->scheduler_ids[ i ], i );
+    }
+  }
+
+  printf(
+    "%s{\n"
+    "    \"scheduler\": \"%s\",\n"
+    "    \"processors\": %" PRIu32 ",\n"
+    "    \"round-trips\": %lu,\n"
+    "    \"dispatch-latency-avg-ns\": %" PRIu64 ",\n"
+    "    \"dispatch-latency-max-ns\": %" PRIu64 "\n"
+    "  }",
+    ctx->test_sep,
+    global ? "global" : "partitioned",
+    active_processors,
+    round_trips,
+    round_trips > 0 ?
+      rtems_counter_ticks_to_nanoseconds( latency_sum ) / round_trips : 0,
+    rtems_counter_ticks_to_nanoseconds( latency_max )
+  );
+  ctx->test_sep = ", ";
+}
+
+static void test( test_context *ctx )
+{
+  rtems_status_code sc;
+  uint32_t          i;
+
+  ctx->cpu_count = rtems_scheduler_get_processor_maximum();
+
+  if ( ctx->cpu_count > CPU_COUNT ) {
+    ctx->cpu_count = CPU_COUNT;
+  }
+
+  for ( i = 0; i < ctx->cpu_count; ++i ) {
+    sc = rtems_scheduler_ident_by_processor( i, &ctx->scheduler_ids[ i ] );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  }
+
+  sc = rtems_semaphore_create(
+    rtems_build_name( 'D', 'O', 'N', 'E' ),
+    0,
+    RTEMS_COUNTING_SEMAPHORE,
+    0,
+    &ctx->done
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  printf( "*** BEGIN OF JSON DATA ***\n[\n  " );
+  ctx->test_sep = "";
+
+  for ( i = 1; i <= ctx->cpu_count; ++i ) {
+    run( ctx, i, true );
+    run( ctx, i, false );
+  }
+
+  printf( "\n]\n*** END OF JSON DATA ***\n" );
+
+  sc = rtems_semaphore_delete( ctx->done );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  (void) arg;
+
+  TEST_BEGIN();
+  test( &test_instance );
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS ( 1 + 2 * PAIR_COUNT )
+
+#define CONFIGURE_MAXIMUM_SEMAPHORES 1
+
+#define CONFIGURE_MAXIMUM_PROCESSORS CPU_COUNT
+
+#define CONFIGURE_SCHEDULER_EDF_SMP
+
+#include <rtems/scheduler.h>
+
+RTEMS_SCHEDULER_EDF_SMP( p0 );
+RTEMS_SCHEDULER_EDF_SMP( p1 );
+RTEMS_SCHEDULER_EDF_SMP( p2 );
+RTEMS_SCHEDULER_EDF_SMP( p3 );
+RTEMS_SCHEDULER_EDF_SMP( p4 );
+RTEMS_SCHEDULER_EDF_SMP( p5 );
+RTEMS_SCHEDULER_EDF_SMP( p6 );
+RTEMS_SCHEDULER_EDF_SMP( p7 );
+
+#define SCHED_NAME( i ) rtems_build_name( 'E', 'D', 'F', '0' + ( i ) )
+
+#define CONFIGURE_SCHEDULER_TABLE_ENTRIES                 \
+  RTEMS_SCHEDULER_TABLE_EDF_SMP( p0, SCHED_NAME( 0 ) ),   \
+    RTEMS_SCHEDULER_TABLE_EDF_SMP( p1, SCHED_NAME( 1 ) ), \
+    RTEMS_SCHEDULER_TABLE_EDF_SMP( p2, SCHED_NAME( 2 ) ), \
+    RTEMS_SCHEDULER_TABLE_EDF_SMP( p3, SCHED_NAME( 3 ) ), \
+    RTEMS_SCHEDULER_TABLE_EDF_SMP( p4, SCHED_NAME( 4 ) ), \
+    RTEMS_SCHEDULER_TABLE_EDF_SMP( p5, SCHED_NAME( 5 ) ), \
+    RTEMS_SCHEDULER_TABLE_EDF_SMP( p6, SCHED_NAME( 6 ) ), \
+    RTEMS_SCHEDULER_TABLE_EDF_SMP( p7, SCHED_NAME( 7 ) )
+
+#define CONFIGURE_SCHEDULER_ASSIGNMENTS                                     \
+  RTEMS_SCHEDULER_ASSIGN( 0, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_MANDATORY ),  \
+    RTEMS_SCHEDULER_ASSIGN( 1, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL ), \
+    RTEMS_SCHEDULER_ASSIGN( 2, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL ), \
+    RTEMS_SCHEDULER_ASSIGN( 3, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL ), \
+    RTEMS_SCHEDULER_ASSIGN( 4, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL ), \
+    RTEMS_SCHEDULER_ASSIGN( 5, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL ), \
+    RTEMS_SCHEDULER_ASSIGN( 6, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL ), \
+    RTEMS_SCHEDULER_ASSIGN( 7, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL )
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
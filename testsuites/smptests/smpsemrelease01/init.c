@@ -0,0 +1,283 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems.h>
+#include <rtems/test-info.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SMPSEMRELEASE 1";
+
+#define TASK_PRIORITY 1
+
+#define CPU_COUNT 32
+
+#define TEST_COUNT 2
+
+typedef struct {
+  rtems_test_parallel_context base;
+  const char                 *test_sep;
+  const char                 *counter_sep;
+  rtems_id                    global_semaphore;
+  rtems_id                    local_semaphores[ CPU_COUNT ];
+  unsigned long         local_counter[ CPU_COUNT ][ TEST_COUNT ][ CPU_COUNT ];
+} test_context;
+
+static test_context test_instance;
+
+static rtems_interval test_duration( void )
+{
+  return rtems_clock_get_ticks_per_second();
+}
+
+static rtems_interval test_init(
+  rtems_test_parallel_context *base,
+  void                        *arg,
+  size_t                       active_workers
+)
+{
+  (void) base;
+  (void) arg;
+  (void) active_workers;
+
+  return test_duration();
+}
+
+static void test_fini(
+  test_context *ctx,
+  bool          global_semaphore,
+  size_t        test,
+  size_t        active_workers
+)
+{
+  unsigned long sum = 0;
+  const char   *value_sep;
+  size_t        i;
+
+  if ( active_workers == 1 ) {
+    printf(
+      "%s{\n"
+      "    \"semaphore-object\": \"%s\",\n"
+      "    \"results\": [",
+      ctx->test_sep,
+      global_semaphore ? "global" : "local"
+    );
+    ctx->test_sep = ", ";
+    ctx->counter_sep = "\n      ";
+  }
+
+  printf(
+    "%s{\n"
+    "        \"counter\": [",
+    ctx->counter_sep
+  );
+  ctx->counter_sep = "\n      }, ";
+  value_sep = "";
+
+  for ( i = 0; i < active_workers; ++i ) {
+    unsigned long local_counter = ctx->local_counter[ active_workers - 1 ]
+                                                    [ test ][ i ];
+
+    sum += local_counter;
+
+    printf( "%s%lu", value_sep, local_counter );
+    value_sep = ", ";
+  }
+
+  printf( "],\n        \"sum-of-local-counter\": %lu", sum );
+
+  if ( active_workers == rtems_scheduler_get_processor_maximum() ) {
+    printf( "\n      }\n    ]\n  }" );
+  }
+}
+
+static unsigned long release_and_obtain(
+  test_context *ctx,
+  rtems_id      id
+)
+{
+  unsigned long counter = 0;
+
+  while ( !rtems_test_parallel_stop_job( &ctx->base ) ) {
+    rtems_status_code sc;
+
+    sc = rtems_semaphore_release( id );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+    /*
+     * Obtain the semaphore without waiting to keep the count bounded.  In
+     * case of the global semaphore, another worker may have taken it already.
+     */
+    (void) rtems_semaphore_obtain( id, RTEMS_NO_WAIT, 0 );
+    ++counter;
+  }
+
+  return counter;
+}
+
+static void test_0_body(
+  rtems_test_parallel_context *base,
+  void                        *arg,
+  size_t                       active_workers,
+  size_t                       worker_index
+)
+{
+  (void) arg;
+
+  test_context *ctx = (test_context *) base;
+  size_t        test = 0;
+
+  ctx->local_counter[ active_workers - 1 ][ test ][ worker_index ] =
+    release_and_obtain( ctx, ctx->local_semaphores[ worker_index ] );
+}
+
+static void test_0_fini(
+  rtems_test_parallel_context *base,
+  void                        *arg,
+  size_t                       active_workers
+)
+{
+  (void) arg;
+
+  test_context *ctx = (test_context *) base;
+
+  test_fini( ctx, false, 0, active_workers );
+}
+
+static void test_1_body(
+  rtems_test_parallel_context *base,
+  void                        *arg,
+  size_t                       active_workers,
+  size_t                       worker_index
+)
+{
+  (void) arg;
+
+  test_context *ctx = (test_context *) base;
+  size_t        test = 1;
+
+  ctx->local_counter[ active_workers - 1 ][ test ][ worker_index ] =
+    release_and_obtain( ctx, ctx->global_semaphore );
+}
+
+static void test_1_fini(
+  rtems_test_parallel_context *base,
+  void                        *arg,
+  size_t                       active_workers
+)
+{
+  (void) arg;
+
+  test_context *ctx = (test_context *) base;
+
+  test_fini( ctx, true, 1, active_workers );
+}
+
+static const rtems_test_parallel_job test_jobs[ TEST_COUNT ] = {
+  { .init = test_init,
+    .body = test_0_body,
+    .fini = test_0_fini,
+    .cascade = true },
+  { .init = test_init,
+    .body = test_1_body,
+    .fini = test_1_fini,
+    .cascade = true }
+};
+
+static rtems_id create_semaphore( void )
+{
+  rtems_status_code sc;
+  rtems_id          id;
+
+  sc = rtems_semaphore_create(
+    rtems_build_name( 'S', 'E', 'M', ' ' ),
+    0,
+    RTEMS_COUNTING_SEMAPHORE | RTEMS_PRIORITY,
+    0,
+    &id
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  return id;
+}
+
+static void test( void )
+{
+  test_context *ctx = &test_instance;
+  uint32_t      cpu_count = rtems_scheduler_get_processor_maximum();
+  uint32_t      i;
+
+  ctx->global_semaphore = create_semaphore();
+
+  for ( i = 0; i < cpu_count; ++i ) {
+    ctx->local_semaphores[ i ] = create_semaphore();
+  }
+
+  printf( "*** BEGIN OF JSON DATA ***\n[\n  " );
+  ctx->test_sep = "";
+  rtems_test_parallel( &ctx->base, NULL, &test_jobs[ 0 ], TEST_COUNT );
+  printf( "\n]\n*** END OF JSON DATA ***\n" );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  (void) arg;
+
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_PROCESSORS CPU_COUNT
+
+#define CONFIGURE_MAXIMUM_TASKS CPU_COUNT
+
+#define CONFIGURE_MAXIMUM_SEMAPHORES ( CPU_COUNT + 1 )
+
+#define CONFIGURE_MAXIMUM_TIMERS 1
+
+#define CONFIGURE_INIT_TASK_PRIORITY      TASK_PRIORITY
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+#define CONFIGURE_INIT_TASK_ATTRIBUTES    RTEMS_DEFAULT_ATTRIBUTES
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,319 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <string.h>
+
+#include <rtems.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SPMSGQLOAN 1";
+
+#define MESSAGE_COUNT 2
+
+#define MESSAGE_SIZE 16
+
+typedef struct {
+  rtems_id queue;
+  rtems_id worker;
+  void    *received_buffer;
+  size_t   received_size;
+  char     received_content[ MESSAGE_SIZE ];
+} test_context;
+
+static test_context test_instance;
+
+static void worker_task( rtems_task_argument arg )
+{
+  test_context     *ctx;
+  rtems_status_code sc;
+
+  ctx = (test_context *) arg;
+
+  while ( true ) {
+    sc = rtems_message_queue_receive_buffer(
+      ctx->queue,
+      &ctx->received_buffer,
+      &ctx->received_size,
+      RTEMS_WAIT,
+      RTEMS_NO_TIMEOUT
+    );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+    memcpy(
+      ctx->received_content,
+      ctx->received_buffer,
+      ctx->received_size
+    );
+
+    sc = rtems_message_queue_release_buffer(
+      ctx->queue,
+      ctx->received_buffer
+    );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  }
+}
+
+static void test_obtain_and_release( test_context *ctx )
+{
+  rtems_status_code sc;
+  void             *a;
+  void             *b;
+  void             *c;
+  char              local[ MESSAGE_SIZE ];
+
+  sc = rtems_message_queue_obtain_buffer( ctx->queue, NULL );
+  rtems_test_assert( sc == RTEMS_INVALID_ADDRESS );
+
+  sc = rtems_message_queue_obtain_buffer( 0, &a );
+  rtems_test_assert( sc == RTEMS_INVALID_ID );
+
+  sc = rtems_message_queue_obtain_buffer( ctx->queue, &a );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_message_queue_obtain_buffer( ctx->queue, &b );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( a != b );
+
+  sc = rtems_message_queue_obtain_buffer( ctx->queue, &c );
+  rtems_test_assert( sc == RTEMS_TOO_MANY );
+
+  sc = rtems_message_queue_send( ctx->queue, local, sizeof( local ) );
+  rtems_test_assert( sc == RTEMS_TOO_MANY );
+
+  sc = rtems_message_queue_release_buffer( ctx->queue, local );
+  rtems_test_assert( sc == RTEMS_INVALID_ADDRESS );
+
+  sc = rtems_message_queue_release_buffer( ctx->queue, (char *) a + 1 );
+  rtems_test_assert( sc == RTEMS_INVALID_ADDRESS );
+
+  sc = rtems_message_queue_release_buffer( ctx->queue, a );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_message_queue_release_buffer( ctx->queue, a );
+  rtems_test_assert( sc == RTEMS_INVALID_ADDRESS );
+
+  sc = rtems_message_queue_release_buffer( ctx->queue, b );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void test_send_and_receive( test_context *ctx )
+{
+  rtems_status_code sc;
+  void             *a;
+  void             *b;
+  size_t            size;
+  char              local[ MESSAGE_SIZE ];
+
+  sc = rtems_message_queue_obtain_buffer( ctx->queue, &a );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_message_queue_send_buffer( ctx->queue, a, MESSAGE_SIZE + 1 );
+  rtems_test_assert( sc == RTEMS_INVALID_SIZE );
+
+  sc = rtems_message_queue_send_buffer( ctx->queue, local, 1 );
+  rtems_test_assert( sc == RTEMS_INVALID_ADDRESS );
+
+  /* Loaned send and copy receive */
+  memcpy( a, "abc", 3 );
+  sc = rtems_message_queue_send_buffer( ctx->queue, a, 3 );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_message_queue_send_buffer( ctx->queue, a, 3 );
+  rtems_test_assert( sc == RTEMS_INVALID_ADDRESS );
+
+  sc = rtems_message_queue_receive(
+    ctx->queue,
+    local,
+    &size,
+    RTEMS_NO_WAIT,
+    0
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( size == 3 );
+  rtems_test_assert( memcmp( local, "abc", 3 ) == 0 );
+
+  /* Copy send and loaned receive */
+  sc = rtems_message_queue_send( ctx->queue, "de", 2 );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_message_queue_receive_buffer(
+    ctx->queue,
+    &b,
+    &size,
+    RTEMS_NO_WAIT,
+    0
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( size == 2 );
+  rtems_test_assert( memcmp( b, "de", 2 ) == 0 );
+
+  /* Forward the received buffer without a copy */
+  sc = rtems_message_queue_send_buffer( ctx->queue, b, 2 );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_message_queue_receive_buffer(
+    ctx->queue,
+    &a,
+    &size,
+    RTEMS_NO_WAIT,
+    0
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( a == b );
+  rtems_test_assert( size == 2 );
+
+  sc = rtems_message_queue_receive_buffer(
+    ctx->queue,
+    &b,
+    &size,
+    RTEMS_NO_WAIT,
+    0
+  );
+  rtems_test_assert( sc == RTEMS_UNSATISFIED );
+
+  sc = rtems_message_queue_release_buffer( ctx->queue, a );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void test_waiting_receiver( test_context *ctx )
+{
+  rtems_status_code sc;
+  void             *a;
+  void             *b;
+
+  sc = rtems_task_start(
+    ctx->worker,
+    worker_task,
+    (rtems_task_argument) ctx
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  /* The worker blocks in the loaned receive and obtains the loan */
+  sc = rtems_message_queue_obtain_buffer( ctx->queue, &a );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  memcpy( a, "fghi", 4 );
+  sc = rtems_message_queue_send_buffer( ctx->queue, a, 4 );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( ctx->received_buffer == a );
+  rtems_test_assert( ctx->received_size == 4 );
+  rtems_test_assert( memcmp( ctx->received_content, "fghi", 4 ) == 0 );
+
+  /* The worker receives a copy in a buffer of the queue */
+  sc = rtems_message_queue_send( ctx->queue, "jk", 2 );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( ctx->received_size == 2 );
+  rtems_test_assert( memcmp( ctx->received_content, "jk", 2 ) == 0 );
+
+  /* No buffer is available for the copy */
+  sc = rtems_message_queue_obtain_buffer( ctx->queue, &a );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_message_queue_obtain_buffer( ctx->queue, &b );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  ctx->received_size = 0;
+  sc = rtems_message_queue_send( ctx->queue, "l", 1 );
+  rtems_test_assert( sc == RTEMS_TOO_MANY );
+  rtems_test_assert( ctx->received_size == 0 );
+
+  sc = rtems_message_queue_send_buffer( ctx->queue, b, 1 );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( ctx->received_buffer == b );
+  rtems_test_assert( ctx->received_size == 1 );
+
+  sc = rtems_message_queue_release_buffer( ctx->queue, a );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  test_context     *ctx;
+  rtems_status_code sc;
+
+  TEST_BEGIN();
+  ctx = &test_instance;
+
+  sc = rtems_message_queue_create(
+    rtems_build_name( 'M', 'S', 'G', 'Q' ),
+    MESSAGE_COUNT,
+    MESSAGE_SIZE,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &ctx->queue
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_task_create(
+    rtems_build_name( 'W', 'O', 'R', 'K' ),
+    1,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &ctx->worker
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  test_obtain_and_release( ctx );
+  test_send_and_receive( ctx );
+  test_waiting_receiver( ctx );
+
+  sc = rtems_task_delete( ctx->worker );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_message_queue_delete( ctx->queue );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_MAXIMUM_MESSAGE_QUEUES 1
+
+#define CONFIGURE_MESSAGE_BUFFER_MEMORY \
+  CONFIGURE_MESSAGE_BUFFERS_FOR_QUEUE( MESSAGE_COUNT, MESSAGE_SIZE )
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_INIT_TASK_PRIORITY 2
+
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
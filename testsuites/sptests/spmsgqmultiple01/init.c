@@ -0,0 +1,433 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <string.h>
+
+#include <rtems.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SPMSGQMULTIPLE 1";
+
+#define MAXIMUM_PENDING 4
+
+#define MESSAGE_SIZE 8
+
+#define BATCH_SIZE 8
+
+#define WORKER_COUNT 2
+
+#define PRIO_WORKER 1
+
+#define PRIO_INIT 2
+
+typedef struct {
+  rtems_id          queue;
+  rtems_id          workers[ WORKER_COUNT ];
+  rtems_status_code status[ WORKER_COUNT ];
+  uint32_t          counts[ WORKER_COUNT ];
+  size_t            sizes[ WORKER_COUNT ][ BATCH_SIZE ];
+  char              buffers[ WORKER_COUNT ][ BATCH_SIZE * MESSAGE_SIZE ];
+} test_context;
+
+static test_context test_instance;
+
+static const char too_large[] = "123456789";
+
+static void check_messages(
+  const char        *buffer,
+  const size_t      *sizes,
+  uint32_t           count,
+  const char *const *expected
+)
+{
+  uint32_t i;
+
+  for ( i = 0; i < count; ++i ) {
+    size_t size;
+
+    size = strlen( expected[ i ] );
+    rtems_test_assert( sizes[ i ] == size );
+    rtems_test_assert( memcmp( buffer, expected[ i ], size ) == 0 );
+    buffer += size;
+  }
+}
+
+static uint32_t send_batch(
+  test_context      *ctx,
+  const char *const *messages,
+  uint32_t           count,
+  rtems_status_code  expected_status
+)
+{
+  char              buffer[ BATCH_SIZE * sizeof( too_large ) ];
+  size_t            sizes[ BATCH_SIZE ];
+  size_t            offset;
+  uint32_t          i;
+  rtems_status_code sc;
+
+  rtems_test_assert( count <= BATCH_SIZE );
+  offset = 0;
+
+  for ( i = 0; i < count; ++i ) {
+    sizes[ i ] = strlen( messages[ i ] );
+    memcpy( &buffer[ offset ], messages[ i ], sizes[ i ] );
+    offset += sizes[ i ];
+  }
+
+  sc = rtems_message_queue_send_multiple( ctx->queue, buffer, sizes, &count );
+  rtems_test_assert( sc == expected_status );
+
+  return count;
+}
+
+static uint32_t receive_batch(
+  test_context      *ctx,
+  uint32_t           count,
+  rtems_option       option_set,
+  rtems_interval     timeout,
+  rtems_status_code  expected_status,
+  const char *const *expected
+)
+{
+  char              buffer[ BATCH_SIZE * MESSAGE_SIZE ];
+  size_t            sizes[ BATCH_SIZE ];
+  rtems_status_code sc;
+
+  rtems_test_assert( count <= BATCH_SIZE );
+
+  sc = rtems_message_queue_receive_multiple(
+    ctx->queue,
+    buffer,
+    sizes,
+    &count,
+    option_set,
+    timeout
+  );
+  rtems_test_assert( sc == expected_status );
+  check_messages( buffer, sizes, count, expected );
+
+  return count;
+}
+
+static uint32_t get_pending( const test_context *ctx )
+{
+  rtems_status_code sc;
+  uint32_t          count;
+
+  sc = rtems_message_queue_get_number_pending( ctx->queue, &count );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  return count;
+}
+
+static void worker_task( rtems_task_argument arg )
+{
+  test_context *ctx;
+  size_t        i;
+
+  ctx = &test_instance;
+  i = (size_t) arg;
+
+  while ( true ) {
+    rtems_status_code sc;
+
+    ctx->counts[ i ] = BATCH_SIZE;
+    ctx->status[ i ] = rtems_message_queue_receive_multiple(
+      ctx->queue,
+      ctx->buffers[ i ],
+      ctx->sizes[ i ],
+      &ctx->counts[ i ],
+      RTEMS_WAIT,
+      RTEMS_NO_TIMEOUT
+    );
+
+    sc = rtems_task_suspend( RTEMS_SELF );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  }
+}
+
+static void test_invalid_arguments( test_context *ctx )
+{
+  static const char *const messages[] = { too_large };
+  char                     buffer[ MESSAGE_SIZE ];
+  size_t                   sizes[ 1 ];
+  uint32_t                 count;
+  rtems_status_code        sc;
+
+  sizes[ 0 ] = 1;
+  buffer[ 0 ] = 'a';
+
+  count = 1;
+  sc = rtems_message_queue_send_multiple( ctx->queue, NULL, sizes, &count );
+  rtems_test_assert( sc == RTEMS_INVALID_ADDRESS );
+
+  sc = rtems_message_queue_send_multiple( ctx->queue, buffer, NULL, &count );
+  rtems_test_assert( sc == RTEMS_INVALID_ADDRESS );
+
+  sc = rtems_message_queue_send_multiple( ctx->queue, buffer, sizes, NULL );
+  rtems_test_assert( sc == RTEMS_INVALID_ADDRESS );
+
+  count = 0;
+  sc = rtems_message_queue_send_multiple( ctx->queue, buffer, sizes, &count );
+  rtems_test_assert( sc == RTEMS_INVALID_NUMBER );
+
+  count = 1;
+  sc = rtems_message_queue_send_multiple( 0, buffer, sizes, &count );
+  rtems_test_assert( sc == RTEMS_INVALID_ID );
+
+  count = 1;
+  sc = rtems_message_queue_receive_multiple(
+    ctx->queue,
+    NULL,
+    sizes,
+    &count,
+    RTEMS_NO_WAIT,
+    0
+  );
+  rtems_test_assert( sc == RTEMS_INVALID_ADDRESS );
+
+  sc = rtems_message_queue_receive_multiple(
+    ctx->queue,
+    buffer,
+    NULL,
+    &count,
+    RTEMS_NO_WAIT,
+    0
+  );
+  rtems_test_assert( sc == RTEMS_INVALID_ADDRESS );
+
+  sc = rtems_message_queue_receive_multiple(
+    ctx->queue,
+    buffer,
+    sizes,
+    NULL,
+    RTEMS_NO_WAIT,
+    0
+  );
+  rtems_test_assert( sc == RTEMS_INVALID_ADDRESS );
+
+  count = 0;
+  sc = rtems_message_queue_receive_multiple(
+    ctx->queue,
+    buffer,
+    sizes,
+    &count,
+    RTEMS_NO_WAIT,
+    0
+  );
+  rtems_test_assert( sc == RTEMS_INVALID_NUMBER );
+
+  count = 1;
+  sc = rtems_message_queue_receive_multiple(
+    0,
+    buffer,
+    sizes,
+    &count,
+    RTEMS_NO_WAIT,
+    0
+  );
+  rtems_test_assert( sc == RTEMS_INVALID_ID );
+
+  /* The first message is too large */
+  count = send_batch( ctx, messages, 1, RTEMS_INVALID_SIZE );
+  rtems_test_assert( count == 0 );
+  rtems_test_assert( get_pending( ctx ) == 0 );
+}
+
+static void test_partial_batches( test_context *ctx )
+{
+  static const char *const invalid_first[] = { too_large, "a", "b" };
+  static const char *const invalid_size[] = { "a", too_large, "b" };
+  static const char *const too_many[] = { "bb", "ccc", "dddd", "eeeee" };
+  static const char *const full[] = { "f" };
+  static const char *const first[] = { "a", "bb" };
+  static const char *const second[] = { "ccc", "dddd" };
+  uint32_t                 count;
+
+  /* No message is sent if the first message is too large */
+  count = send_batch( ctx, invalid_first, 3, RTEMS_INVALID_SIZE );
+  rtems_test_assert( count == 0 );
+  rtems_test_assert( get_pending( ctx ) == 0 );
+
+  /* A batch stops at a message which is too large */
+  count = send_batch( ctx, invalid_size, 3, RTEMS_SUCCESSFUL );
+  rtems_test_assert( count == 1 );
+
+  /* A batch stops if no message buffer is available */
+  count = send_batch( ctx, too_many, 4, RTEMS_SUCCESSFUL );
+  rtems_test_assert( count == MAXIMUM_PENDING - 1 );
+  rtems_test_assert( get_pending( ctx ) == MAXIMUM_PENDING );
+
+  /* No message can be sent */
+  count = send_batch( ctx, full, 1, RTEMS_TOO_MANY );
+  rtems_test_assert( count == 0 );
+
+  /* A batch receive takes at most the requested count of messages */
+  count = receive_batch( ctx, 2, RTEMS_NO_WAIT, 0, RTEMS_SUCCESSFUL, first );
+  rtems_test_assert( count == 2 );
+
+  count = receive_batch(
+    ctx,
+    BATCH_SIZE,
+    RTEMS_NO_WAIT,
+    0,
+    RTEMS_SUCCESSFUL,
+    second
+  );
+  rtems_test_assert( count == 2 );
+
+  count = receive_batch(
+    ctx,
+    BATCH_SIZE,
+    RTEMS_NO_WAIT,
+    0,
+    RTEMS_UNSATISFIED,
+    NULL
+  );
+  rtems_test_assert( count == 0 );
+}
+
+static void test_receive_timeout( test_context *ctx )
+{
+  rtems_interval start;
+  uint32_t       count;
+
+  start = rtems_clock_get_ticks_since_boot();
+  count = receive_batch( ctx, BATCH_SIZE, RTEMS_WAIT, 2, RTEMS_TIMEOUT, NULL );
+  rtems_test_assert( count == 0 );
+  rtems_test_assert( rtems_clock_get_ticks_since_boot() - start >= 2 );
+}
+
+static void test_waiting_receivers( test_context *ctx )
+{
+  static const char *const messages[] = { "a", "bb", "ccc" };
+  rtems_status_code        sc;
+  uint32_t                 count;
+  size_t                   i;
+
+  for ( i = 0; i < WORKER_COUNT; ++i ) {
+    sc = rtems_task_create(
+      rtems_build_name( 'W', 'O', 'R', 'K' ),
+      PRIO_WORKER,
+      RTEMS_MINIMUM_STACK_SIZE,
+      RTEMS_DEFAULT_MODES,
+      RTEMS_DEFAULT_ATTRIBUTES,
+      &ctx->workers[ i ]
+    );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+    /* The worker blocks in the batch receive */
+    sc = rtems_task_start( ctx->workers[ i ], worker_task, i );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  }
+
+  /*
+   * Each waiting receiver gets one message of the batch directly, the rest of
+   * the batch is queued up.
+   */
+  count = send_batch( ctx, messages, 3, RTEMS_SUCCESSFUL );
+  rtems_test_assert( count == 3 );
+
+  for ( i = 0; i < WORKER_COUNT; ++i ) {
+    rtems_test_assert( ctx->status[ i ] == RTEMS_SUCCESSFUL );
+    rtems_test_assert( ctx->counts[ i ] == 1 );
+    check_messages( ctx->buffers[ i ], ctx->sizes[ i ], 1, &messages[ i ] );
+
+    sc = rtems_task_delete( ctx->workers[ i ] );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  }
+
+  rtems_test_assert( get_pending( ctx ) == 1 );
+  count = receive_batch(
+    ctx,
+    BATCH_SIZE,
+    RTEMS_NO_WAIT,
+    0,
+    RTEMS_SUCCESSFUL,
+    &messages[ 2 ]
+  );
+  rtems_test_assert( count == 1 );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  test_context     *ctx;
+  rtems_status_code sc;
+
+  (void) arg;
+
+  TEST_BEGIN();
+
+  ctx = &test_instance;
+
+  sc = rtems_message_queue_create(
+    rtems_build_name( 'M', 'S', 'G', 'Q' ),
+    MAXIMUM_PENDING,
+    MESSAGE_SIZE,
+    RTEMS_FIFO | RTEMS_LOCAL,
+    &ctx->queue
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  test_invalid_arguments( ctx );
+  test_partial_batches( ctx );
+  test_receive_timeout( ctx );
+  test_waiting_receivers( ctx );
+
+  sc = rtems_message_queue_delete( ctx->queue );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS ( 1 + WORKER_COUNT )
+
+#define CONFIGURE_MAXIMUM_MESSAGE_QUEUES 1
+
+#define CONFIGURE_MESSAGE_BUFFER_MEMORY \
+  CONFIGURE_MESSAGE_BUFFERS_FOR_QUEUE( MAXIMUM_PENDING, MESSAGE_SIZE )
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_INIT_TASK_PRIORITY PRIO_INIT
+
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,320 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <rtems.h>
+#include <rtems/score/coremsgimpl.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SPMSGQPRIO 1";
+
+#define MAXIMUM_PENDING 512
+
+#define URGENT_COUNT 16
+
+#define RANDOM_OPERATIONS 4096
+
+typedef struct {
+  int      priority;
+  uint32_t sequence;
+} test_message;
+
+typedef struct {
+  CORE_message_queue_Control queue;
+  test_message               model[ MAXIMUM_PENDING ];
+  size_t                     model_count;
+  uint32_t                   sequence;
+  uint32_t                   random;
+} test_context;
+
+static test_context test_instance;
+
+static void *allocate_buffers(
+  CORE_message_queue_Control *the_message_queue,
+  size_t                      size,
+  const void                 *arg
+)
+{
+  (void) the_message_queue;
+  (void) arg;
+
+  return malloc( size );
+}
+
+static uint32_t next_random( test_context *ctx )
+{
+  ctx->random = ctx->random * 1103515245 + 12345;
+
+  return ctx->random >> 16;
+}
+
+/*
+ * Returns true, if the message a shall be received before the message b.
+ * Urgent messages are received in the reverse order of their submission,
+ * all other messages are received in priority order and in FIFO order
+ * within a priority.
+ */
+static bool is_before( const test_message *a, const test_message *b )
+{
+  if ( a->priority != b->priority ) {
+    return a->priority < b->priority;
+  }
+
+  if ( a->priority == CORE_MESSAGE_QUEUE_URGENT_REQUEST ) {
+    return a->sequence > b->sequence;
+  }
+
+  return a->sequence < b->sequence;
+}
+
+static void insert( test_context *ctx, int priority )
+{
+  CORE_message_queue_Buffer *the_message;
+  test_message               message;
+
+  message.priority = priority;
+  message.sequence = ctx->sequence;
+  ++ctx->sequence;
+
+  the_message = _CORE_message_queue_Allocate_message_buffer( &ctx->queue );
+  rtems_test_assert( the_message != NULL );
+
+  _CORE_message_queue_Insert_message(
+    &ctx->queue,
+    the_message,
+    &message,
+    sizeof( message ),
+    priority
+  );
+
+  rtems_test_assert( ctx->model_count < MAXIMUM_PENDING );
+  ctx->model[ ctx->model_count ] = message;
+  ++ctx->model_count;
+}
+
+static void receive( test_context *ctx )
+{
+  CORE_message_queue_Buffer *the_message;
+  test_message               message;
+  size_t                     first;
+  size_t                     i;
+
+  rtems_test_assert( ctx->model_count > 0 );
+  first = 0;
+
+  for ( i = 1; i < ctx->model_count; ++i ) {
+    if ( is_before( &ctx->model[ i ], &ctx->model[ first ] ) ) {
+      first = i;
+    }
+  }
+
+  the_message = _CORE_message_queue_Get_pending_message( &ctx->queue );
+  rtems_test_assert( the_message != NULL );
+  rtems_test_assert( the_message->size == sizeof( message ) );
+  memcpy( &message, the_message->buffer, sizeof( message ) );
+  _CORE_message_queue_Free_message_buffer( &ctx->queue, the_message );
+
+  rtems_test_assert( message.priority == ctx->model[ first ].priority );
+  rtems_test_assert( message.sequence == ctx->model[ first ].sequence );
+
+  --ctx->model_count;
+  ctx->model[ first ] = ctx->model[ ctx->model_count ];
+}
+
+static void receive_all( test_context *ctx )
+{
+  while ( ctx->model_count > 0 ) {
+    receive( ctx );
+  }
+
+  rtems_test_assert(
+    _CORE_message_queue_Get_pending_message( &ctx->queue ) == NULL
+  );
+  rtems_test_assert( ctx->queue.priority_level_map == 0 );
+}
+
+static int random_priority( test_context *ctx )
+{
+  return -(int) ( next_random( ctx ) % CORE_MESSAGE_QUEUE_PRIORITY_LEVELS );
+}
+
+static void test_priority_order( test_context *ctx )
+{
+  size_t i;
+
+  /* Several messages for each priority level of the index */
+  for ( i = 0; i < MAXIMUM_PENDING; ++i ) {
+    insert( ctx, random_priority( ctx ) );
+  }
+
+  receive_all( ctx );
+
+  /* Ascending and descending priorities */
+  for ( i = 0; i < CORE_MESSAGE_QUEUE_PRIORITY_LEVELS; ++i ) {
+    insert( ctx, -(int) i );
+    insert( ctx, (int) i - CORE_MESSAGE_QUEUE_PRIORITY_LEVELS + 1 );
+  }
+
+  receive_all( ctx );
+}
+
+static void test_fifo_order( test_context *ctx )
+{
+  size_t i;
+
+  for ( i = 0; i < MAXIMUM_PENDING / 2; ++i ) {
+    insert( ctx, -7 );
+    insert( ctx, -3 );
+  }
+
+  receive_all( ctx );
+}
+
+static void test_urgent_on_deep_queue( test_context *ctx )
+{
+  size_t i;
+
+  for ( i = 0; i < MAXIMUM_PENDING - 2 * URGENT_COUNT; ++i ) {
+    if ( i % 8 == 0 ) {
+      insert( ctx, CORE_MESSAGE_QUEUE_SEND_REQUEST );
+    } else {
+      insert( ctx, random_priority( ctx ) );
+    }
+  }
+
+  for ( i = 0; i < URGENT_COUNT; ++i ) {
+    insert( ctx, CORE_MESSAGE_QUEUE_URGENT_REQUEST );
+  }
+
+  /*
+   * Priority messages inserted after the urgent messages shall be received
+   * after the urgent messages, even if the index has no pending message of
+   * a higher priority.
+   */
+  for ( i = 0; i < URGENT_COUNT; ++i ) {
+    insert( ctx, 0 );
+  }
+
+  receive_all( ctx );
+}
+
+static void test_out_of_index_priorities( test_context *ctx )
+{
+  size_t i;
+
+  for ( i = 0; i < MAXIMUM_PENDING / 4; ++i ) {
+    insert( ctx, random_priority( ctx ) );
+    insert( ctx, -CORE_MESSAGE_QUEUE_PRIORITY_LEVELS - (int) ( i % 4 ) );
+    insert( ctx, 1 + (int) ( i % 4 ) );
+    insert( ctx, random_priority( ctx ) );
+  }
+
+  receive_all( ctx );
+}
+
+static void test_random_operations( test_context *ctx )
+{
+  size_t i;
+
+  for ( i = 0; i < RANDOM_OPERATIONS; ++i ) {
+    uint32_t operation;
+
+    operation = next_random( ctx ) % 8;
+
+    if ( ctx->model_count == MAXIMUM_PENDING ) {
+      operation = 0;
+    } else if ( ctx->model_count == 0 ) {
+      operation = 7;
+    }
+
+    if ( operation < 3 ) {
+      receive( ctx );
+    } else if ( operation == 3 ) {
+      insert( ctx, CORE_MESSAGE_QUEUE_URGENT_REQUEST );
+    } else if ( operation == 4 ) {
+      insert( ctx, CORE_MESSAGE_QUEUE_SEND_REQUEST );
+    } else {
+      insert( ctx, random_priority( ctx ) );
+    }
+  }
+
+  receive_all( ctx );
+}
+
+static rtems_task Init( rtems_task_argument arg )
+{
+  test_context  *ctx;
+  Status_Control status;
+
+  (void) arg;
+
+  TEST_BEGIN();
+  ctx = &test_instance;
+  ctx->random = 1;
+
+  status = _CORE_message_queue_Initialize(
+    &ctx->queue,
+    CORE_MESSAGE_QUEUE_DISCIPLINES_FIFO,
+    MAXIMUM_PENDING,
+    sizeof( test_message ),
+    allocate_buffers,
+    NULL
+  );
+  rtems_test_assert( status == STATUS_SUCCESSFUL );
+
+  test_priority_order( ctx );
+  test_fifo_order( ctx );
+  test_urgent_on_deep_queue( ctx );
+  test_out_of_index_priorities( ctx );
+  test_random_operations( ctx );
+
+  free( ctx->queue.message_buffers );
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
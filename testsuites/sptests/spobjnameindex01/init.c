@@ -0,0 +1,224 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <errno.h>
+#include <fcntl.h>
+#include <semaphore.h>
+
+#include <rtems.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SPOBJNAMEINDEX 1";
+
+#define SEMAPHORE_COUNT 12
+
+#define SEMAPHORES_PER_ALLOCATION 4
+
+static rtems_name semaphore_name( int i )
+{
+  return rtems_build_name( 'S', 'E', 'M', 'A' + i );
+}
+
+static rtems_id create_semaphore( rtems_name name )
+{
+  rtems_status_code sc;
+  rtems_id          id;
+
+  sc = rtems_semaphore_create(
+    name,
+    0,
+    RTEMS_COUNTING_SEMAPHORE,
+    0,
+    &id
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  return id;
+}
+
+static void delete_semaphore( rtems_id id )
+{
+  rtems_status_code sc;
+
+  sc = rtems_semaphore_delete( id );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void assert_ident( rtems_name name, rtems_id expected_id )
+{
+  rtems_status_code sc;
+  rtems_id          id;
+
+  id = 0;
+  sc = rtems_semaphore_ident( name, RTEMS_SEARCH_LOCAL_NODE, &id );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( id == expected_id );
+}
+
+static void assert_no_ident( rtems_name name )
+{
+  rtems_status_code sc;
+  rtems_id          id;
+
+  sc = rtems_semaphore_ident( name, RTEMS_SEARCH_LOCAL_NODE, &id );
+  rtems_test_assert( sc == RTEMS_INVALID_NAME );
+}
+
+static void test_classic_names( void )
+{
+  rtems_status_code sc;
+  rtems_id          ids[ SEMAPHORE_COUNT ];
+  rtems_id          duplicate;
+  int               i;
+
+  /* Create more semaphores than initially configured to extend the index */
+  for ( i = 0; i < SEMAPHORE_COUNT; ++i ) {
+    ids[ i ] = create_semaphore( semaphore_name( i ) );
+  }
+
+  for ( i = 0; i < SEMAPHORE_COUNT; ++i ) {
+    assert_ident( semaphore_name( i ), ids[ i ] );
+  }
+
+  assert_no_ident( rtems_build_name( 'N', 'O', 'N', 'E' ) );
+
+  /* The object with the lowest index is found for duplicate names */
+  delete_semaphore( ids[ 1 ] );
+  duplicate = create_semaphore( semaphore_name( 5 ) );
+  rtems_test_assert( rtems_object_id_get_index( duplicate ) <
+                     rtems_object_id_get_index( ids[ 5 ] ) );
+  assert_ident( semaphore_name( 5 ), duplicate );
+  delete_semaphore( duplicate );
+  assert_ident( semaphore_name( 5 ), ids[ 5 ] );
+  assert_no_ident( semaphore_name( 1 ) );
+  ids[ 1 ] = create_semaphore( semaphore_name( 1 ) );
+  assert_ident( semaphore_name( 1 ), ids[ 1 ] );
+
+  /* A new name replaces the previous name in the index */
+  sc = rtems_object_set_name( ids[ 3 ], "NEW" );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  assert_no_ident( semaphore_name( 3 ) );
+  assert_ident( rtems_build_name( 'N', 'E', 'W', ' ' ), ids[ 3 ] );
+
+  for ( i = 0; i < SEMAPHORE_COUNT; ++i ) {
+    delete_semaphore( ids[ i ] );
+  }
+
+  for ( i = 0; i < SEMAPHORE_COUNT; ++i ) {
+    assert_no_ident( semaphore_name( i ) );
+  }
+
+  assert_no_ident( rtems_build_name( 'N', 'E', 'W', ' ' ) );
+}
+
+static void test_posix_names( void )
+{
+  sem_t *a;
+  sem_t *b;
+  sem_t *c;
+  int    rv;
+
+  a = sem_open( "/a", O_CREAT | O_EXCL, 0777, 0 );
+  rtems_test_assert( a != SEM_FAILED );
+
+  b = sem_open( "/b", O_CREAT | O_EXCL, 0777, 0 );
+  rtems_test_assert( b != SEM_FAILED );
+
+  c = sem_open( "/a", 0 );
+  rtems_test_assert( c == a );
+
+  c = sem_open( "/b", O_CREAT | O_EXCL, 0777, 0 );
+  rtems_test_assert( c == SEM_FAILED );
+  rtems_test_assert( errno == EEXIST );
+
+  rv = sem_unlink( "/a" );
+  rtems_test_assert( rv == 0 );
+
+  errno = 0;
+  c = sem_open( "/a", 0 );
+  rtems_test_assert( c == SEM_FAILED );
+  rtems_test_assert( errno == ENOENT );
+
+  c = sem_open( "/b", 0 );
+  rtems_test_assert( c == b );
+
+  rv = sem_close( a );
+  rtems_test_assert( rv == 0 );
+
+  rv = sem_close( b );
+  rtems_test_assert( rv == 0 );
+
+  rv = sem_close( c );
+  rtems_test_assert( rv == 0 );
+
+  rv = sem_unlink( "/b" );
+  rtems_test_assert( rv == 0 );
+
+  errno = 0;
+  c = sem_open( "/b", 0 );
+  rtems_test_assert( c == SEM_FAILED );
+  rtems_test_assert( errno == ENOENT );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  (void) arg;
+
+  TEST_BEGIN();
+
+  test_classic_names();
+  test_posix_names();
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_MAXIMUM_SEMAPHORES \
+  rtems_resource_name_index(         \
+    rtems_resource_unlimited( SEMAPHORES_PER_ALLOCATION ) )
+
+#define CONFIGURE_MAXIMUM_POSIX_SEMAPHORES rtems_resource_name_index( 2 )
+
+#define CONFIGURE_UNIFIED_WORK_AREAS
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
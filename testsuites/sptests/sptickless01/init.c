@@ -0,0 +1,263 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <time.h>
+
+#include <rtems.h>
+#include <rtems/score/percpu.h>
+#include <rtems/score/watchdogimpl.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SPTICKLESS 1";
+
+#define EVENT RTEMS_EVENT_0
+
+typedef struct {
+  rtems_id      init;
+  rtems_id      timer;
+  rtems_id      worker;
+  volatile bool worker_ran;
+} test_context;
+
+static test_context test_instance;
+
+static uint64_t nanoseconds_per_tick( void )
+{
+  return (uint64_t) rtems_configuration_get_nanoseconds_per_tick();
+}
+
+static void test_wake_after( void )
+{
+  static const rtems_interval intervals[] = { 1, 2, 5, 37, 100 };
+  size_t                      i;
+
+  for ( i = 0; i < RTEMS_ARRAY_SIZE( intervals ); ++i ) {
+    rtems_interval    interval;
+    rtems_interval    t0;
+    rtems_interval    t1;
+    uint64_t          u0;
+    uint64_t          u1;
+    rtems_status_code sc;
+
+    interval = intervals[ i ];
+    t0 = rtems_clock_get_ticks_since_boot();
+    u0 = rtems_clock_get_uptime_nanoseconds();
+
+    sc = rtems_task_wake_after( interval );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+    t1 = rtems_clock_get_ticks_since_boot();
+    u1 = rtems_clock_get_uptime_nanoseconds();
+
+    rtems_test_assert( t1 - t0 >= interval );
+    rtems_test_assert( t1 - t0 <= interval + 1 );
+    rtems_test_assert( u1 - u0 > ( interval - 1 ) * nanoseconds_per_tick() );
+  }
+}
+
+static void timer_routine( rtems_id timer, void *arg )
+{
+  test_context     *ctx;
+  rtems_status_code sc;
+
+  (void) timer;
+  ctx = arg;
+
+  sc = rtems_event_send( ctx->init, EVENT );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void test_timer( test_context *ctx )
+{
+  rtems_status_code sc;
+  rtems_event_set   events;
+  rtems_interval    t0;
+  rtems_interval    t1;
+  uint32_t          next;
+
+  sc = rtems_timer_create(
+    rtems_build_name( 'T', 'I', 'M', 'R' ),
+    &ctx->timer
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  t0 = rtems_clock_get_ticks_since_boot();
+
+  sc = rtems_timer_fire_after( ctx->timer, 50, timer_routine, ctx );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  /* The idle thread programs the clock interrupt for this expiration */
+  next = _Watchdog_Ticks_to_next_expiration( _Per_CPU_Get_by_index( 0 ), 100 );
+  rtems_test_assert( next <= 50 );
+  rtems_test_assert( next >= 49 );
+  next = _Watchdog_Ticks_to_next_expiration( _Per_CPU_Get_by_index( 0 ), 10 );
+  rtems_test_assert( next == 10 );
+
+  events = 0;
+  sc = rtems_event_receive( EVENT, RTEMS_WAIT | RTEMS_EVENT_ALL, 100, &events );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( events == EVENT );
+
+  t1 = rtems_clock_get_ticks_since_boot();
+  rtems_test_assert( t1 - t0 >= 50 );
+  rtems_test_assert( t1 - t0 <= 51 );
+
+  sc = rtems_timer_delete( ctx->timer );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void test_clock_nanosleep( void )
+{
+  struct timespec target;
+  struct timespec now;
+  int             eno;
+
+  eno = clock_gettime( CLOCK_MONOTONIC, &target );
+  rtems_test_assert( eno == 0 );
+
+  target.tv_nsec += 250000000;
+
+  if ( target.tv_nsec >= 1000000000 ) {
+    target.tv_nsec -= 1000000000;
+    ++target.tv_sec;
+  }
+
+  eno = clock_nanosleep( CLOCK_MONOTONIC, TIMER_ABSTIME, &target, NULL );
+  rtems_test_assert( eno == 0 );
+
+  eno = clock_gettime( CLOCK_MONOTONIC, &now );
+  rtems_test_assert( eno == 0 );
+  rtems_test_assert(
+    now.tv_sec > target.tv_sec ||
+      ( now.tv_sec == target.tv_sec && now.tv_nsec >= target.tv_nsec )
+  );
+}
+
+static void worker_task( rtems_task_argument arg )
+{
+  test_context *ctx;
+
+  ctx = (test_context *) arg;
+  ctx->worker_ran = true;
+  rtems_task_exit();
+}
+
+static void test_timeslice( test_context *ctx )
+{
+  rtems_status_code sc;
+  rtems_mode        mode;
+  rtems_interval    t0;
+  rtems_interval    t1;
+
+  sc = rtems_task_create(
+    rtems_build_name( 'W', 'O', 'R', 'K' ),
+    2,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_TIMESLICE,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &ctx->worker
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_task_mode( RTEMS_TIMESLICE, RTEMS_TIMESLICE_MASK, &mode );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  /* Let the processor idle while this task uses timeslicing */
+  t0 = rtems_clock_get_ticks_since_boot();
+  sc = rtems_task_wake_after( 10 );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  t1 = rtems_clock_get_ticks_since_boot();
+  rtems_test_assert( t1 - t0 >= 10 );
+  rtems_test_assert( t1 - t0 <= 11 );
+
+  sc = rtems_task_start( ctx->worker, worker_task, (rtems_task_argument) ctx );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  /*
+   * The worker may only run after the timeslice of this task expired.  The
+   * idle period shall not affect the timeslice.
+   */
+  t0 = rtems_clock_get_ticks_since_boot();
+
+  while ( !ctx->worker_ran ) {
+    /* Wait */
+  }
+
+  t1 = rtems_clock_get_ticks_since_boot();
+  rtems_test_assert(
+    t1 - t0 <= rtems_configuration_get_ticks_per_timeslice() + 1
+  );
+
+  sc = rtems_task_mode( mode, RTEMS_TIMESLICE_MASK, &mode );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  test_context *ctx;
+
+  (void) arg;
+  ctx = &test_instance;
+  ctx->init = rtems_task_self();
+
+  TEST_BEGIN();
+
+  test_wake_after();
+  test_timer( ctx );
+  test_clock_nanosleep();
+  test_timeslice( ctx );
+  test_wake_after();
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_MAXIMUM_TIMERS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_INIT_TASK_PRIORITY 2
+
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -42,6 +42,7 @@
 #include "system.h"
 
 #include <rtems/score/watchdogimpl.h>
+#include <rtems/score/chainimpl.h>
 
 const char rtems_test_name[] = "SPWATCHDOG";
 
@@ -247,6 +248,196 @@ static void test_watchdog_operations( void )
   _Watchdog_Header_destroy( &header );
 }
 
+static Watchdog_Wheel test_wheel;
+
+static void test_watchdog_wheel_tick( Watchdog_Wheel *wheel, uint64_t now )
+{
+#if ISR_LOCK_NEEDS_OBJECT
+  ISR_lock_Control lock = ISR_LOCK_INITIALIZER( "Test" );
+#endif
+  ISR_lock_Context lock_context;
+
+  _ISR_lock_ISR_disable_and_acquire( &lock, &lock_context );
+  _Watchdog_Wheel_tick( wheel, now, &lock, &lock_context );
+  _ISR_lock_Release_and_ISR_enable( &lock, &lock_context );
+  _ISR_lock_Destroy( &lock );
+}
+
+#define TEST_WHEEL_SPAN \
+  ( (uint64_t) 1 << ( WATCHDOG_WHEEL_LEVELS * WATCHDOG_WHEEL_BITS ) )
+
+#define TEST_WHEEL_LEVEL_3 \
+  ( (uint64_t) 1 << ( ( WATCHDOG_WHEEL_LEVELS - 1 ) * WATCHDOG_WHEEL_BITS ) )
+
+static Chain_Control *test_watchdog_wheel_slot(
+  Watchdog_Wheel *wheel,
+  int             level,
+  uint64_t        expire
+)
+{
+  uint64_t index;
+
+  index = ( expire >> ( level * WATCHDOG_WHEEL_BITS ) ) & WATCHDOG_WHEEL_MASK;
+  return &wheel->Slots[ level ][ index ];
+}
+
+static void test_watchdog_wheel( void )
+{
+  Watchdog_Header header;
+  Watchdog_Wheel *wheel;
+  size_t          level;
+  size_t          slot;
+  uint64_t        start;
+  test_watchdog   a;
+  test_watchdog   b;
+  test_watchdog   c;
+  test_watchdog   d;
+  test_watchdog   e;
+  test_watchdog   f;
+
+  wheel = &test_wheel;
+  wheel->count = 0;
+
+  for ( level = 0; level < WATCHDOG_WHEEL_LEVELS; ++level ) {
+    for ( slot = 0; slot < WATCHDOG_WHEEL_SLOTS; ++slot ) {
+      _Chain_Initialize_empty( &wheel->Slots[ level ][ slot ] );
+    }
+  }
+
+  _Chain_Initialize_empty( &wheel->Overflow );
+
+  _Watchdog_Header_initialize( &header );
+  rtems_test_assert( _Watchdog_Header_is_empty( &header ) );
+  header.wheel = wheel;
+  rtems_test_assert( _Watchdog_Header_is_empty( &header ) );
+
+  test_watchdog_init( &a, 10 );
+  test_watchdog_init( &b, 20 );
+  test_watchdog_init( &c, 30 );
+  test_watchdog_init( &d, 40 );
+  test_watchdog_init( &e, 50 );
+  test_watchdog_init( &f, 60 );
+
+  /*
+   * The test starts shortly before the end of the wheel span, so that all
+   * levels and the overflow chain are cascaded within a few ticks.  The
+   * watchdog f is inserted at a time which places it on the last level.  No
+   * slot in between contains a watchdog, so the wheel time may be advanced
+   * directly.
+   */
+  wheel->time = TEST_WHEEL_SPAN - TEST_WHEEL_LEVEL_3;
+  _Watchdog_Insert( &header, &f.Base, TEST_WHEEL_SPAN + 3 );
+  rtems_test_assert(
+    _Chain_Has_only_one_node(
+      test_watchdog_wheel_slot( wheel, 3, TEST_WHEEL_SPAN + 3 )
+    )
+  );
+
+  start = TEST_WHEEL_SPAN - 70;
+  wheel->time = start;
+
+  _Watchdog_Insert( &header, &a.Base, start + 1 );
+  _Watchdog_Insert( &header, &b.Base, TEST_WHEEL_SPAN - 1 );
+  _Watchdog_Insert( &header, &c.Base, start + TEST_WHEEL_LEVEL_3 + 1 );
+  _Watchdog_Insert( &header, &d.Base, start + TEST_WHEEL_SPAN + 7 );
+  _Watchdog_Insert( &header, &e.Base, TEST_WHEEL_SPAN + 5 );
+  rtems_test_assert( !_Watchdog_Header_is_empty( &header ) );
+  rtems_test_assert( wheel->count == 6 );
+  rtems_test_assert(
+    _Chain_Has_only_one_node( test_watchdog_wheel_slot( wheel, 0, start + 1 ) )
+  );
+  rtems_test_assert(
+    _Chain_Has_only_one_node(
+      test_watchdog_wheel_slot( wheel, 1, TEST_WHEEL_SPAN - 1 )
+    )
+  );
+  rtems_test_assert(
+    _Chain_Node_count_unprotected(
+      test_watchdog_wheel_slot( wheel, 3, start + TEST_WHEEL_LEVEL_3 + 1 )
+    ) == 2
+  );
+  rtems_test_assert(
+    _Chain_Has_only_one_node(
+      test_watchdog_wheel_slot( wheel, 1, TEST_WHEEL_SPAN + 5 )
+    )
+  );
+  rtems_test_assert( _Chain_Has_only_one_node( &wheel->Overflow ) );
+
+  test_watchdog_wheel_tick( wheel, start + 1 );
+  rtems_test_assert( test_watchdog_is_inactive( &a ) );
+  rtems_test_assert( a.counter == 11 );
+  rtems_test_assert( wheel->count == 5 );
+
+  /* An expired watchdog is called in the next tick */
+  _Watchdog_Insert( &header, &a.Base, 0 );
+  test_watchdog_wheel_tick( wheel, start + 2 );
+  rtems_test_assert( a.counter == 12 );
+
+  /* The watchdog b is cascaded from level 1 to level 0 */
+  test_watchdog_wheel_tick( wheel, TEST_WHEEL_SPAN - 2 );
+  rtems_test_assert( b.counter == 20 );
+  rtems_test_assert(
+    _Chain_Has_only_one_node(
+      test_watchdog_wheel_slot( wheel, 0, TEST_WHEEL_SPAN - 1 )
+    )
+  );
+
+  test_watchdog_wheel_tick( wheel, TEST_WHEEL_SPAN - 1 );
+  rtems_test_assert( test_watchdog_is_inactive( &b ) );
+  rtems_test_assert( b.counter == 21 );
+
+  _Watchdog_Remove( &header, &c.Base );
+  rtems_test_assert( test_watchdog_is_inactive( &c ) );
+  rtems_test_assert( wheel->count == 3 );
+  _Watchdog_Remove( &header, &c.Base );
+  rtems_test_assert( wheel->count == 3 );
+
+  /*
+   * At the end of the wheel span, all levels and the overflow chain are
+   * cascaded.
+   */
+  test_watchdog_wheel_tick( wheel, TEST_WHEEL_SPAN );
+  rtems_test_assert( _Chain_Is_empty( &wheel->Overflow ) );
+  rtems_test_assert(
+    _Chain_Has_only_one_node(
+      test_watchdog_wheel_slot( wheel, 0, TEST_WHEEL_SPAN + 3 )
+    )
+  );
+  rtems_test_assert(
+    _Chain_Has_only_one_node(
+      test_watchdog_wheel_slot( wheel, 0, TEST_WHEEL_SPAN + 5 )
+    )
+  );
+  rtems_test_assert(
+    _Chain_Has_only_one_node(
+      test_watchdog_wheel_slot( wheel, 3, start + TEST_WHEEL_SPAN + 7 )
+    )
+  );
+  rtems_test_assert( wheel->count == 3 );
+
+  test_watchdog_wheel_tick( wheel, TEST_WHEEL_SPAN + 3 );
+  rtems_test_assert( test_watchdog_is_inactive( &f ) );
+  rtems_test_assert( f.counter == 61 );
+  rtems_test_assert( e.counter == 50 );
+
+  test_watchdog_wheel_tick( wheel, TEST_WHEEL_SPAN + 5 );
+  rtems_test_assert( test_watchdog_is_inactive( &e ) );
+  rtems_test_assert( e.counter == 51 );
+
+  rtems_test_assert( !test_watchdog_is_inactive( &d ) );
+  _Watchdog_Remove( &header, &d.Base );
+  rtems_test_assert( test_watchdog_is_inactive( &d ) );
+  rtems_test_assert( d.counter == 40 );
+  rtems_test_assert( c.counter == 30 );
+  rtems_test_assert( _Watchdog_Header_is_empty( &header ) );
+
+  /* An empty wheel is advanced without ticks */
+  test_watchdog_wheel_tick( wheel, TEST_WHEEL_SPAN + 1000 );
+  rtems_test_assert( wheel->time == TEST_WHEEL_SPAN + 1000 );
+
+  _Watchdog_Header_destroy( &header );
+}
+
 rtems_task Init( rtems_task_argument argument )
 {
   (void) argument;
@@ -257,6 +448,7 @@ rtems_task Init( rtems_task_argument argument )
   TEST_BEGIN();
 
   test_watchdog_operations();
+  test_watchdog_wheel();
   test_watchdog_static_init();
   test_watchdog_config();
 
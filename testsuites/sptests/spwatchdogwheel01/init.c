@@ -0,0 +1,215 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems.h>
+#include <rtems/score/percpu.h>
+#include <rtems/score/watchdogimpl.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SPWATCHDOGWHEEL 1";
+
+#define TIMER_COUNT 5
+
+#define REARM_COUNT 3
+
+typedef struct {
+  rtems_id       timers[ TIMER_COUNT ];
+  rtems_interval intervals[ TIMER_COUNT ];
+  rtems_interval fired_at[ TIMER_COUNT ];
+  size_t         order[ TIMER_COUNT ];
+  size_t         fired;
+  size_t         rearmed;
+} test_context;
+
+static test_context test_instance;
+
+static void timer_routine( rtems_id timer, void *arg )
+{
+  test_context *ctx;
+  size_t        i;
+
+  (void) timer;
+
+  ctx = &test_instance;
+  i = (size_t) (uintptr_t) arg;
+  ctx->fired_at[ i ] = rtems_clock_get_ticks_since_boot();
+  ctx->order[ ctx->fired ] = i;
+  ++ctx->fired;
+}
+
+static void rearm_routine( rtems_id timer, void *arg )
+{
+  test_context     *ctx;
+  rtems_status_code sc;
+
+  (void) arg;
+
+  ctx = &test_instance;
+  ++ctx->rearmed;
+
+  if ( ctx->rearmed < REARM_COUNT ) {
+    sc = rtems_timer_fire_after( timer, 1, rearm_routine, NULL );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  }
+}
+
+static rtems_interval synchronize_with_clock_tick( void )
+{
+  rtems_status_code sc;
+
+  sc = rtems_task_wake_after( 1 );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  return rtems_clock_get_ticks_since_boot();
+}
+
+static void test_wheel_is_used( void )
+{
+  Per_CPU_Control *cpu;
+
+  cpu = _Per_CPU_Get_by_index( 0 );
+  rtems_test_assert(
+    cpu->Watchdog.Header[ PER_CPU_WATCHDOG_TICKS ].wheel ==
+      &_Watchdog_Wheels[ 0 ]
+  );
+}
+
+static void test_task_delay( void )
+{
+  rtems_interval    start;
+  rtems_status_code sc;
+
+  start = synchronize_with_clock_tick();
+  sc = rtems_task_wake_after( 5 );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( rtems_clock_get_ticks_since_boot() - start == 5 );
+}
+
+static void test_timers( test_context *ctx )
+{
+  static const size_t expected_order[] = { 1, 0, 3, 4 };
+  rtems_interval      start;
+  rtems_status_code   sc;
+  size_t              i;
+
+  /*
+   * The intervals of more than 64 clock ticks place the timers on the second
+   * level of the wheel.  They are cascaded to the first level before they
+   * fire.
+   */
+  ctx->intervals[ 0 ] = 3;
+  ctx->intervals[ 1 ] = 1;
+  ctx->intervals[ 2 ] = 10;
+  ctx->intervals[ 3 ] = 70;
+  ctx->intervals[ 4 ] = 71;
+
+  for ( i = 0; i < TIMER_COUNT; ++i ) {
+    sc = rtems_timer_create(
+      rtems_build_name( 'T', 'I', 'M', 'R' ),
+      &ctx->timers[ i ]
+    );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  }
+
+  start = synchronize_with_clock_tick();
+
+  for ( i = 0; i < TIMER_COUNT; ++i ) {
+    sc = rtems_timer_fire_after(
+      ctx->timers[ i ],
+      ctx->intervals[ i ],
+      timer_routine,
+      (void *) (uintptr_t) i
+    );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  }
+
+  /* A canceled timer does not fire */
+  sc = rtems_timer_cancel( ctx->timers[ 2 ] );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_task_wake_after( 80 );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  rtems_test_assert( ctx->fired == RTEMS_ARRAY_SIZE( expected_order ) );
+
+  for ( i = 0; i < ctx->fired; ++i ) {
+    size_t j;
+
+    j = expected_order[ i ];
+    rtems_test_assert( ctx->order[ i ] == j );
+    rtems_test_assert( ctx->fired_at[ j ] - start == ctx->intervals[ j ] );
+  }
+
+  /* A timer may be rearmed by its routine */
+  sc = rtems_timer_fire_after( ctx->timers[ 0 ], 1, rearm_routine, NULL );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_task_wake_after( REARM_COUNT + 1 );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( ctx->rearmed == REARM_COUNT );
+
+  for ( i = 0; i < TIMER_COUNT; ++i ) {
+    sc = rtems_timer_delete( ctx->timers[ i ] );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  }
+}
+
+static void Init( rtems_task_argument arg )
+{
+  (void) arg;
+
+  TEST_BEGIN();
+
+  test_wheel_is_used();
+  test_task_delay();
+  test_timers( &test_instance );
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_MAXIMUM_TIMERS TIMER_COUNT
+
+#define CONFIGURE_WATCHDOG_TIMER_WHEEL
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
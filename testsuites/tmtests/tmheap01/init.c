@@ -0,0 +1,284 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+#include <rtems/score/heapfirstfitimpl.h>
+
+const char rtems_test_name[] = "TMHEAP 1";
+
+#define AREA_SIZE ( 256 * 1024 )
+
+#define BLOCK_COUNT 512
+
+#define SAMPLE_COUNT 256
+
+#define MIN_SIZE 8
+
+#define MAX_SIZE 192
+
+/*
+ * All allocations shall succeed, even if no block is freed before the timed
+ * allocations.  Account for the block header and the alignment of each
+ * allocation.
+ */
+RTEMS_STATIC_ASSERT(
+  ( BLOCK_COUNT + SAMPLE_COUNT ) *
+    ( MAX_SIZE + HEAP_BLOCK_HEADER_SIZE + CPU_HEAP_ALIGNMENT ) <
+    AREA_SIZE - 4096,
+  AREA_SIZE
+);
+
+typedef struct {
+  Heap_Control        heap;
+  Heap_Segregated_fit segregated_fit;
+  uint32_t            seed;
+  void               *blocks[ BLOCK_COUNT ];
+  void               *samples[ SAMPLE_COUNT ];
+  rtems_counter_ticks alloc_ticks[ SAMPLE_COUNT ];
+  rtems_counter_ticks free_ticks[ SAMPLE_COUNT ];
+  uint32_t            area[ AREA_SIZE / sizeof( uint32_t ) ];
+} test_context;
+
+static test_context test_instance;
+
+static const char *sep = "\n    ";
+
+static uint32_t next_random( test_context *ctx )
+{
+  ctx->seed = ctx->seed * 1103515245U + 12345U;
+  return ctx->seed >> 16;
+}
+
+static uintptr_t random_size( test_context *ctx )
+{
+  return MIN_SIZE + next_random( ctx ) % ( MAX_SIZE - MIN_SIZE );
+}
+
+static int compare_ticks( const void *ap, const void *bp )
+{
+  rtems_counter_ticks a = *(const rtems_counter_ticks *) ap;
+  rtems_counter_ticks b = *(const rtems_counter_ticks *) bp;
+
+  return ( a > b ) - ( a < b );
+}
+
+static void print_distribution( const char *name, rtems_counter_ticks *ticks )
+{
+  qsort( ticks, SAMPLE_COUNT, sizeof( ticks[ 0 ] ), compare_ticks );
+
+  printf(
+    ",\n      \"%s\": {\n"
+    "        \"min\": %" PRIu64 ",\n"
+    "        \"median\": %" PRIu64 ",\n"
+    "        \"p99\": %" PRIu64 ",\n"
+    "        \"max\": %" PRIu64 "\n"
+    "      }",
+    name,
+    rtems_counter_ticks_to_nanoseconds( ticks[ 0 ] ),
+    rtems_counter_ticks_to_nanoseconds( ticks[ SAMPLE_COUNT / 2 ] ),
+    rtems_counter_ticks_to_nanoseconds( ticks[ ( SAMPLE_COUNT * 99 ) / 100 ] ),
+    rtems_counter_ticks_to_nanoseconds( ticks[ SAMPLE_COUNT - 1 ] )
+  );
+}
+
+/*
+ * Fill the heap with blocks of random sizes and free the specified percentage
+ * of them at random positions.  This produces a free list with many free
+ * blocks of different sizes.
+ */
+static void fragment( test_context *ctx, uint32_t percent )
+{
+  Heap_Control *heap;
+  size_t        i;
+
+  heap = &ctx->heap;
+
+  for ( i = 0; i < BLOCK_COUNT; ++i ) {
+    ctx->blocks[ i ] = _Heap_Allocate( heap, random_size( ctx ) );
+    rtems_test_assert( ctx->blocks[ i ] != NULL );
+  }
+
+  for ( i = 0; i < BLOCK_COUNT; ++i ) {
+    if ( next_random( ctx ) % 100 < percent ) {
+      bool ok;
+
+      ok = _Heap_Free( heap, ctx->blocks[ i ] );
+      rtems_test_assert( ok );
+      ctx->blocks[ i ] = NULL;
+    }
+  }
+}
+
+static void test_case(
+  test_context *ctx,
+  bool          segregated_fit,
+  uint32_t      percent
+)
+{
+  Heap_Control         *heap;
+  uintptr_t             size;
+  Heap_Information_block info;
+  uint32_t              searches;
+  uint32_t              max_search;
+  size_t                i;
+  bool                  ok;
+
+  heap = &ctx->heap;
+  ctx->seed = 1;
+
+  size = _Heap_Initialize( heap, ctx->area, sizeof( ctx->area ), 0 );
+  rtems_test_assert( size > 0 );
+
+  if ( segregated_fit ) {
+    _Heap_Set_segregated_fit( heap, &ctx->segregated_fit );
+  }
+
+  fragment( ctx, percent );
+  _Heap_Get_information( heap, &info );
+  searches = heap->stats.searches;
+  heap->stats.max_search = 0;
+
+  for ( i = 0; i < SAMPLE_COUNT; ++i ) {
+    rtems_interrupt_level level;
+    rtems_counter_ticks   a;
+    rtems_counter_ticks   b;
+    void                 *p;
+
+    size = random_size( ctx );
+
+    rtems_interrupt_local_disable( level );
+    a = rtems_counter_read();
+    p = _Heap_Allocate( heap, size );
+    b = rtems_counter_read();
+    rtems_interrupt_local_enable( level );
+
+    rtems_test_assert( p != NULL );
+    ctx->alloc_ticks[ i ] = rtems_counter_difference( b, a );
+    ctx->samples[ i ] = p;
+  }
+
+  searches = heap->stats.searches - searches;
+  max_search = heap->stats.max_search;
+
+  for ( i = 0; i < SAMPLE_COUNT; ++i ) {
+    rtems_interrupt_level level;
+    rtems_counter_ticks   a;
+    rtems_counter_ticks   b;
+
+    rtems_interrupt_local_disable( level );
+    a = rtems_counter_read();
+    ok = _Heap_Free( heap, ctx->samples[ i ] );
+    b = rtems_counter_read();
+    rtems_interrupt_local_enable( level );
+
+    rtems_test_assert( ok );
+    ctx->free_ticks[ i ] = rtems_counter_difference( b, a );
+  }
+
+  ok = _Heap_Walk( heap, 0, false );
+  rtems_test_assert( ok );
+
+  printf(
+    "%s{\n"
+    "      \"method\": \"%s\",\n"
+    "      \"fragmentation-percent\": %" PRIu32 ",\n"
+    "      \"free-blocks\": %" PRIuPTR ",\n"
+    "      \"searches-per-allocation\": %" PRIu32 ",\n"
+    "      \"max-search\": %" PRIu32,
+    sep,
+    segregated_fit ? "segregated-fit" : "first-fit",
+    percent,
+    info.Free.number,
+    searches / SAMPLE_COUNT,
+    max_search
+  );
+  sep = "\n    }, ";
+
+  print_distribution( "allocate", ctx->alloc_ticks );
+  print_distribution( "free", ctx->free_ticks );
+}
+
+static void test( void )
+{
+  test_context  *ctx;
+  uint32_t       percent;
+
+  ctx = &test_instance;
+
+  printf(
+    "*** BEGIN OF JSON DATA ***\n"
+    "{\n"
+    "  \"samples\": ["
+  );
+
+  for ( percent = 0; percent <= 90; percent += 15 ) {
+    test_case( ctx, false, percent );
+    test_case( ctx, true, percent );
+  }
+
+  printf( "\n    }\n  ]\n}\n*** END OF JSON DATA ***\n" );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  (void) arg;
+
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_WORKSPACE_SEGREGATED_FIT
+
+#define CONFIGURE_MALLOC_SEGREGATED_FIT
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,279 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+
+const char rtems_test_name[] = "TMMSGQ 1";
+
+#define MESSAGE_COUNT 64
+
+#define MESSAGE_SIZE 16
+
+#define ROUND_COUNT 32
+
+typedef struct {
+  rtems_id queue;
+  size_t   sizes[ MESSAGE_COUNT ];
+  char     messages[ MESSAGE_COUNT * MESSAGE_SIZE ];
+} test_context;
+
+static test_context test_instance;
+
+static void send_single( test_context *ctx, uint32_t batch )
+{
+  rtems_status_code sc;
+  uint32_t          i;
+
+  for ( i = 0; i < batch; ++i ) {
+    sc = rtems_message_queue_send(
+      ctx->queue,
+      &ctx->messages[ i * MESSAGE_SIZE ],
+      MESSAGE_SIZE
+    );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  }
+}
+
+static void receive_single( test_context *ctx, uint32_t batch )
+{
+  rtems_status_code sc;
+  uint32_t          i;
+
+  for ( i = 0; i < batch; ++i ) {
+    sc = rtems_message_queue_receive(
+      ctx->queue,
+      &ctx->messages[ i * MESSAGE_SIZE ],
+      &ctx->sizes[ i ],
+      RTEMS_NO_WAIT,
+      0
+    );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  }
+}
+
+static void send_multiple( test_context *ctx, uint32_t batch )
+{
+  rtems_status_code sc;
+  uint32_t          count;
+
+  count = batch;
+  sc = rtems_message_queue_send_multiple(
+    ctx->queue,
+    ctx->messages,
+    ctx->sizes,
+    &count
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( count == batch );
+}
+
+static void receive_multiple( test_context *ctx, uint32_t batch )
+{
+  rtems_status_code sc;
+  uint32_t          count;
+
+  count = batch;
+  sc = rtems_message_queue_receive_multiple(
+    ctx->queue,
+    ctx->messages,
+    ctx->sizes,
+    &count,
+    RTEMS_NO_WAIT,
+    0
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( count == batch );
+}
+
+static uint64_t measure(
+  test_context *ctx,
+  uint32_t      batch,
+  void       ( *send )( test_context *, uint32_t ),
+  void       ( *receive )( test_context *, uint32_t ),
+  uint64_t     *receive_ns
+)
+{
+  rtems_counter_ticks send_ticks;
+  rtems_counter_ticks receive_ticks;
+  uint32_t            round;
+  uint32_t            messages;
+
+  send_ticks = 0;
+  receive_ticks = 0;
+
+  for ( round = 0; round < ROUND_COUNT; ++round ) {
+    uint32_t            i;
+    rtems_counter_ticks a;
+    rtems_counter_ticks b;
+
+    a = rtems_counter_read();
+
+    for ( i = 0; i < MESSAGE_COUNT; i += batch ) {
+      ( *send )( ctx, batch );
+    }
+
+    b = rtems_counter_read();
+    send_ticks += rtems_counter_difference( b, a );
+    a = rtems_counter_read();
+
+    for ( i = 0; i < MESSAGE_COUNT; i += batch ) {
+      ( *receive )( ctx, batch );
+    }
+
+    b = rtems_counter_read();
+    receive_ticks += rtems_counter_difference( b, a );
+  }
+
+  messages = ROUND_COUNT * MESSAGE_COUNT;
+  *receive_ns = rtems_counter_ticks_to_nanoseconds( receive_ticks ) / messages;
+  return rtems_counter_ticks_to_nanoseconds( send_ticks ) / messages;
+}
+
+static void test_batch( test_context *ctx, uint32_t batch, const char *sep )
+{
+  uint64_t send_single_ns;
+  uint64_t receive_single_ns;
+  uint64_t send_multiple_ns;
+  uint64_t receive_multiple_ns;
+
+  send_single_ns = measure(
+    ctx,
+    batch,
+    send_single,
+    receive_single,
+    &receive_single_ns
+  );
+  send_multiple_ns = measure(
+    ctx,
+    batch,
+    send_multiple,
+    receive_multiple,
+    &receive_multiple_ns
+  );
+
+  printf(
+    "%s{\n"
+    "      \"batch-size\": %" PRIu32 ",\n"
+    "      \"send-ns-per-message\": %" PRIu64 ",\n"
+    "      \"receive-ns-per-message\": %" PRIu64 ",\n"
+    "      \"send-multiple-ns-per-message\": %" PRIu64 ",\n"
+    "      \"receive-multiple-ns-per-message\": %" PRIu64 "\n"
+    "    }",
+    sep,
+    batch,
+    send_single_ns,
+    receive_single_ns,
+    send_multiple_ns,
+    receive_multiple_ns
+  );
+}
+
+static void test( void )
+{
+  test_context     *ctx;
+  rtems_status_code sc;
+  const char       *sep;
+  uint32_t          batch;
+  uint32_t          i;
+
+  ctx = &test_instance;
+
+  for ( i = 0; i < MESSAGE_COUNT; ++i ) {
+    ctx->sizes[ i ] = MESSAGE_SIZE;
+    memset( &ctx->messages[ i * MESSAGE_SIZE ], (int) i, MESSAGE_SIZE );
+  }
+
+  sc = rtems_message_queue_create(
+    rtems_build_name( 'M', 'S', 'G', 'Q' ),
+    MESSAGE_COUNT,
+    MESSAGE_SIZE,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &ctx->queue
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  printf(
+    "*** BEGIN OF JSON DATA ***\n"
+    "{\n"
+    "  \"message-size\": %d,\n"
+    "  \"samples\": [\n    ",
+    MESSAGE_SIZE
+  );
+
+  sep = "";
+
+  for ( batch = 1; batch <= MESSAGE_COUNT; batch *= 2 ) {
+    test_batch( ctx, batch, sep );
+    sep = ", ";
+  }
+
+  printf( "\n  ]\n}\n*** END OF JSON DATA ***\n" );
+
+  sc = rtems_message_queue_delete( ctx->queue );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  (void) arg;
+
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_MAXIMUM_MESSAGE_QUEUES 1
+
+#define CONFIGURE_MESSAGE_BUFFER_MEMORY \
+  CONFIGURE_MESSAGE_BUFFERS_FOR_QUEUE( MESSAGE_COUNT, MESSAGE_SIZE )
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
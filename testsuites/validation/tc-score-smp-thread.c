@@ -691,7 +691,7 @@ static void ScoreThreadValSmp_Action_2( ScoreThreadValSmp_Context *ctx )
   _ISR_lock_ISR_enable( &ctx->worker_a_wait_default_lock_context );
 
   SendEvents( ctx->worker_b_id, EVENT_B_OBTAIN );
-  TicketLockWaitForOthers( &worker_a->Wait.Lock.Default.Lock.Ticket_lock, 1 );
+  ISRLockWaitForOthers( &worker_a->Wait.Lock.Default, 1 );
 
   release_worker_a_wait_default = ctx;
 
@@ -551,18 +551,22 @@ static void ThreadDelete( rtems_tcb *executing, rtems_tcb *deleted )
 static void PreemptionIntervention( void *arg )
 {
   Context     *ctx;
+#if !defined(RTEMS_SMP_QUEUED_LOCK)
   unsigned int ticket;
+#endif
 
   ctx = arg;
   T_false( ctx->zombie_ready );
   ctx->zombie_ready = true;
 
+#if !defined(RTEMS_SMP_QUEUED_LOCK)
   do {
     ticket = _Atomic_Load_uint(
       &_Thread_Zombies.Lock.Lock.Ticket_lock.now_serving,
       ATOMIC_ORDER_RELAXED
     );
   } while ( ( ticket - ctx->thread_zombie_ticket ) < 2 );
+#endif
 
   T_busy( 100 );
 }
@@ -582,13 +586,16 @@ static void ThreadTerminate( rtems_tcb *executing )
      * dispatch and provoke an executing thread in
      * _Thread_Kill_zombies().  The first acquire is done in the
      * rtems_task_exit() below.  The second acquire is done in
-     * _Thread_Kill_zombies().
+     * _Thread_Kill_zombies().  The queued lock provides no acquire count, so
+     * in this case only the busy wait delays the thread dispatch.
      */
+#if !defined(RTEMS_SMP_QUEUED_LOCK)
     ctx->thread_zombie_ticket = _Atomic_Fetch_add_uint(
       &_Thread_Zombies.Lock.Lock.Ticket_lock.now_serving,
       0,
       ATOMIC_ORDER_RELAXED
     );
+#endif
     SetPreemptionIntervention(
       _Per_CPU_Get_snapshot(),
       PreemptionIntervention,
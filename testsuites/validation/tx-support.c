@@ -1079,4 +1079,40 @@ void TicketLockWaitForReleases(
   } while ( expected != actual );
 }
 
+#if defined(RTEMS_SMP_QUEUED_LOCK)
+bool QueuedLockIsAvailable( const SMP_queued_lock_Control *lock )
+{
+  return _Atomic_Load_uint( &lock->value, ATOMIC_ORDER_RELAXED ) == 0;
+}
+
+void QueuedLockWaitForOwned( const SMP_queued_lock_Control *lock )
+{
+  while ( QueuedLockIsAvailable( lock ) ) {
+    /* Wait */
+  }
+}
+
+void QueuedLockWaitForOthers(
+  const SMP_queued_lock_Control *lock,
+  unsigned int                   others
+)
+{
+  unsigned int value;
+  unsigned int actual;
+
+  do {
+    value = _Atomic_Load_uint( &lock->value, ATOMIC_ORDER_RELAXED );
+    actual = 0;
+
+    if ( ( value & SMP_QUEUED_LOCK_PENDING ) != 0 ) {
+      ++actual;
+    }
+
+    if ( ( value & SMP_QUEUED_LOCK_TAIL_MASK ) != 0 ) {
+      ++actual;
+    }
+  } while ( others != actual );
+}
+#endif
+
 #endif
@@ -609,14 +609,37 @@ void TicketLockWaitForReleases(
   unsigned int           release_count
 );
 
+#if defined(RTEMS_SMP_QUEUED_LOCK)
+bool QueuedLockIsAvailable( const SMP_queued_lock_Control *lock );
+
+void QueuedLockWaitForOwned( const SMP_queued_lock_Control *lock );
+
+/*
+ * The first waiter sets the pending flag and the second waiter becomes the
+ * queue tail, so at most two other acquires can be waited for.
+ */
+void QueuedLockWaitForOthers(
+  const SMP_queued_lock_Control *lock,
+  unsigned int                   others
+);
+#endif
+
 static inline bool ISRLockIsAvailable( const ISR_lock_Control *lock )
 {
+#if defined(RTEMS_SMP_QUEUED_LOCK)
+  return QueuedLockIsAvailable( &lock->Lock.Queued_lock );
+#else
   return TicketLockIsAvailable( &lock->Lock.Ticket_lock );
+#endif
 }
 
 static inline void ISRLockWaitForOwned( const ISR_lock_Control *lock )
 {
+#if defined(RTEMS_SMP_QUEUED_LOCK)
+  QueuedLockWaitForOwned( &lock->Lock.Queued_lock );
+#else
   TicketLockWaitForOwned( &lock->Lock.Ticket_lock );
+#endif
 }
 
 static inline void ISRLockWaitForOthers(
@@ -624,7 +647,11 @@ static inline void ISRLockWaitForOthers(
   unsigned int            others
 )
 {
+#if defined(RTEMS_SMP_QUEUED_LOCK)
+  QueuedLockWaitForOthers( &lock->Lock.Queued_lock, others );
+#else
   TicketLockWaitForOthers( &lock->Lock.Ticket_lock, others );
+#endif
 }
 #endif
 